@@ -57,6 +57,24 @@ namespace Google.Cloud.Diagnostics.Debug.Tests
             Assert.Null(breakpoint.CreateTime);
             Assert.Equal(_condition, breakpoint.Condition);
             Assert.Equal(_expressions, breakpoint.Expressions);
+            Assert.False(breakpoint.LogPoint);
+        }
+
+        [Fact]
+        public void Convert_LogPoint()
+        {
+            var sdBreakpoint = new StackdriverBreakpoint
+            {
+                Id = _id,
+                Action = StackdriverBreakpoint.Types.Action.Log,
+                LogMessageFormat = "a is $0",
+                Expressions = { _expressions }
+            };
+
+            var breakpoint = sdBreakpoint.Convert();
+            Assert.True(breakpoint.LogPoint);
+            Assert.Equal("a is $0", breakpoint.LogMessageFormat);
+            Assert.Equal(_expressions, breakpoint.Expressions);
         }
 
         [Fact]
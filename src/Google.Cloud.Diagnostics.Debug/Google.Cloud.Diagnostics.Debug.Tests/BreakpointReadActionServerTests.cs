@@ -58,6 +58,23 @@ namespace Google.Cloud.Diagnostics.Debug.Tests
             _mockDebuggerClient.Verify(c => c.UpdateBreakpoint(sdBreakpoint), Times.Once);
         }
 
+        [Fact]
+        public void MainAction_LogPoint()
+        {
+            var breakpoint = new Breakpoint
+            {
+                Id = "some-id",
+                LogPoint = true,
+                LogMessages = { "a", "b" }
+            };
+            _mockBreakpointServer.Setup(s => s.ReadBreakpointAsync(It.IsAny<CancellationToken>()))
+                .Returns(Task.FromResult(breakpoint));
+            _server.MainAction();
+
+            _mockDebuggerClient.Verify(c => c.UpdateBreakpoint(
+                It.IsAny<Debugger.V2.Breakpoint>()), Times.Never);
+        }
+
         [Fact]
         public void MainAction_KillServer()
         {
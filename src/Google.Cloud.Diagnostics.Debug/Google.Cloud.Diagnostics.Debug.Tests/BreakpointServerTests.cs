@@ -208,6 +208,69 @@ namespace Google.Cloud.Diagnostics.Debug.Tests
             _pipeMock.Verify(p => p.WriteAsync(It.IsAny<byte[]>(), _cts.Token), Times.Once());
         }
 
+        [Fact]
+        public async Task ReadBreakpointAsync_LengthPrefixed()
+        {
+            var server = new BreakpointServer(_pipeMock.Object, Constants.LengthPrefixedFramingVersion);
+            var breakpoint1 = new Breakpoint
+            {
+                Id = "some-id-1"
+            };
+            var breakpoint2 = new Breakpoint
+            {
+                Id = "some-id-2"
+            };
+
+            var breakpointMessages = CreateFramedBreakpointMessage(breakpoint1)
+                .Concat(CreateFramedBreakpointMessage(breakpoint2)).ToArray();
+
+            // The second read splits the header of the second breakpoint.
+            _pipeMock.SetupSequence(p => p.ReadAsync(_cts.Token))
+                .Returns(Task.FromResult(breakpointMessages.Take(5).ToArray()))
+                .Returns(Task.FromResult(breakpointMessages.Skip(5).Take(20).ToArray()))
+                .Returns(Task.FromResult(breakpointMessages.Skip(25).ToArray()));
+
+            Assert.Equal(breakpoint1, await server.ReadBreakpointAsync(_cts.Token));
+            Assert.Equal(breakpoint2, await server.ReadBreakpointAsync(_cts.Token));
+            _pipeMock.Verify(p => p.ReadAsync(_cts.Token), Times.Exactly(3));
+        }
+
+        [Fact]
+        public async Task ReadBreakpointAsync_LengthPrefixedInvalidHeader()
+        {
+            var server = new BreakpointServer(_pipeMock.Object, Constants.LengthPrefixedFramingVersion);
+            var breakpoint = new Breakpoint
+            {
+                Id = "some-id"
+            };
+
+            _pipeMock.Setup(p => p.ReadAsync(_cts.Token))
+                .Returns(Task.FromResult(CreateBreakpointMessage(breakpoint)));
+
+            await Assert.ThrowsAsync<InvalidOperationException>
+                (async () => await server.ReadBreakpointAsync(_cts.Token));
+        }
+
+        [Fact]
+        public void WriteBreakpointAsync_LengthPrefixed()
+        {
+            var server = new BreakpointServer(_pipeMock.Object, Constants.LengthPrefixedFramingVersion);
+            var breakpoint = new Breakpoint
+            {
+                Id = "some-id"
+            };
+            var expected = CreateFramedBreakpointMessage(breakpoint);
+
+            _pipeMock.Setup(p => p.WriteAsync(It.Is<byte[]>(b => b.SequenceEqual(expected)), _cts.Token));
+            server.WriteBreakpointAsync(breakpoint, _cts.Token);
+            _pipeMock.VerifyAll();
+            _pipeMock.Verify(p => p.WriteAsync(It.IsAny<byte[]>(), _cts.Token), Times.Once());
+        }
+
+        [Fact]
+        public void Constructor_InvalidFramingVersion() =>
+            Assert.Throws<ArgumentOutOfRangeException>(() => new BreakpointServer(_pipeMock.Object, 3));
+
         [Fact]
         public void IndexOfSequence()
         {
@@ -245,5 +308,13 @@ namespace Google.Cloud.Diagnostics.Debug.Tests
             bytes.AddRange(Constants.EndBreakpointMessage);
             return bytes.ToArray();
         }
+
+        private byte[] CreateFramedBreakpointMessage(Breakpoint breakpoint)
+        {
+            byte[] message = breakpoint.ToByteArray();
+            byte[] header = new byte[Constants.FramedMessageHeaderSize];
+            BreakpointServer.EncodeFramedMessageHeader(message.Length, header);
+            return header.Concat(message).ToArray();
+        }
     }
 }
@@ -94,8 +94,9 @@ namespace Google.Cloud.Diagnostics.Debug.Tests
             _server.MainAction();
 
             _mockDebuggerClient.Verify(c => c.ListBreakpoints(), Times.Once);
-            _mockDebuggerClient.Verify(c => c.UpdateBreakpoint(
-                Match.Create(GetErrorMatcher("0", Messages.LogPointNotSupported))), Times.Once);
+            _mockDebuggerClient.Verify(c => c.UpdateBreakpoint(It.IsAny<StackdriverBreakpoint>()), Times.Never);
+            _mockBreakpointServer.Verify(s => s.WriteBreakpointAsync(
+                breakpoints.Single().Convert(), It.IsAny<CancellationToken>()), Times.Once);
         }
 
         [Fact]
@@ -136,17 +137,6 @@ namespace Google.Cloud.Diagnostics.Debug.Tests
                 Match.Create((Breakpoint b) => !b.Activated), It.IsAny<CancellationToken>()), Times.Exactly(4));
         }
 
-        /// <summary>
-        /// Creates a matcher that will match a <see cref="StackdriverBreakpoint"/>
-        /// that has an error status.
-        /// </summary>
-        private Predicate<StackdriverBreakpoint> GetErrorMatcher(string id, string errorMessage)
-        {
-            return (b) =>
-                b.IsFinalState && b.Id == id && b.Status.IsError &&
-                b.Status.Description.Format == errorMessage;
-        }
-
         /// <summary>
         /// Create a list of <see cref="StackdriverBreakpoint"/>s.
         /// </summary>
@@ -95,6 +95,9 @@ namespace Google.Cloud.Diagnostics.Debug.Tests
                 ApplicationId = _processId,
                 PropertyEvaluation = true,
                 MethodEvaluation = true,
+                PdbParsingThreads = 4,
+                SymbolCacheDir = "/tmp/symbols",
+                MaxStringLength = 100,
             };
             var options = DebuggerOptions.FromAgentOptions(agentOptions);
             var optionsString = options.ToString();
@@ -103,6 +106,11 @@ namespace Google.Cloud.Diagnostics.Debug.Tests
             Assert.Contains($"{DebuggerOptions.ApplicationIdOption}={_processId}", optionsString);
             Assert.Contains($"{DebuggerOptions.PropertyEvaluationOption}", optionsString);
             Assert.Contains($"{DebuggerOptions.MethodEvaluationOption}", optionsString);
+            Assert.Contains($"{DebuggerOptions.PdbParsingThreadsOption}=4", optionsString);
+            Assert.Contains($"{DebuggerOptions.SymbolCacheDirOption}=\"/tmp/symbols\"", optionsString);
+            Assert.Contains($"{DebuggerOptions.MaxStringLengthOption}=100", optionsString);
+            Assert.Contains(
+                $"{DebuggerOptions.PipeFramingVersionOption}={Constants.LengthPrefixedFramingVersion}", optionsString);
             Assert.DoesNotContain(DebuggerOptions.ApplicationStartCommandOption, optionsString);
         }
 
@@ -117,8 +125,13 @@ namespace Google.Cloud.Diagnostics.Debug.Tests
             var optionsString = options.ToString();
             Assert.Contains($"{DebuggerOptions.PipeNameOption}={Constants.PipeName}", optionsString);
             Assert.Contains($"{DebuggerOptions.ApplicationStartCommandOption}=\"{_startCmd}\"", optionsString);
+            Assert.Contains(
+                $"{DebuggerOptions.PipeFramingVersionOption}={Constants.LengthPrefixedFramingVersion}", optionsString);
             Assert.DoesNotContain(DebuggerOptions.PropertyEvaluationOption, optionsString);
             Assert.DoesNotContain(DebuggerOptions.MethodEvaluationOption, optionsString);
+            Assert.DoesNotContain(DebuggerOptions.PdbParsingThreadsOption, optionsString);
+            Assert.DoesNotContain(DebuggerOptions.SymbolCacheDirOption, optionsString);
+            Assert.DoesNotContain(DebuggerOptions.MaxStringLengthOption, optionsString);
             Assert.DoesNotContain(DebuggerOptions.ApplicationIdOption, optionsString);
         }
     }
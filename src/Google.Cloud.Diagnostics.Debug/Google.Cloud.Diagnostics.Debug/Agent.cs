@@ -92,7 +92,8 @@ namespace Google.Cloud.Diagnostics.Debug
             TaskCompletionSource<bool> tcs = new TaskCompletionSource<bool>();
             new Thread(() =>
             {
-                var breakpointServer = new BreakpointServer(new NamedPipeServer(_debuggerOptions.PipeName));
+                var breakpointServer = new BreakpointServer(
+                    new NamedPipeServer(_debuggerOptions.PipeName), _debuggerOptions.PipeFramingVersion);
                 using (var server = new BreakpointWriteActionServer(breakpointServer, _cts, _client, _breakpointManager))
                 {
                     TryAction(() =>
@@ -121,7 +122,8 @@ namespace Google.Cloud.Diagnostics.Debug
             TaskCompletionSource<bool> tcs = new TaskCompletionSource<bool>();
             new Thread(() =>
             {
-                var breakpointServer = new BreakpointServer(new NamedPipeServer(_debuggerOptions.PipeName));
+                var breakpointServer = new BreakpointServer(
+                    new NamedPipeServer(_debuggerOptions.PipeName), _debuggerOptions.PipeFramingVersion);
                 using (var server = new BreakpointReadActionServer(breakpointServer, _cts, _client, _breakpointManager))
                 {
                     TryAction(() => 
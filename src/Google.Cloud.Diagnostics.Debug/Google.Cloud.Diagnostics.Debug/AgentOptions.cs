@@ -80,6 +80,21 @@ namespace Google.Cloud.Diagnostics.Debug
             " evaluating breakpoint's condition or expression.")]
         public bool MethodEvaluation { get; set; }
 
+        [Option("pdb-parsing-threads",
+            HelpText = "If set, the debugger will parse the symbols of loaded modules" +
+            " in the background using at most this many threads.")]
+        public int? PdbParsingThreads { get; set; }
+
+        [Option("symbol-cache-dir",
+            HelpText = "If set, the debugger will cache the parsed symbols of loaded modules" +
+            " in this directory so later runs do not have to parse them again.")]
+        public string SymbolCacheDir { get; set; }
+
+        [Option("max-string-length",
+            HelpText = "If set, the debugger will capture at most this many characters of a string." +
+            " Defaults to 4096.")]
+        public int? MaxStringLength { get; set; }
+
         [Option("source-context",
             HelpText = "The location of the source context file. See: " +
             "https://cloud.google.com/debugger/docs/source-context")]
@@ -23,7 +23,7 @@ namespace Google.Cloud.Diagnostics.Debug {
       byte[] descriptorData = global::System.Convert.FromBase64String(
           string.Concat(
             "ChBicmVha3BvaW50LnByb3RvEh5nb29nbGUuY2xvdWQuZGlhZ25vc3RpY3Mu",
-            "ZGVidWcaH2dvb2dsZS9wcm90b2J1Zi90aW1lc3RhbXAucHJvdG8i4QMKCkJy",
+            "ZGVidWcaH2dvb2dsZS9wcm90b2J1Zi90aW1lc3RhbXAucHJvdG8ikwQKCkJy",
             "ZWFrcG9pbnQSCgoCaWQYASABKAkSQAoIbG9jYXRpb24YAiABKAsyLi5nb29n",
             "bGUuY2xvdWQuZGlhZ25vc3RpY3MuZGVidWcuU291cmNlTG9jYXRpb24SQAoM",
             "c3RhY2tfZnJhbWVzGAMgAygLMiouZ29vZ2xlLmNsb3VkLmRpYWdub3N0aWNz",
@@ -34,22 +34,23 @@ namespace Google.Cloud.Diagnostics.Debug {
             "b25kaXRpb24YCSABKAkSRwoVZXZhbHVhdGVkX2V4cHJlc3Npb25zGAogAygL",
             "MiguZ29vZ2xlLmNsb3VkLmRpYWdub3N0aWNzLmRlYnVnLlZhcmlhYmxlEjYK",
             "BnN0YXR1cxgLIAEoCzImLmdvb2dsZS5jbG91ZC5kaWFnbm9zdGljcy5kZWJ1",
-            "Zy5TdGF0dXMSEQoJbG9nX3BvaW50GAwgASgIItoBCgpTdGFja0ZyYW1lEhMK",
-            "C21ldGhvZF9uYW1lGAEgASgJEkAKCGxvY2F0aW9uGAIgASgLMi4uZ29vZ2xl",
-            "LmNsb3VkLmRpYWdub3N0aWNzLmRlYnVnLlNvdXJjZUxvY2F0aW9uEjsKCWFy",
-            "Z3VtZW50cxgDIAMoCzIoLmdvb2dsZS5jbG91ZC5kaWFnbm9zdGljcy5kZWJ1",
-            "Zy5WYXJpYWJsZRI4CgZsb2NhbHMYBCADKAsyKC5nb29nbGUuY2xvdWQuZGlh",
-            "Z25vc3RpY3MuZGVidWcuVmFyaWFibGUiLAoOU291cmNlTG9jYXRpb24SDAoE",
-            "cGF0aBgBIAEoCRIMCgRsaW5lGAIgASgFIqgBCghWYXJpYWJsZRIMCgRuYW1l",
-            "GAEgASgJEgwKBHR5cGUYAiABKAkSDQoFdmFsdWUYAyABKAkSOQoHbWVtYmVy",
-            "cxgEIAMoCzIoLmdvb2dsZS5jbG91ZC5kaWFnbm9zdGljcy5kZWJ1Zy5WYXJp",
-            "YWJsZRI2CgZzdGF0dXMYBSABKAsyJi5nb29nbGUuY2xvdWQuZGlhZ25vc3Rp",
-            "Y3MuZGVidWcuU3RhdHVzIioKBlN0YXR1cxIPCgdpc2Vycm9yGAEgASgIEg8K",
-            "B21lc3NhZ2UYAiABKAliBnByb3RvMw=="));
+            "Zy5TdGF0dXMSEQoJbG9nX3BvaW50GAwgASgIEhoKEmxvZ19tZXNzYWdlX2Zv",
+            "cm1hdBgNIAEoCRIUCgxsb2dfbWVzc2FnZXMYDiADKAki2gEKClN0YWNrRnJh",
+            "bWUSEwoLbWV0aG9kX25hbWUYASABKAkSQAoIbG9jYXRpb24YAiABKAsyLi5n",
+            "b29nbGUuY2xvdWQuZGlhZ25vc3RpY3MuZGVidWcuU291cmNlTG9jYXRpb24S",
+            "OwoJYXJndW1lbnRzGAMgAygLMiguZ29vZ2xlLmNsb3VkLmRpYWdub3N0aWNz",
+            "LmRlYnVnLlZhcmlhYmxlEjgKBmxvY2FscxgEIAMoCzIoLmdvb2dsZS5jbG91",
+            "ZC5kaWFnbm9zdGljcy5kZWJ1Zy5WYXJpYWJsZSIsCg5Tb3VyY2VMb2NhdGlv",
+            "bhIMCgRwYXRoGAEgASgJEgwKBGxpbmUYAiABKAUiqAEKCFZhcmlhYmxlEgwK",
+            "BG5hbWUYASABKAkSDAoEdHlwZRgCIAEoCRINCgV2YWx1ZRgDIAEoCRI5Cgdt",
+            "ZW1iZXJzGAQgAygLMiguZ29vZ2xlLmNsb3VkLmRpYWdub3N0aWNzLmRlYnVn",
+            "LlZhcmlhYmxlEjYKBnN0YXR1cxgFIAEoCzImLmdvb2dsZS5jbG91ZC5kaWFn",
+            "bm9zdGljcy5kZWJ1Zy5TdGF0dXMiKgoGU3RhdHVzEg8KB2lzZXJyb3IYASAB",
+            "KAgSDwoHbWVzc2FnZRgCIAEoCUID+AEBYgZwcm90bzM="));
       descriptor = pbr::FileDescriptor.FromGeneratedCode(descriptorData,
           new pbr::FileDescriptor[] { global::Google.Protobuf.WellKnownTypes.TimestampReflection.Descriptor, },
           new pbr::GeneratedClrTypeInfo(null, new pbr::GeneratedClrTypeInfo[] {
-            new pbr::GeneratedClrTypeInfo(typeof(global::Google.Cloud.Diagnostics.Debug.Breakpoint), global::Google.Cloud.Diagnostics.Debug.Breakpoint.Parser, new[]{ "Id", "Location", "StackFrames", "Activated", "CreateTime", "FinalTime", "KillServer", "Expressions", "Condition", "EvaluatedExpressions", "Status", "LogPoint" }, null, null, null),
+            new pbr::GeneratedClrTypeInfo(typeof(global::Google.Cloud.Diagnostics.Debug.Breakpoint), global::Google.Cloud.Diagnostics.Debug.Breakpoint.Parser, new[]{ "Id", "Location", "StackFrames", "Activated", "CreateTime", "FinalTime", "KillServer", "Expressions", "Condition", "EvaluatedExpressions", "Status", "LogPoint", "LogMessageFormat", "LogMessages" }, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::Google.Cloud.Diagnostics.Debug.StackFrame), global::Google.Cloud.Diagnostics.Debug.StackFrame.Parser, new[]{ "MethodName", "Location", "Arguments", "Locals" }, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::Google.Cloud.Diagnostics.Debug.SourceLocation), global::Google.Cloud.Diagnostics.Debug.SourceLocation.Parser, new[]{ "Path", "Line" }, null, null, null),
             new pbr::GeneratedClrTypeInfo(typeof(global::Google.Cloud.Diagnostics.Debug.Variable), global::Google.Cloud.Diagnostics.Debug.Variable.Parser, new[]{ "Name", "Type", "Value", "Members", "Status" }, null, null, null),
@@ -96,6 +97,8 @@ namespace Google.Cloud.Diagnostics.Debug {
       evaluatedExpressions_ = other.evaluatedExpressions_.Clone();
       Status = other.status_ != null ? other.Status.Clone() : null;
       logPoint_ = other.logPoint_;
+      logMessageFormat_ = other.logMessageFormat_;
+      logMessages_ = other.logMessages_.Clone();
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -232,6 +235,27 @@ namespace Google.Cloud.Diagnostics.Debug {
       }
     }
 
+    /// <summary>Field number for the "log_message_format" field.</summary>
+    public const int LogMessageFormatFieldNumber = 13;
+    private string logMessageFormat_ = "";
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public string LogMessageFormat {
+      get { return logMessageFormat_; }
+      set {
+        logMessageFormat_ = pb::ProtoPreconditions.CheckNotNull(value, "value");
+      }
+    }
+
+    /// <summary>Field number for the "log_messages" field.</summary>
+    public const int LogMessagesFieldNumber = 14;
+    private static readonly pb::FieldCodec<string> _repeated_logMessages_codec
+        = pb::FieldCodec.ForString(114);
+    private readonly pbc::RepeatedField<string> logMessages_ = new pbc::RepeatedField<string>();
+    [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
+    public pbc::RepeatedField<string> LogMessages {
+      get { return logMessages_; }
+    }
+
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
     public override bool Equals(object other) {
       return Equals(other as Breakpoint);
@@ -257,6 +281,8 @@ namespace Google.Cloud.Diagnostics.Debug {
       if(!evaluatedExpressions_.Equals(other.evaluatedExpressions_)) return false;
       if (!object.Equals(Status, other.Status)) return false;
       if (LogPoint != other.LogPoint) return false;
+      if (LogMessageFormat != other.LogMessageFormat) return false;
+      if(!logMessages_.Equals(other.logMessages_)) return false;
       return true;
     }
 
@@ -275,6 +301,8 @@ namespace Google.Cloud.Diagnostics.Debug {
       hash ^= evaluatedExpressions_.GetHashCode();
       if (status_ != null) hash ^= Status.GetHashCode();
       if (LogPoint != false) hash ^= LogPoint.GetHashCode();
+      if (LogMessageFormat.Length != 0) hash ^= LogMessageFormat.GetHashCode();
+      hash ^= logMessages_.GetHashCode();
       return hash;
     }
 
@@ -324,6 +352,11 @@ namespace Google.Cloud.Diagnostics.Debug {
         output.WriteRawTag(96);
         output.WriteBool(LogPoint);
       }
+      if (LogMessageFormat.Length != 0) {
+        output.WriteRawTag(106);
+        output.WriteString(LogMessageFormat);
+      }
+      logMessages_.WriteTo(output, _repeated_logMessages_codec);
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -359,6 +392,10 @@ namespace Google.Cloud.Diagnostics.Debug {
       if (LogPoint != false) {
         size += 1 + 1;
       }
+      if (LogMessageFormat.Length != 0) {
+        size += 1 + pb::CodedOutputStream.ComputeStringSize(LogMessageFormat);
+      }
+      size += logMessages_.CalculateSize(_repeated_logMessages_codec);
       return size;
     }
 
@@ -409,6 +446,10 @@ namespace Google.Cloud.Diagnostics.Debug {
       if (other.LogPoint != false) {
         LogPoint = other.LogPoint;
       }
+      if (other.LogMessageFormat.Length != 0) {
+        LogMessageFormat = other.LogMessageFormat;
+      }
+      logMessages_.Add(other.logMessages_);
     }
 
     [global::System.Diagnostics.DebuggerNonUserCodeAttribute]
@@ -479,6 +520,14 @@ namespace Google.Cloud.Diagnostics.Debug {
             LogPoint = input.ReadBool();
             break;
           }
+          case 106: {
+            LogMessageFormat = input.ReadString();
+            break;
+          }
+          case 114: {
+            logMessages_.AddEntriesFrom(input, _repeated_logMessages_codec);
+            break;
+          }
         }
       }
     }
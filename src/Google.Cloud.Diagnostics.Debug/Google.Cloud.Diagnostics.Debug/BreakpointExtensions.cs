@@ -41,7 +41,9 @@ namespace Google.Cloud.Diagnostics.Debug
                     Path = breakpoint.Location?.Path,
                 },
                 Condition = breakpoint.Condition,
-                Expressions = { breakpoint.Expressions }
+                Expressions = { breakpoint.Expressions },
+                LogPoint = breakpoint.Action == StackdriverBreakpoint.Types.Action.Log,
+                LogMessageFormat = breakpoint.LogMessageFormat ?? "",
             };
         }
 
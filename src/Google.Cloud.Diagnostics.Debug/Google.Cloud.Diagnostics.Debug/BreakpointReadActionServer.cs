@@ -13,6 +13,7 @@
 // limitations under the License.
 
 using Google.Api.Gax;
+using System;
 using System.Threading;
 using StackdriverBreakpoint = Google.Cloud.Debugger.V2.Breakpoint;
 
@@ -44,6 +45,8 @@ namespace Google.Cloud.Diagnostics.Debug
         /// <summary>
         /// Blocks and reads a breakpoint from the <see cref="IBreakpointServer"/>
         /// and then sends the sends the breakpoint to the debugger API.
+        /// Messages of a log point are written to the console and the log point
+        /// stays active unless it was returned with a status.
         /// </summary>
         internal override void MainAction()
         {
@@ -53,6 +56,14 @@ namespace Google.Cloud.Diagnostics.Debug
                 _cts.Cancel();
                 return;
             }
+            if (readBreakpoint.LogPoint && readBreakpoint.Status == null)
+            {
+                foreach (var message in readBreakpoint.LogMessages)
+                {
+                    Console.WriteLine($"{Messages.LogPointPrefix}{message}");
+                }
+                return;
+            }
             StackdriverBreakpoint breakpoint = readBreakpoint.Convert();
             breakpoint.IsFinalState = true;
             _client.UpdateBreakpoint(breakpoint);
@@ -15,6 +15,7 @@
 using Google.Protobuf;
 using System;
 using System.Collections.Generic;
+using System.IO;
 using System.Linq;
 using System.Threading;
 using System.Threading.Tasks;
@@ -35,11 +36,25 @@ namespace Google.Cloud.Diagnostics.Debug
         /// <summary>The pipe to send and receive breakpoint messages with.</summary>
         private readonly INamedPipeServer _pipe;
 
+        /// <summary>The version of the pipe protocol used to frame breakpoint messages.</summary>
+        private readonly int _framingVersion;
+
         /// <summary>
         /// Create a <see cref="BreakpointServer"/>.
         /// </summary>
         /// <param name="pipe">The named pipe to send and receive breakpoint messages with.</param>
-        public BreakpointServer(INamedPipeServer pipe) =>_pipe = pipe;
+        /// <param name="framingVersion">The version of the pipe protocol used to frame breakpoint
+        ///     messages. Must match the debugger. Defaults to <see cref="Constants.SentinelFramingVersion"/>.</param>
+        public BreakpointServer(INamedPipeServer pipe, int framingVersion = Constants.SentinelFramingVersion)
+        {
+            if (framingVersion != Constants.SentinelFramingVersion
+                && framingVersion != Constants.LengthPrefixedFramingVersion)
+            {
+                throw new ArgumentOutOfRangeException(nameof(framingVersion));
+            }
+            _pipe = pipe;
+            _framingVersion = framingVersion;
+        }
 
         /// <inheritdoc />
         public Task WaitForConnectionAsync() => _pipe.WaitForConnectionAsync();
@@ -50,6 +65,11 @@ namespace Google.Cloud.Diagnostics.Debug
             await _semaphore.WaitAsync(cancellationToken).ConfigureAwait(false);
             try
             {
+                if (_framingVersion == Constants.LengthPrefixedFramingVersion)
+                {
+                    return await ReadLengthPrefixedBreakpointAsync(cancellationToken).ConfigureAwait(false);
+                }
+
                 List<byte> previousBuffer = _buffer;
                 _buffer = new List<byte>();
 
@@ -85,9 +105,71 @@ namespace Google.Cloud.Diagnostics.Debug
             }
         }
 
+        /// <summary>
+        /// Reads a length-prefixed breakpoint message. Must be called while holding <see cref="_semaphore"/>.
+        /// </summary>
+        private async Task<Breakpoint> ReadLengthPrefixedBreakpointAsync(CancellationToken cancellationToken)
+        {
+            await FillBufferAsync(Constants.FramedMessageHeaderSize, cancellationToken).ConfigureAwait(false);
+
+            int magicLength = Constants.FramedMessageMagic.Length;
+            byte[] header = _buffer.GetRange(0, Constants.FramedMessageHeaderSize).ToArray();
+            if (!Match(header, 0, Constants.FramedMessageMagic)
+                || header[magicLength] != Constants.LengthPrefixedFramingVersion)
+            {
+                throw new InvalidOperationException("Invalid breakpoint message header.");
+            }
+
+            uint messageSize = (uint)(header[magicLength + 1]
+                | header[magicLength + 2] << 8
+                | header[magicLength + 3] << 16
+                | header[magicLength + 4] << 24);
+            if (messageSize > Constants.MaximumFramedMessageSize)
+            {
+                throw new InvalidOperationException($"Breakpoint message is too large: {messageSize}.");
+            }
+
+            int totalSize = Constants.FramedMessageHeaderSize + (int)messageSize;
+            await FillBufferAsync(totalSize, cancellationToken).ConfigureAwait(false);
+
+            byte[] message = new byte[messageSize];
+            _buffer.CopyTo(Constants.FramedMessageHeaderSize, message, 0, message.Length);
+            _buffer.RemoveRange(0, totalSize);
+            return Breakpoint.Parser.ParseFrom(message);
+        }
+
+        /// <summary>
+        /// Reads from the pipe until the buffer holds at least <paramref name="size"/> bytes.
+        /// </summary>
+        private async Task FillBufferAsync(int size, CancellationToken cancellationToken)
+        {
+            while (_buffer.Count < size)
+            {
+                byte[] bytes = await _pipe.ReadAsync(cancellationToken).ConfigureAwait(false);
+                if (bytes.Length == 0)
+                {
+                    throw new InvalidOperationException("Pipe closed in the middle of a breakpoint message.");
+                }
+                _buffer.AddRange(bytes);
+            }
+        }
+
         /// <inheritdoc />
         public Task WriteBreakpointAsync(Breakpoint breakpoint, CancellationToken cancellationToken = default(CancellationToken))
         {
+            if (_framingVersion == Constants.LengthPrefixedFramingVersion)
+            {
+                int messageSize = breakpoint.CalculateSize();
+                byte[] framed = new byte[Constants.FramedMessageHeaderSize + messageSize];
+                EncodeFramedMessageHeader(messageSize, framed);
+                // Serialize straight after the header so the message is not copied.
+                using (var stream = new MemoryStream(framed, Constants.FramedMessageHeaderSize, messageSize))
+                {
+                    breakpoint.WriteTo(stream);
+                }
+                return _pipe.WriteAsync(framed, cancellationToken);
+            }
+
             List<byte> bytes = new List<byte>();
             bytes.AddRange(Constants.StartBreakpointMessage);
             bytes.AddRange(breakpoint.ToByteArray());
@@ -95,6 +177,21 @@ namespace Google.Cloud.Diagnostics.Debug
             return _pipe.WriteAsync(bytes.ToArray(), cancellationToken);
         }
 
+        /// <summary>
+        /// Writes the header of a length-prefixed breakpoint message of
+        /// <paramref name="messageSize"/> bytes to the start of <paramref name="buffer"/>.
+        /// </summary>
+        internal static void EncodeFramedMessageHeader(int messageSize, byte[] buffer)
+        {
+            int magicLength = Constants.FramedMessageMagic.Length;
+            Array.Copy(Constants.FramedMessageMagic, buffer, magicLength);
+            buffer[magicLength] = (byte)Constants.LengthPrefixedFramingVersion;
+            buffer[magicLength + 1] = (byte)messageSize;
+            buffer[magicLength + 2] = (byte)(messageSize >> 8);
+            buffer[magicLength + 3] = (byte)(messageSize >> 16);
+            buffer[magicLength + 4] = (byte)(messageSize >> 24);
+        }
+
         /// <summary>
         /// Get the start index of a sequence.
         /// </summary>
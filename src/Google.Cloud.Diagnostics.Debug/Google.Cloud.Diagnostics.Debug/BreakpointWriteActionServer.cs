@@ -43,8 +43,8 @@ namespace Google.Cloud.Diagnostics.Debug
 
         /// <summary>
         /// Lists breakpoints from the debugger API.  Stale breakpoints are removed,
-        /// new breakpoints are sent to the <see cref="IBreakpointServer"/> and 
-        /// breakpoints that cannot be processed are returned with an error.
+        /// and new breakpoints, including log points, are sent to the
+        /// <see cref="IBreakpointServer"/>.
         /// </summary>
         internal override void MainAction()
         {
@@ -64,17 +64,7 @@ namespace Google.Cloud.Diagnostics.Debug
 
             foreach (var breakpoint in bpmResponse.New)
             {
-                if (breakpoint.Action == Debugger.V2.Breakpoint.Types.Action.Log)
-                {
-                    breakpoint.Status = Common.CreateStatusMessage(
-                        Messages.LogPointNotSupported, isError: true);
-                    breakpoint.IsFinalState = true;
-                    _client.UpdateBreakpoint(breakpoint);
-                }
-                else
-                {
-                    _server.WriteBreakpointAsync(breakpoint.Convert()).Wait();
-                }
+                _server.WriteBreakpointAsync(breakpoint.Convert()).Wait();
             }
         }
     }
@@ -29,5 +29,27 @@ namespace Google.Cloud.Diagnostics.Debug
 
         /// <summary>The end of a breakpoint message.</summary>
         public static readonly byte[] EndBreakpointMessage = Encoding.ASCII.GetBytes("END_DEBUG_MESSAGE");
+
+        /// <summary>
+        /// The version of the pipe protocol that wraps breakpoint messages in
+        /// <see cref="StartBreakpointMessage"/> and <see cref="EndBreakpointMessage"/>.
+        /// </summary>
+        public const int SentinelFramingVersion = 1;
+
+        /// <summary>
+        /// The version of the pipe protocol that prefixes breakpoint messages with a header
+        /// of <see cref="FramedMessageHeaderSize"/> bytes: <see cref="FramedMessageMagic"/>,
+        /// the version and the size of the message as a little-endian 32-bit integer.
+        /// </summary>
+        public const int LengthPrefixedFramingVersion = 2;
+
+        /// <summary>The start of the header of a length-prefixed breakpoint message.</summary>
+        public static readonly byte[] FramedMessageMagic = Encoding.ASCII.GetBytes("GCD");
+
+        /// <summary>The size of the header of a length-prefixed breakpoint message.</summary>
+        public const int FramedMessageHeaderSize = 8;
+
+        /// <summary>The largest length-prefixed breakpoint message that will be read.</summary>
+        public const int MaximumFramedMessageSize = 64 * 1024 * 1024;
     }
 }
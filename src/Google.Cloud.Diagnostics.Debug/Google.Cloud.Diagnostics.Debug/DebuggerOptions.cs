@@ -36,6 +36,20 @@ namespace Google.Cloud.Diagnostics.Debug
         // The name of the pipe the debugger will attach to.
         public const string PipeNameOption = "--pipe-name";
 
+        // If given this option, the debugger will parse the PDB files of loaded modules
+        // in the background using at most this many threads.
+        public const string PdbParsingThreadsOption = "--pdb-parsing-threads";
+
+        // If given this option, the debugger will cache the parsed PDB files of loaded
+        // modules in this directory.
+        public const string SymbolCacheDirOption = "--symbol-cache-dir";
+
+        // If given this option, the debugger will capture at most this many characters of a string.
+        public const string MaxStringLengthOption = "--max-string-length";
+
+        // The version of the pipe protocol the debugger will use to frame breakpoint messages.
+        public const string PipeFramingVersionOption = "--pipe-framing-version";
+
         /// <summary>
         /// If true, the debugger will evaluate properties.
         /// </summary>
@@ -62,6 +76,31 @@ namespace Google.Cloud.Diagnostics.Debug
         /// </summary>
         public string PipeName { get; private set; }
 
+        /// <summary>
+        /// The maximum number of threads the debugger will use to parse the PDB files of
+        /// loaded modules in the background. If not set, PDB files are parsed when a
+        /// breakpoint needs them.
+        /// </summary>
+        public int? PdbParsingThreads { get; private set; }
+
+        /// <summary>
+        /// The directory the debugger will cache the parsed PDB files of loaded modules in.
+        /// If not set, PDB files are parsed on every run.
+        /// </summary>
+        public string SymbolCacheDir { get; private set; }
+
+        /// <summary>
+        /// The maximum number of characters of a string the debugger captures.
+        /// If not set, the debugger uses its default.
+        /// </summary>
+        public int? MaxStringLength { get; private set; }
+
+        /// <summary>
+        /// The version of the pipe protocol the debugger and the <see cref="Agent"/>
+        /// use to frame breakpoint messages.
+        /// </summary>
+        public int PipeFramingVersion { get; private set; } = Constants.SentinelFramingVersion;
+
         /// <summary>
         /// Create <see cref="DebuggerOptions"/> from <see cref="AgentOptions"/>.
         /// </summary>
@@ -80,7 +119,11 @@ namespace Google.Cloud.Diagnostics.Debug
                 MethodEvaluation = options.MethodEvaluation,
                 ApplicationStartCommand = options.ApplicationStartCommand,
                 ApplicationId = options.ApplicationId,
-                PipeName = CreatePipeName()
+                PipeName = CreatePipeName(),
+                PdbParsingThreads = options.PdbParsingThreads,
+                SymbolCacheDir = options.SymbolCacheDir,
+                MaxStringLength = options.MaxStringLength,
+                PipeFramingVersion = Constants.LengthPrefixedFramingVersion
             };
         }
 
@@ -119,6 +162,23 @@ namespace Google.Cloud.Diagnostics.Debug
             {
                 options += $"{MethodEvaluationOption} ";
             }
+
+            if (PdbParsingThreads.HasValue)
+            {
+                options += $"{PdbParsingThreadsOption}={PdbParsingThreads} ";
+            }
+
+            if (!string.IsNullOrWhiteSpace(SymbolCacheDir))
+            {
+                options += $"{SymbolCacheDirOption}=\"{SymbolCacheDir}\" ";
+            }
+
+            if (MaxStringLength.HasValue)
+            {
+                options += $"{MaxStringLengthOption}={MaxStringLength} ";
+            }
+
+            options += $"{PipeFramingVersionOption}={PipeFramingVersion} ";
             return options;
         }
 
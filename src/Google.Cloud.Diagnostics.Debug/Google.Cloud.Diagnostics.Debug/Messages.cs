@@ -16,8 +16,8 @@ namespace Google.Cloud.Diagnostics.Debug
     internal class Messages
     {
         /// <summary>
-        /// A message stating that log points are not supported.
+        /// The prefix written in front of each log point message.
         /// </summary>
-        public const string LogPointNotSupported = "Log points are currently not supported.";
+        public const string LogPointPrefix = "LOGPOINT: ";
     }
 }
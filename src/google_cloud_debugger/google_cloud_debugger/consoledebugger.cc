@@ -39,13 +39,38 @@ const string kApplicationIDOption = "application-id";
 // The name of the pipe the debugger will use to communicate with the agent.
 const string kPipeNameOption = "pipe-name";
 
+// If given this option, the debugger will parse the PDB files of loaded
+// modules in the background using at most this many threads.
+const string kPdbParsingThreadsOption = "pdb-parsing-threads";
+
+// If given this option, the debugger will cache the parsed content of PDB
+// files in this directory and reuse it on later runs.
+const string kSymbolCacheDirOption = "symbol-cache-dir";
+
+// If given this option, the debugger will capture at most this many
+// characters of a string.
+const string kMaxStringLengthOption = "max-string-length";
+
+// The version of the pipe protocol the debugger will use to frame
+// breakpoint messages. Has to match the agent.
+const string kPipeFramingVersionOption = "pipe-framing-version";
+
+// The maximum number of snapshots that can wait to be written to the agent
+// after the application resumes. 0 writes them before it resumes.
+const string kSnapshotQueueSizeOption = "snapshot-queue-size";
+
 enum optionIndex {
   UNKNOWN,
   APPLICATIONSTARTCOMMAND,
   APPLICATIONID,
   PROPERTYEVALUATION,
   METHODEVALUATION,
-  PIPENAME
+  PIPENAME,
+  PDBPARSINGTHREADS,
+  SYMBOLCACHEDIR,
+  MAXSTRINGLENGTH,
+  PIPEFRAMINGVERSION,
+  SNAPSHOTQUEUESIZE
 };
 const option::Descriptor usage[] = {
     // The first dummy Descriptor is used for unknown options,
@@ -74,6 +99,31 @@ const option::Descriptor usage[] = {
     {PIPENAME, 0, "", kPipeNameOption.c_str(), option::Arg::Optional,
      "  --pipe-name  \tThe name of the pipe the debugger will use to"
      "communicate with the agent."},
+    {PDBPARSINGTHREADS, 0, "", kPdbParsingThreadsOption.c_str(),
+     option::Arg::Optional,
+     "  --pdb-parsing-threads  \tIf used, the debugger will parse the PDB "
+     "files of loaded modules in the background with at most this many "
+     "threads instead of waiting for a breakpoint to be set."},
+    {SYMBOLCACHEDIR, 0, "", kSymbolCacheDirOption.c_str(),
+     option::Arg::Optional,
+     "  --symbol-cache-dir  \tIf used, the debugger will cache the parsed "
+     "content of PDB files in this directory so later runs do not have to "
+     "parse them again."},
+    {MAXSTRINGLENGTH, 0, "", kMaxStringLengthOption.c_str(),
+     option::Arg::Optional,
+     "  --max-string-length  \tIf used, the debugger will capture at most "
+     "this many characters of a string. Defaults to 4096."},
+    {PIPEFRAMINGVERSION, 0, "", kPipeFramingVersionOption.c_str(),
+     option::Arg::Optional,
+     "  --pipe-framing-version  \tThe version of the pipe protocol used to "
+     "frame breakpoint messages. 1 wraps messages in start and end markers, "
+     "2 prefixes them with their length. Defaults to 1."},
+    {SNAPSHOTQUEUESIZE, 0, "", kSnapshotQueueSizeOption.c_str(),
+     option::Arg::Optional,
+     "  --snapshot-queue-size  \tThe maximum number of snapshots that can "
+     "wait to be written to the agent after the application resumes. If 0, "
+     "the application waits until its snapshots are written. Defaults to "
+     "64."},
     {0, 0, 0, 0, 0, 0}  // Needs this, otherwise the parser throws error.
 };
 
@@ -125,6 +175,71 @@ int main(int argc, char *argv[]) {
   Debugger debugger(pipe_name);
   HRESULT hr;
 
+  if (options[PDBPARSINGTHREADS].count()) {
+    try {
+      int pdb_parsing_threads =
+          stoi(string(options[PDBPARSINGTHREADS].arg));
+      if (pdb_parsing_threads < 0) {
+        cerr << "Number of PDB parsing threads has to be positive.";
+        return -1;
+      }
+      debugger.SetPdbParsingThreads(pdb_parsing_threads);
+    } catch (std::invalid_argument &ex) {
+      cerr << "Number of PDB parsing threads is not a valid number.";
+      return -1;
+    }
+  }
+
+  if (options[SYMBOLCACHEDIR].count() && options[SYMBOLCACHEDIR].arg) {
+    debugger.SetSymbolCacheDirectory(string(options[SYMBOLCACHEDIR].arg));
+  }
+
+  if (options[MAXSTRINGLENGTH].count()) {
+    try {
+      int max_string_length = stoi(string(options[MAXSTRINGLENGTH].arg));
+      if (max_string_length <= 0) {
+        cerr << "Maximum length of captured strings has to be positive.";
+        return -1;
+      }
+      debugger.SetMaxStringLength(max_string_length);
+    } catch (std::invalid_argument &ex) {
+      cerr << "Maximum length of captured strings is not a valid number.";
+      return -1;
+    }
+  }
+
+  if (options[PIPEFRAMINGVERSION].count()) {
+    try {
+      int pipe_framing_version =
+          stoi(string(options[PIPEFRAMINGVERSION].arg));
+      if (pipe_framing_version !=
+              google_cloud_debugger::kSentinelFramingVersion &&
+          pipe_framing_version !=
+              google_cloud_debugger::kLengthPrefixedFramingVersion) {
+        cerr << "Pipe framing version has to be 1 or 2.";
+        return -1;
+      }
+      debugger.SetPipeFramingVersion(pipe_framing_version);
+    } catch (std::invalid_argument &ex) {
+      cerr << "Pipe framing version is not a valid number.";
+      return -1;
+    }
+  }
+
+  if (options[SNAPSHOTQUEUESIZE].count()) {
+    try {
+      int snapshot_queue_size = stoi(string(options[SNAPSHOTQUEUESIZE].arg));
+      if (snapshot_queue_size < 0) {
+        cerr << "Snapshot queue size cannot be negative.";
+        return -1;
+      }
+      debugger.SetSnapshotQueueSize(snapshot_queue_size);
+    } catch (std::invalid_argument &ex) {
+      cerr << "Snapshot queue size is not a valid number.";
+      return -1;
+    }
+  }
+
   if (options[APPLICATIONSTARTCOMMAND].count()) {
     string command_line = string(options[APPLICATIONSTARTCOMMAND].arg);
     std::vector<WCHAR> wchar_command_line =
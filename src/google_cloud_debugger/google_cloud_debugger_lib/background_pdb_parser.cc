@@ -0,0 +1,130 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "background_pdb_parser.h"
+
+#include <iostream>
+
+#include "i_cor_debug_helper.h"
+#include "i_portable_pdb_file.h"
+
+using google_cloud_debugger::CComPtr;
+using google_cloud_debugger::ICorDebugHelper;
+using std::lock_guard;
+using std::mutex;
+using std::shared_ptr;
+using std::unique_lock;
+
+namespace google_cloud_debugger_portable_pdb {
+
+BackgroundPdbParser::BackgroundPdbParser(
+    std::uint32_t max_threads, shared_ptr<ICorDebugHelper> debug_helper)
+    : max_threads_(max_threads), debug_helper_(debug_helper) {}
+
+BackgroundPdbParser::~BackgroundPdbParser() {
+  {
+    lock_guard<mutex> lock(mutex_);
+    stopping_ = true;
+    pending_pdb_files_.clear();
+  }
+  pending_cv_.notify_all();
+  idle_cv_.notify_all();
+
+  for (auto &&thread : threads_) {
+    thread.join();
+  }
+}
+
+void BackgroundPdbParser::Enqueue(shared_ptr<IPortablePdbFile> pdb_file) {
+  if (!pdb_file) {
+    return;
+  }
+
+  {
+    lock_guard<mutex> lock(mutex_);
+    if (stopping_) {
+      return;
+    }
+
+    pending_pdb_files_.push_back(std::move(pdb_file));
+
+    // Starts another thread if every thread is busy.
+    if (threads_.size() < max_threads_ &&
+        active_parses_ + pending_pdb_files_.size() > threads_.size()) {
+      threads_.push_back(std::thread(&BackgroundPdbParser::ParseLoop, this));
+    }
+  }
+  pending_cv_.notify_one();
+}
+
+void BackgroundPdbParser::WaitUntilIdle() {
+  unique_lock<mutex> lock(mutex_);
+  idle_cv_.wait(lock, [this]() {
+    return stopping_ || (pending_pdb_files_.empty() && active_parses_ == 0);
+  });
+}
+
+std::uint32_t BackgroundPdbParser::GetThreadCount() {
+  lock_guard<mutex> lock(mutex_);
+  return threads_.size();
+}
+
+void BackgroundPdbParser::ParseLoop() {
+  while (true) {
+    shared_ptr<IPortablePdbFile> pdb_file;
+    {
+      unique_lock<mutex> lock(mutex_);
+      pending_cv_.wait(lock, [this]() {
+        return stopping_ || !pending_pdb_files_.empty();
+      });
+      if (stopping_) {
+        return;
+      }
+
+      pdb_file = std::move(pending_pdb_files_.front());
+      pending_pdb_files_.pop_front();
+      ++active_parses_;
+    }
+
+    // Modules without a Portable PDB are expected, so failures are only
+    // reported when the PDB is needed to set a breakpoint.
+    if (pdb_file->ParsePdbFile() && debug_helper_) {
+      PopulateTypeNameTable(pdb_file.get());
+    }
+
+    {
+      lock_guard<mutex> lock(mutex_);
+      --active_parses_;
+    }
+    idle_cv_.notify_all();
+  }
+}
+
+void BackgroundPdbParser::PopulateTypeNameTable(IPortablePdbFile *pdb_file) {
+  shared_ptr<google_cloud_debugger::TypeNameTable> type_name_table =
+      pdb_file->GetTypeNameTable();
+  if (!type_name_table) {
+    return;
+  }
+
+  CComPtr<IMetaDataImport> metadata_import;
+  if (FAILED(pdb_file->GetMetaDataImport(&metadata_import))) {
+    return;
+  }
+
+  // A failure here is retried by the first frame that needs the table.
+  type_name_table->Populate(metadata_import, debug_helper_.get(), &std::cerr);
+}
+
+}  // namespace google_cloud_debugger_portable_pdb
@@ -0,0 +1,108 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BACKGROUND_PDB_PARSER_H_
+#define BACKGROUND_PDB_PARSER_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace google_cloud_debugger {
+class ICorDebugHelper;
+}
+
+namespace google_cloud_debugger_portable_pdb {
+
+class IPortablePdbFile;
+
+// Parses Portable PDB files on a bounded pool of background threads.
+//
+// DebuggerCallback hands the PDB of every loaded module to this class so
+// that the PDB is usually parsed by the time a breakpoint is set in it.
+// IPortablePdbFile::ParsePdbFile only parses a file once, so a breakpoint
+// that needs a PDB that is being parsed in the background waits for that
+// parse instead of starting another one.
+//
+// If the parser has an ICorDebugHelper, it also populates the type name
+// table of every module whose PDB is parsed, so the first breakpoint
+// condition or expression that looks up a type by name does not have to.
+class BackgroundPdbParser {
+ public:
+  // Creates a parser that uses at most max_threads threads.
+  // Threads are only started when there are PDB files to parse.
+  // debug_helper is used to populate type name tables. It can be null.
+  explicit BackgroundPdbParser(
+      std::uint32_t max_threads,
+      std::shared_ptr<google_cloud_debugger::ICorDebugHelper> debug_helper =
+          nullptr);
+
+  // Drops the PDB files that are not yet parsed and joins the threads.
+  ~BackgroundPdbParser();
+
+  BackgroundPdbParser(const BackgroundPdbParser &) = delete;
+  BackgroundPdbParser &operator=(const BackgroundPdbParser &) = delete;
+
+  // Queues pdb_file to be parsed by one of the background threads.
+  void Enqueue(std::shared_ptr<IPortablePdbFile> pdb_file);
+
+  // Blocks until every queued PDB file is parsed.
+  void WaitUntilIdle();
+
+  // Returns the number of threads that are started.
+  std::uint32_t GetThreadCount();
+
+ private:
+  // Loop run by every background thread. Parses PDB files from
+  // pending_pdb_files_ until stopping_ is set.
+  void ParseLoop();
+
+  // Populates the type name table of the module of pdb_file.
+  void PopulateTypeNameTable(IPortablePdbFile *pdb_file);
+
+  // Maximum number of threads of this parser.
+  std::uint32_t max_threads_;
+
+  // Helper used to populate type name tables. Can be null.
+  std::shared_ptr<google_cloud_debugger::ICorDebugHelper> debug_helper_;
+
+  // Number of PDB files that threads are parsing at the moment.
+  std::uint32_t active_parses_ = 0;
+
+  // True if the threads should exit.
+  bool stopping_ = false;
+
+  // PDB files that are waiting to be parsed.
+  std::deque<std::shared_ptr<IPortablePdbFile>> pending_pdb_files_;
+
+  // The background threads.
+  std::vector<std::thread> threads_;
+
+  // Protects all the fields above.
+  std::mutex mutex_;
+
+  // Signaled when a PDB file is queued or when stopping_ is set.
+  std::condition_variable pending_cv_;
+
+  // Signaled when a thread finishes parsing a PDB file.
+  std::condition_variable idle_cv_;
+};
+
+}  // namespace google_cloud_debugger_portable_pdb
+
+#endif  // BACKGROUND_PDB_PARSER_H_
@@ -77,6 +77,8 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Breakpoint, evaluated_expressions_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Breakpoint, status_),
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Breakpoint, log_point_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Breakpoint, log_message_format_),
+  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Breakpoint, log_messages_),
   ~0u,  // no _has_bits_
   GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StackFrame, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -114,10 +116,10 @@ const ::google::protobuf::uint32 TableStruct::offsets[] = {
 
 static const ::google::protobuf::internal::MigrationSchema schemas[] = {
   { 0, -1, sizeof(Breakpoint)},
-  { 17, -1, sizeof(StackFrame)},
-  { 26, -1, sizeof(SourceLocation)},
-  { 33, -1, sizeof(Variable)},
-  { 43, -1, sizeof(Status)},
+  { 19, -1, sizeof(StackFrame)},
+  { 28, -1, sizeof(SourceLocation)},
+  { 35, -1, sizeof(Variable)},
+  { 45, -1, sizeof(Status)},
 };
 
 static ::google::protobuf::Message const * const file_default_instances[] = {
@@ -197,7 +199,7 @@ void AddDescriptorsImpl() {
   static const char descriptor[] = {
       "\n\020breakpoint.proto\022\036google.cloud.diagnos"
       "tics.debug\032\037google/protobuf/timestamp.pr"
-      "oto\"\341\003\n\nBreakpoint\022\n\n\002id\030\001 \001(\t\022@\n\010locati"
+      "oto\"\223\004\n\nBreakpoint\022\n\n\002id\030\001 \001(\t\022@\n\010locati"
       "on\030\002 \001(\0132..google.cloud.diagnostics.debu"
       "g.SourceLocation\022@\n\014stack_frames\030\003 \003(\0132*"
       ".google.cloud.diagnostics.debug.StackFra"
@@ -209,22 +211,23 @@ void AddDescriptorsImpl() {
       "ions\030\n \003(\0132(.google.cloud.diagnostics.de"
       "bug.Variable\0226\n\006status\030\013 \001(\0132&.google.cl"
       "oud.diagnostics.debug.Status\022\021\n\tlog_poin"
-      "t\030\014 \001(\010\"\332\001\n\nStackFrame\022\023\n\013method_name\030\001 "
-      "\001(\t\022@\n\010location\030\002 \001(\0132..google.cloud.dia"
-      "gnostics.debug.SourceLocation\022;\n\targumen"
-      "ts\030\003 \003(\0132(.google.cloud.diagnostics.debu"
-      "g.Variable\0228\n\006locals\030\004 \003(\0132(.google.clou"
-      "d.diagnostics.debug.Variable\",\n\016SourceLo"
-      "cation\022\014\n\004path\030\001 \001(\t\022\014\n\004line\030\002 \001(\005\"\250\001\n\010V"
-      "ariable\022\014\n\004name\030\001 \001(\t\022\014\n\004type\030\002 \001(\t\022\r\n\005v"
-      "alue\030\003 \001(\t\0229\n\007members\030\004 \003(\0132(.google.clo"
-      "ud.diagnostics.debug.Variable\0226\n\006status\030"
-      "\005 \001(\0132&.google.cloud.diagnostics.debug.S"
-      "tatus\"*\n\006Status\022\017\n\007iserror\030\001 \001(\010\022\017\n\007mess"
-      "age\030\002 \001(\tb\006proto3"
+      "t\030\014 \001(\010\022\032\n\022log_message_format\030\r \001(\t\022\024\n\014l"
+      "og_messages\030\016 \003(\t\"\332\001\n\nStackFrame\022\023\n\013meth"
+      "od_name\030\001 \001(\t\022@\n\010location\030\002 \001(\0132..google"
+      ".cloud.diagnostics.debug.SourceLocation\022"
+      ";\n\targuments\030\003 \003(\0132(.google.cloud.diagno"
+      "stics.debug.Variable\0228\n\006locals\030\004 \003(\0132(.g"
+      "oogle.cloud.diagnostics.debug.Variable\","
+      "\n\016SourceLocation\022\014\n\004path\030\001 \001(\t\022\014\n\004line\030\002"
+      " \001(\005\"\250\001\n\010Variable\022\014\n\004name\030\001 \001(\t\022\014\n\004type\030"
+      "\002 \001(\t\022\r\n\005value\030\003 \001(\t\0229\n\007members\030\004 \003(\0132(."
+      "google.cloud.diagnostics.debug.Variable\022"
+      "6\n\006status\030\005 \001(\0132&.google.cloud.diagnosti"
+      "cs.debug.Status\"*\n\006Status\022\017\n\007iserror\030\001 \001"
+      "(\010\022\017\n\007message\030\002 \001(\tB\003\370\001\001b\006proto3"
   };
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 1057);
+      descriptor, 1112);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "breakpoint.proto", &protobuf_RegisterTypes);
   ::google::protobuf::protobuf_google_2fprotobuf_2ftimestamp_2eproto::AddDescriptors();
@@ -247,6 +250,194 @@ struct StaticDescriptorInitializer {
 
 // ===================================================================
 
+void Breakpoint::_slow_mutable_location() {
+  location_ = ::google::protobuf::Arena::CreateMessage< ::google::cloud::diagnostics::debug::SourceLocation >(
+      GetArenaNoVirtual());
+}
+::google::cloud::diagnostics::debug::SourceLocation* Breakpoint::_slow_release_location() {
+  if (location_ == NULL) {
+    return NULL;
+  } else {
+    ::google::cloud::diagnostics::debug::SourceLocation* temp = new ::google::cloud::diagnostics::debug::SourceLocation(*location_);
+    location_ = NULL;
+    return temp;
+  }
+}
+::google::cloud::diagnostics::debug::SourceLocation* Breakpoint::unsafe_arena_release_location() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Breakpoint.location)
+  
+  ::google::cloud::diagnostics::debug::SourceLocation* temp = location_;
+  location_ = NULL;
+  return temp;
+}
+void Breakpoint::_slow_set_allocated_location(
+    ::google::protobuf::Arena* message_arena, ::google::cloud::diagnostics::debug::SourceLocation** location) {
+    if (message_arena != NULL && 
+        ::google::protobuf::Arena::GetArena(*location) == NULL) {
+      message_arena->Own(*location);
+    } else if (message_arena !=
+               ::google::protobuf::Arena::GetArena(*location)) {
+      ::google::cloud::diagnostics::debug::SourceLocation* new_location = 
+            ::google::protobuf::Arena::CreateMessage< ::google::cloud::diagnostics::debug::SourceLocation >(
+            message_arena);
+      new_location->CopyFrom(**location);
+      *location = new_location;
+    }
+}
+void Breakpoint::unsafe_arena_set_allocated_location(
+    ::google::cloud::diagnostics::debug::SourceLocation* location) {
+  if (GetArenaNoVirtual() == NULL) {
+    delete location_;
+  }
+  location_ = location;
+  if (location) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Breakpoint.location)
+}
+void Breakpoint::_slow_mutable_create_time() {
+  create_time_ = ::google::protobuf::Arena::CreateMessage< ::google::protobuf::Timestamp >(
+      GetArenaNoVirtual());
+}
+::google::protobuf::Timestamp* Breakpoint::_slow_release_create_time() {
+  if (create_time_ == NULL) {
+    return NULL;
+  } else {
+    ::google::protobuf::Timestamp* temp = new ::google::protobuf::Timestamp(*create_time_);
+    create_time_ = NULL;
+    return temp;
+  }
+}
+::google::protobuf::Timestamp* Breakpoint::unsafe_arena_release_create_time() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Breakpoint.create_time)
+  
+  ::google::protobuf::Timestamp* temp = create_time_;
+  create_time_ = NULL;
+  return temp;
+}
+void Breakpoint::_slow_set_allocated_create_time(
+    ::google::protobuf::Arena* message_arena, ::google::protobuf::Timestamp** create_time) {
+    if (message_arena != NULL && 
+        ::google::protobuf::Arena::GetArena(*create_time) == NULL) {
+      message_arena->Own(*create_time);
+    } else if (message_arena !=
+               ::google::protobuf::Arena::GetArena(*create_time)) {
+      ::google::protobuf::Timestamp* new_create_time = 
+            ::google::protobuf::Arena::CreateMessage< ::google::protobuf::Timestamp >(
+            message_arena);
+      new_create_time->CopyFrom(**create_time);
+      *create_time = new_create_time;
+    }
+}
+void Breakpoint::unsafe_arena_set_allocated_create_time(
+    ::google::protobuf::Timestamp* create_time) {
+  if (GetArenaNoVirtual() == NULL) {
+    delete create_time_;
+  }
+  create_time_ = create_time;
+  if (create_time) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Breakpoint.create_time)
+}
+void Breakpoint::_slow_mutable_final_time() {
+  final_time_ = ::google::protobuf::Arena::CreateMessage< ::google::protobuf::Timestamp >(
+      GetArenaNoVirtual());
+}
+::google::protobuf::Timestamp* Breakpoint::_slow_release_final_time() {
+  if (final_time_ == NULL) {
+    return NULL;
+  } else {
+    ::google::protobuf::Timestamp* temp = new ::google::protobuf::Timestamp(*final_time_);
+    final_time_ = NULL;
+    return temp;
+  }
+}
+::google::protobuf::Timestamp* Breakpoint::unsafe_arena_release_final_time() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Breakpoint.final_time)
+  
+  ::google::protobuf::Timestamp* temp = final_time_;
+  final_time_ = NULL;
+  return temp;
+}
+void Breakpoint::_slow_set_allocated_final_time(
+    ::google::protobuf::Arena* message_arena, ::google::protobuf::Timestamp** final_time) {
+    if (message_arena != NULL && 
+        ::google::protobuf::Arena::GetArena(*final_time) == NULL) {
+      message_arena->Own(*final_time);
+    } else if (message_arena !=
+               ::google::protobuf::Arena::GetArena(*final_time)) {
+      ::google::protobuf::Timestamp* new_final_time = 
+            ::google::protobuf::Arena::CreateMessage< ::google::protobuf::Timestamp >(
+            message_arena);
+      new_final_time->CopyFrom(**final_time);
+      *final_time = new_final_time;
+    }
+}
+void Breakpoint::unsafe_arena_set_allocated_final_time(
+    ::google::protobuf::Timestamp* final_time) {
+  if (GetArenaNoVirtual() == NULL) {
+    delete final_time_;
+  }
+  final_time_ = final_time;
+  if (final_time) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Breakpoint.final_time)
+}
+void Breakpoint::_slow_mutable_status() {
+  status_ = ::google::protobuf::Arena::CreateMessage< ::google::cloud::diagnostics::debug::Status >(
+      GetArenaNoVirtual());
+}
+::google::cloud::diagnostics::debug::Status* Breakpoint::_slow_release_status() {
+  if (status_ == NULL) {
+    return NULL;
+  } else {
+    ::google::cloud::diagnostics::debug::Status* temp = new ::google::cloud::diagnostics::debug::Status(*status_);
+    status_ = NULL;
+    return temp;
+  }
+}
+::google::cloud::diagnostics::debug::Status* Breakpoint::unsafe_arena_release_status() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Breakpoint.status)
+  
+  ::google::cloud::diagnostics::debug::Status* temp = status_;
+  status_ = NULL;
+  return temp;
+}
+void Breakpoint::_slow_set_allocated_status(
+    ::google::protobuf::Arena* message_arena, ::google::cloud::diagnostics::debug::Status** status) {
+    if (message_arena != NULL && 
+        ::google::protobuf::Arena::GetArena(*status) == NULL) {
+      message_arena->Own(*status);
+    } else if (message_arena !=
+               ::google::protobuf::Arena::GetArena(*status)) {
+      ::google::cloud::diagnostics::debug::Status* new_status = 
+            ::google::protobuf::Arena::CreateMessage< ::google::cloud::diagnostics::debug::Status >(
+            message_arena);
+      new_status->CopyFrom(**status);
+      *status = new_status;
+    }
+}
+void Breakpoint::unsafe_arena_set_allocated_status(
+    ::google::cloud::diagnostics::debug::Status* status) {
+  if (GetArenaNoVirtual() == NULL) {
+    delete status_;
+  }
+  status_ = status;
+  if (status) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Breakpoint.status)
+}
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int Breakpoint::kIdFieldNumber;
 const int Breakpoint::kLocationFieldNumber;
@@ -260,6 +451,8 @@ const int Breakpoint::kConditionFieldNumber;
 const int Breakpoint::kEvaluatedExpressionsFieldNumber;
 const int Breakpoint::kStatusFieldNumber;
 const int Breakpoint::kLogPointFieldNumber;
+const int Breakpoint::kLogMessageFormatFieldNumber;
+const int Breakpoint::kLogMessagesFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 Breakpoint::Breakpoint()
@@ -270,21 +463,41 @@ Breakpoint::Breakpoint()
   SharedCtor();
   // @@protoc_insertion_point(constructor:google.cloud.diagnostics.debug.Breakpoint)
 }
+Breakpoint::Breakpoint(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena),
+  stack_frames_(arena),
+  expressions_(arena),
+  evaluated_expressions_(arena),
+  log_messages_(arena) {
+  protobuf_breakpoint_2eproto::InitDefaults();
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:google.cloud.diagnostics.debug.Breakpoint)
+}
 Breakpoint::Breakpoint(const Breakpoint& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
       stack_frames_(from.stack_frames_),
       expressions_(from.expressions_),
       evaluated_expressions_(from.evaluated_expressions_),
+      log_messages_(from.log_messages_),
       _cached_size_(0) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   id_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.id().size() > 0) {
-    id_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.id_);
+    id_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.id(),
+      GetArenaNoVirtual());
   }
   condition_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.condition().size() > 0) {
-    condition_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.condition_);
+    condition_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.condition(),
+      GetArenaNoVirtual());
+  }
+  log_message_format_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.log_message_format().size() > 0) {
+    log_message_format_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.log_message_format(),
+      GetArenaNoVirtual());
   }
   if (from.has_location()) {
     location_ = new ::google::cloud::diagnostics::debug::SourceLocation(*from.location_);
@@ -315,6 +528,7 @@ Breakpoint::Breakpoint(const Breakpoint& from)
 void Breakpoint::SharedCtor() {
   id_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   condition_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  log_message_format_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(&location_, 0, reinterpret_cast<char*>(&log_point_) -
     reinterpret_cast<char*>(&location_) + sizeof(log_point_));
   _cached_size_ = 0;
@@ -326,8 +540,14 @@ Breakpoint::~Breakpoint() {
 }
 
 void Breakpoint::SharedDtor() {
-  id_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  condition_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  id_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  condition_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  log_message_format_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
   if (this != internal_default_instance()) {
     delete location_;
   }
@@ -342,6 +562,13 @@ void Breakpoint::SharedDtor() {
   }
 }
 
+void Breakpoint::ArenaDtor(void* object) {
+  Breakpoint* _this = reinterpret_cast< Breakpoint* >(object);
+  (void)_this;
+}
+void Breakpoint::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
+
 void Breakpoint::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -358,11 +585,7 @@ const Breakpoint& Breakpoint::default_instance() {
 }
 
 Breakpoint* Breakpoint::New(::google::protobuf::Arena* arena) const {
-  Breakpoint* n = new Breakpoint;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<Breakpoint>(arena);
 }
 
 void Breakpoint::Clear() {
@@ -370,8 +593,10 @@ void Breakpoint::Clear() {
   stack_frames_.Clear();
   expressions_.Clear();
   evaluated_expressions_.Clear();
-  id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  condition_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  log_messages_.Clear();
+  id_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  condition_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  log_message_format_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   if (GetArenaNoVirtual() == NULL && location_ != NULL) {
     delete location_;
   }
@@ -565,6 +790,39 @@ bool Breakpoint::MergePartialFromCodedStream(
         break;
       }
 
+      // string log_message_format = 13;
+      case 13: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(106u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_log_message_format()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->log_message_format().data(), this->log_message_format().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "google.cloud.diagnostics.debug.Breakpoint.log_message_format"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated string log_messages = 14;
+      case 14: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(114u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_log_messages()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->log_messages(this->log_messages_size() - 1).data(),
+            this->log_messages(this->log_messages_size() - 1).length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "google.cloud.diagnostics.debug.Breakpoint.log_messages"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0 ||
@@ -673,6 +931,26 @@ void Breakpoint::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteBool(12, this->log_point(), output);
   }
 
+  // string log_message_format = 13;
+  if (this->log_message_format().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->log_message_format().data(), this->log_message_format().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "google.cloud.diagnostics.debug.Breakpoint.log_message_format");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      13, this->log_message_format(), output);
+  }
+
+  // repeated string log_messages = 14;
+  for (int i = 0, n = this->log_messages_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->log_messages(i).data(), this->log_messages(i).length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "google.cloud.diagnostics.debug.Breakpoint.log_messages");
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      14, this->log_messages(i), output);
+  }
+
   // @@protoc_insertion_point(serialize_end:google.cloud.diagnostics.debug.Breakpoint)
 }
 
@@ -771,6 +1049,27 @@ void Breakpoint::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(12, this->log_point(), target);
   }
 
+  // string log_message_format = 13;
+  if (this->log_message_format().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->log_message_format().data(), this->log_message_format().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "google.cloud.diagnostics.debug.Breakpoint.log_message_format");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        13, this->log_message_format(), target);
+  }
+
+  // repeated string log_messages = 14;
+  for (int i = 0, n = this->log_messages_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->log_messages(i).data(), this->log_messages(i).length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "google.cloud.diagnostics.debug.Breakpoint.log_messages");
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(14, this->log_messages(i), target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:google.cloud.diagnostics.debug.Breakpoint)
   return target;
 }
@@ -809,6 +1108,14 @@ size_t Breakpoint::ByteSizeLong() const {
     }
   }
 
+  // repeated string log_messages = 14;
+  total_size += 1 *
+      ::google::protobuf::internal::FromIntSize(this->log_messages_size());
+  for (int i = 0, n = this->log_messages_size(); i < n; i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->log_messages(i));
+  }
+
   // string id = 1;
   if (this->id().size() > 0) {
     total_size += 1 +
@@ -823,6 +1130,13 @@ size_t Breakpoint::ByteSizeLong() const {
         this->condition());
   }
 
+  // string log_message_format = 13;
+  if (this->log_message_format().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->log_message_format());
+  }
+
   // .google.cloud.diagnostics.debug.SourceLocation location = 2;
   if (this->has_location()) {
     total_size += 1 +
@@ -898,13 +1212,15 @@ void Breakpoint::MergeFrom(const Breakpoint& from) {
   stack_frames_.MergeFrom(from.stack_frames_);
   expressions_.MergeFrom(from.expressions_);
   evaluated_expressions_.MergeFrom(from.evaluated_expressions_);
+  log_messages_.MergeFrom(from.log_messages_);
   if (from.id().size() > 0) {
-
-    id_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.id_);
+    set_id(from.id());
   }
   if (from.condition().size() > 0) {
-
-    condition_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.condition_);
+    set_condition(from.condition());
+  }
+  if (from.log_message_format().size() > 0) {
+    set_log_message_format(from.log_message_format());
   }
   if (from.has_location()) {
     mutable_location()->::google::cloud::diagnostics::debug::SourceLocation::MergeFrom(from.location());
@@ -949,14 +1265,31 @@ bool Breakpoint::IsInitialized() const {
 
 void Breakpoint::Swap(Breakpoint* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    Breakpoint* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void Breakpoint::UnsafeArenaSwap(Breakpoint* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void Breakpoint::InternalSwap(Breakpoint* other) {
   stack_frames_.InternalSwap(&other->stack_frames_);
   expressions_.InternalSwap(&other->expressions_);
   evaluated_expressions_.InternalSwap(&other->evaluated_expressions_);
+  log_messages_.InternalSwap(&other->log_messages_);
   id_.Swap(&other->id_);
   condition_.Swap(&other->condition_);
+  log_message_format_.Swap(&other->log_message_format_);
   std::swap(location_, other->location_);
   std::swap(create_time_, other->create_time_);
   std::swap(final_time_, other->final_time_);
@@ -977,46 +1310,54 @@ void Breakpoint::InternalSwap(Breakpoint* other) {
 
 // string id = 1;
 void Breakpoint::clear_id() {
-  id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  id_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& Breakpoint::id() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Breakpoint.id)
-  return id_.GetNoArena();
+  return id_.Get();
 }
 void Breakpoint::set_id(const ::std::string& value) {
   
-  id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  id_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Breakpoint.id)
 }
 #if LANG_CXX11
 void Breakpoint::set_id(::std::string&& value) {
   
-  id_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  id_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.Breakpoint.id)
 }
 #endif
 void Breakpoint::set_id(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  id_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Breakpoint.id)
 }
 void Breakpoint::set_id(const char* value, size_t size) {
   
-  id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  id_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Breakpoint.id)
 }
 ::std::string* Breakpoint::mutable_id() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.id)
-  return id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return id_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* Breakpoint::release_id() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Breakpoint.id)
   
-  return id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return id_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* Breakpoint::unsafe_arena_release_id() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Breakpoint.id)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return id_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void Breakpoint::set_allocated_id(::std::string* id) {
   if (id != NULL) {
@@ -1024,9 +1365,22 @@ void Breakpoint::set_allocated_id(::std::string* id) {
   } else {
     
   }
-  id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), id);
+  id_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), id,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.Breakpoint.id)
 }
+void Breakpoint::unsafe_arena_set_allocated_id(
+    ::std::string* id) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (id != NULL) {
+    
+  } else {
+    
+  }
+  id_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      id, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Breakpoint.id)
+}
 
 // .google.cloud.diagnostics.debug.SourceLocation location = 2;
 bool Breakpoint::has_location() const {
@@ -1044,7 +1398,7 @@ const ::google::cloud::diagnostics::debug::SourceLocation& Breakpoint::location(
 ::google::cloud::diagnostics::debug::SourceLocation* Breakpoint::mutable_location() {
   
   if (location_ == NULL) {
-    location_ = new ::google::cloud::diagnostics::debug::SourceLocation;
+    _slow_mutable_location();
   }
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.location)
   return location_;
@@ -1052,12 +1406,22 @@ const ::google::cloud::diagnostics::debug::SourceLocation& Breakpoint::location(
 ::google::cloud::diagnostics::debug::SourceLocation* Breakpoint::release_location() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Breakpoint.location)
   
-  ::google::cloud::diagnostics::debug::SourceLocation* temp = location_;
-  location_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_location();
+  } else {
+    ::google::cloud::diagnostics::debug::SourceLocation* temp = location_;
+    location_ = NULL;
+    return temp;
+  }
 }
 void Breakpoint::set_allocated_location(::google::cloud::diagnostics::debug::SourceLocation* location) {
-  delete location_;
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete location_;
+  }
+  if (location != NULL) {
+    _slow_set_allocated_location(message_arena, &location);
+  }
   location_ = location;
   if (location) {
     
@@ -1127,7 +1491,7 @@ const ::google::protobuf::Timestamp& Breakpoint::create_time() const {
 ::google::protobuf::Timestamp* Breakpoint::mutable_create_time() {
   
   if (create_time_ == NULL) {
-    create_time_ = new ::google::protobuf::Timestamp;
+    _slow_mutable_create_time();
   }
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.create_time)
   return create_time_;
@@ -1135,16 +1499,21 @@ const ::google::protobuf::Timestamp& Breakpoint::create_time() const {
 ::google::protobuf::Timestamp* Breakpoint::release_create_time() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Breakpoint.create_time)
   
-  ::google::protobuf::Timestamp* temp = create_time_;
-  create_time_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_create_time();
+  } else {
+    ::google::protobuf::Timestamp* temp = create_time_;
+    create_time_ = NULL;
+    return temp;
+  }
 }
 void Breakpoint::set_allocated_create_time(::google::protobuf::Timestamp* create_time) {
-  delete create_time_;
-  if (create_time != NULL && create_time->GetArena() != NULL) {
-    ::google::protobuf::Timestamp* new_create_time = new ::google::protobuf::Timestamp;
-    new_create_time->CopyFrom(*create_time);
-    create_time = new_create_time;
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete create_time_;
+  }
+  if (create_time != NULL) {
+    _slow_set_allocated_create_time(message_arena, &create_time);
   }
   create_time_ = create_time;
   if (create_time) {
@@ -1171,7 +1540,7 @@ const ::google::protobuf::Timestamp& Breakpoint::final_time() const {
 ::google::protobuf::Timestamp* Breakpoint::mutable_final_time() {
   
   if (final_time_ == NULL) {
-    final_time_ = new ::google::protobuf::Timestamp;
+    _slow_mutable_final_time();
   }
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.final_time)
   return final_time_;
@@ -1179,16 +1548,21 @@ const ::google::protobuf::Timestamp& Breakpoint::final_time() const {
 ::google::protobuf::Timestamp* Breakpoint::release_final_time() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Breakpoint.final_time)
   
-  ::google::protobuf::Timestamp* temp = final_time_;
-  final_time_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_final_time();
+  } else {
+    ::google::protobuf::Timestamp* temp = final_time_;
+    final_time_ = NULL;
+    return temp;
+  }
 }
 void Breakpoint::set_allocated_final_time(::google::protobuf::Timestamp* final_time) {
-  delete final_time_;
-  if (final_time != NULL && final_time->GetArena() != NULL) {
-    ::google::protobuf::Timestamp* new_final_time = new ::google::protobuf::Timestamp;
-    new_final_time->CopyFrom(*final_time);
-    final_time = new_final_time;
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete final_time_;
+  }
+  if (final_time != NULL) {
+    _slow_set_allocated_final_time(message_arena, &final_time);
   }
   final_time_ = final_time;
   if (final_time) {
@@ -1284,46 +1658,54 @@ Breakpoint::mutable_expressions() {
 
 // string condition = 9;
 void Breakpoint::clear_condition() {
-  condition_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  condition_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& Breakpoint::condition() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Breakpoint.condition)
-  return condition_.GetNoArena();
+  return condition_.Get();
 }
 void Breakpoint::set_condition(const ::std::string& value) {
   
-  condition_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  condition_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Breakpoint.condition)
 }
 #if LANG_CXX11
 void Breakpoint::set_condition(::std::string&& value) {
   
-  condition_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  condition_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.Breakpoint.condition)
 }
 #endif
 void Breakpoint::set_condition(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  condition_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  condition_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Breakpoint.condition)
 }
 void Breakpoint::set_condition(const char* value, size_t size) {
   
-  condition_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  condition_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Breakpoint.condition)
 }
 ::std::string* Breakpoint::mutable_condition() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.condition)
-  return condition_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return condition_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* Breakpoint::release_condition() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Breakpoint.condition)
   
-  return condition_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return condition_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* Breakpoint::unsafe_arena_release_condition() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Breakpoint.condition)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return condition_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void Breakpoint::set_allocated_condition(::std::string* condition) {
   if (condition != NULL) {
@@ -1331,9 +1713,22 @@ void Breakpoint::set_allocated_condition(::std::string* condition) {
   } else {
     
   }
-  condition_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), condition);
+  condition_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), condition,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.Breakpoint.condition)
 }
+void Breakpoint::unsafe_arena_set_allocated_condition(
+    ::std::string* condition) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (condition != NULL) {
+    
+  } else {
+    
+  }
+  condition_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      condition, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Breakpoint.condition)
+}
 
 // repeated .google.cloud.diagnostics.debug.Variable evaluated_expressions = 10;
 int Breakpoint::evaluated_expressions_size() const {
@@ -1381,7 +1776,7 @@ const ::google::cloud::diagnostics::debug::Status& Breakpoint::status() const {
 ::google::cloud::diagnostics::debug::Status* Breakpoint::mutable_status() {
   
   if (status_ == NULL) {
-    status_ = new ::google::cloud::diagnostics::debug::Status;
+    _slow_mutable_status();
   }
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.status)
   return status_;
@@ -1389,12 +1784,22 @@ const ::google::cloud::diagnostics::debug::Status& Breakpoint::status() const {
 ::google::cloud::diagnostics::debug::Status* Breakpoint::release_status() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Breakpoint.status)
   
-  ::google::cloud::diagnostics::debug::Status* temp = status_;
-  status_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_status();
+  } else {
+    ::google::cloud::diagnostics::debug::Status* temp = status_;
+    status_ = NULL;
+    return temp;
+  }
 }
 void Breakpoint::set_allocated_status(::google::cloud::diagnostics::debug::Status* status) {
-  delete status_;
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete status_;
+  }
+  if (status != NULL) {
+    _slow_set_allocated_status(message_arena, &status);
+  }
   status_ = status;
   if (status) {
     
@@ -1420,8 +1825,198 @@ void Breakpoint::set_log_point(bool value) {
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
+// string log_message_format = 13;
+void Breakpoint::clear_log_message_format() {
+  log_message_format_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+const ::std::string& Breakpoint::log_message_format() const {
+  // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+  return log_message_format_.Get();
+}
+void Breakpoint::set_log_message_format(const ::std::string& value) {
+  
+  log_message_format_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+}
+#if LANG_CXX11
+void Breakpoint::set_log_message_format(::std::string&& value) {
+  
+  log_message_format_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+}
+#endif
+void Breakpoint::set_log_message_format(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  log_message_format_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+}
+void Breakpoint::set_log_message_format(const char* value, size_t size) {
+  
+  log_message_format_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+}
+::std::string* Breakpoint::mutable_log_message_format() {
+  
+  // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+  return log_message_format_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* Breakpoint::release_log_message_format() {
+  // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+  
+  return log_message_format_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* Breakpoint::unsafe_arena_release_log_message_format() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return log_message_format_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
+}
+void Breakpoint::set_allocated_log_message_format(::std::string* log_message_format) {
+  if (log_message_format != NULL) {
+    
+  } else {
+    
+  }
+  log_message_format_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), log_message_format,
+      GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+}
+void Breakpoint::unsafe_arena_set_allocated_log_message_format(
+    ::std::string* log_message_format) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (log_message_format != NULL) {
+    
+  } else {
+    
+  }
+  log_message_format_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      log_message_format, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+}
+
+// repeated string log_messages = 14;
+int Breakpoint::log_messages_size() const {
+  return log_messages_.size();
+}
+void Breakpoint::clear_log_messages() {
+  log_messages_.Clear();
+}
+const ::std::string& Breakpoint::log_messages(int index) const {
+  // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+  return log_messages_.Get(index);
+}
+::std::string* Breakpoint::mutable_log_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+  return log_messages_.Mutable(index);
+}
+void Breakpoint::set_log_messages(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+  log_messages_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+void Breakpoint::set_log_messages(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+  log_messages_.Mutable(index)->assign(std::move(value));
+}
+#endif
+void Breakpoint::set_log_messages(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  log_messages_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+}
+void Breakpoint::set_log_messages(int index, const char* value, size_t size) {
+  log_messages_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+}
+::std::string* Breakpoint::add_log_messages() {
+  // @@protoc_insertion_point(field_add_mutable:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+  return log_messages_.Add();
+}
+void Breakpoint::add_log_messages(const ::std::string& value) {
+  log_messages_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+}
+#if LANG_CXX11
+void Breakpoint::add_log_messages(::std::string&& value) {
+  log_messages_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+}
+#endif
+void Breakpoint::add_log_messages(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  log_messages_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+}
+void Breakpoint::add_log_messages(const char* value, size_t size) {
+  log_messages_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+}
+const ::google::protobuf::RepeatedPtrField< ::std::string>&
+Breakpoint::log_messages() const {
+  // @@protoc_insertion_point(field_list:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+  return log_messages_;
+}
+::google::protobuf::RepeatedPtrField< ::std::string>*
+Breakpoint::mutable_log_messages() {
+  // @@protoc_insertion_point(field_mutable_list:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+  return &log_messages_;
+}
+
 // ===================================================================
 
+void StackFrame::_slow_mutable_location() {
+  location_ = ::google::protobuf::Arena::CreateMessage< ::google::cloud::diagnostics::debug::SourceLocation >(
+      GetArenaNoVirtual());
+}
+::google::cloud::diagnostics::debug::SourceLocation* StackFrame::_slow_release_location() {
+  if (location_ == NULL) {
+    return NULL;
+  } else {
+    ::google::cloud::diagnostics::debug::SourceLocation* temp = new ::google::cloud::diagnostics::debug::SourceLocation(*location_);
+    location_ = NULL;
+    return temp;
+  }
+}
+::google::cloud::diagnostics::debug::SourceLocation* StackFrame::unsafe_arena_release_location() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.StackFrame.location)
+  
+  ::google::cloud::diagnostics::debug::SourceLocation* temp = location_;
+  location_ = NULL;
+  return temp;
+}
+void StackFrame::_slow_set_allocated_location(
+    ::google::protobuf::Arena* message_arena, ::google::cloud::diagnostics::debug::SourceLocation** location) {
+    if (message_arena != NULL && 
+        ::google::protobuf::Arena::GetArena(*location) == NULL) {
+      message_arena->Own(*location);
+    } else if (message_arena !=
+               ::google::protobuf::Arena::GetArena(*location)) {
+      ::google::cloud::diagnostics::debug::SourceLocation* new_location = 
+            ::google::protobuf::Arena::CreateMessage< ::google::cloud::diagnostics::debug::SourceLocation >(
+            message_arena);
+      new_location->CopyFrom(**location);
+      *location = new_location;
+    }
+}
+void StackFrame::unsafe_arena_set_allocated_location(
+    ::google::cloud::diagnostics::debug::SourceLocation* location) {
+  if (GetArenaNoVirtual() == NULL) {
+    delete location_;
+  }
+  location_ = location;
+  if (location) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.StackFrame.location)
+}
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int StackFrame::kMethodNameFieldNumber;
 const int StackFrame::kLocationFieldNumber;
@@ -1437,6 +2032,16 @@ StackFrame::StackFrame()
   SharedCtor();
   // @@protoc_insertion_point(constructor:google.cloud.diagnostics.debug.StackFrame)
 }
+StackFrame::StackFrame(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena),
+  arguments_(arena),
+  locals_(arena) {
+  protobuf_breakpoint_2eproto::InitDefaults();
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:google.cloud.diagnostics.debug.StackFrame)
+}
 StackFrame::StackFrame(const StackFrame& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -1446,7 +2051,8 @@ StackFrame::StackFrame(const StackFrame& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   method_name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.method_name().size() > 0) {
-    method_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.method_name_);
+    method_name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.method_name(),
+      GetArenaNoVirtual());
   }
   if (from.has_location()) {
     location_ = new ::google::cloud::diagnostics::debug::SourceLocation(*from.location_);
@@ -1468,12 +2074,24 @@ StackFrame::~StackFrame() {
 }
 
 void StackFrame::SharedDtor() {
-  method_name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  method_name_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
   if (this != internal_default_instance()) {
     delete location_;
   }
 }
 
+void StackFrame::ArenaDtor(void* object) {
+  StackFrame* _this = reinterpret_cast< StackFrame* >(object);
+  (void)_this;
+}
+void StackFrame::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
+
 void StackFrame::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -1490,18 +2108,14 @@ const StackFrame& StackFrame::default_instance() {
 }
 
 StackFrame* StackFrame::New(::google::protobuf::Arena* arena) const {
-  StackFrame* n = new StackFrame;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<StackFrame>(arena);
 }
 
 void StackFrame::Clear() {
 // @@protoc_insertion_point(message_clear_start:google.cloud.diagnostics.debug.StackFrame)
   arguments_.Clear();
   locals_.Clear();
-  method_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  method_name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   if (GetArenaNoVirtual() == NULL && location_ != NULL) {
     delete location_;
   }
@@ -1742,8 +2356,7 @@ void StackFrame::MergeFrom(const StackFrame& from) {
   arguments_.MergeFrom(from.arguments_);
   locals_.MergeFrom(from.locals_);
   if (from.method_name().size() > 0) {
-
-    method_name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.method_name_);
+    set_method_name(from.method_name());
   }
   if (from.has_location()) {
     mutable_location()->::google::cloud::diagnostics::debug::SourceLocation::MergeFrom(from.location());
@@ -1770,6 +2383,21 @@ bool StackFrame::IsInitialized() const {
 
 void StackFrame::Swap(StackFrame* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    StackFrame* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void StackFrame::UnsafeArenaSwap(StackFrame* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void StackFrame::InternalSwap(StackFrame* other) {
@@ -1790,46 +2418,54 @@ void StackFrame::InternalSwap(StackFrame* other) {
 
 // string method_name = 1;
 void StackFrame::clear_method_name() {
-  method_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  method_name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& StackFrame::method_name() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.StackFrame.method_name)
-  return method_name_.GetNoArena();
+  return method_name_.Get();
 }
 void StackFrame::set_method_name(const ::std::string& value) {
   
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  method_name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.StackFrame.method_name)
 }
 #if LANG_CXX11
 void StackFrame::set_method_name(::std::string&& value) {
   
-  method_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  method_name_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.StackFrame.method_name)
 }
 #endif
 void StackFrame::set_method_name(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  method_name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.StackFrame.method_name)
 }
 void StackFrame::set_method_name(const char* value, size_t size) {
   
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  method_name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.StackFrame.method_name)
 }
 ::std::string* StackFrame::mutable_method_name() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.StackFrame.method_name)
-  return method_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return method_name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* StackFrame::release_method_name() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.StackFrame.method_name)
   
-  return method_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return method_name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* StackFrame::unsafe_arena_release_method_name() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.StackFrame.method_name)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return method_name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void StackFrame::set_allocated_method_name(::std::string* method_name) {
   if (method_name != NULL) {
@@ -1837,9 +2473,22 @@ void StackFrame::set_allocated_method_name(::std::string* method_name) {
   } else {
     
   }
-  method_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), method_name);
+  method_name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), method_name,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.StackFrame.method_name)
 }
+void StackFrame::unsafe_arena_set_allocated_method_name(
+    ::std::string* method_name) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (method_name != NULL) {
+    
+  } else {
+    
+  }
+  method_name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      method_name, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.StackFrame.method_name)
+}
 
 // .google.cloud.diagnostics.debug.SourceLocation location = 2;
 bool StackFrame::has_location() const {
@@ -1857,7 +2506,7 @@ const ::google::cloud::diagnostics::debug::SourceLocation& StackFrame::location(
 ::google::cloud::diagnostics::debug::SourceLocation* StackFrame::mutable_location() {
   
   if (location_ == NULL) {
-    location_ = new ::google::cloud::diagnostics::debug::SourceLocation;
+    _slow_mutable_location();
   }
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.StackFrame.location)
   return location_;
@@ -1865,12 +2514,22 @@ const ::google::cloud::diagnostics::debug::SourceLocation& StackFrame::location(
 ::google::cloud::diagnostics::debug::SourceLocation* StackFrame::release_location() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.StackFrame.location)
   
-  ::google::cloud::diagnostics::debug::SourceLocation* temp = location_;
-  location_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_location();
+  } else {
+    ::google::cloud::diagnostics::debug::SourceLocation* temp = location_;
+    location_ = NULL;
+    return temp;
+  }
 }
 void StackFrame::set_allocated_location(::google::cloud::diagnostics::debug::SourceLocation* location) {
-  delete location_;
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete location_;
+  }
+  if (location != NULL) {
+    _slow_set_allocated_location(message_arena, &location);
+  }
   location_ = location;
   if (location) {
     
@@ -1957,6 +2616,14 @@ SourceLocation::SourceLocation()
   SharedCtor();
   // @@protoc_insertion_point(constructor:google.cloud.diagnostics.debug.SourceLocation)
 }
+SourceLocation::SourceLocation(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+  protobuf_breakpoint_2eproto::InitDefaults();
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:google.cloud.diagnostics.debug.SourceLocation)
+}
 SourceLocation::SourceLocation(const SourceLocation& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -1964,7 +2631,8 @@ SourceLocation::SourceLocation(const SourceLocation& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   path_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.path().size() > 0) {
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+    path_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path(),
+      GetArenaNoVirtual());
   }
   line_ = from.line_;
   // @@protoc_insertion_point(copy_constructor:google.cloud.diagnostics.debug.SourceLocation)
@@ -1982,7 +2650,19 @@ SourceLocation::~SourceLocation() {
 }
 
 void SourceLocation::SharedDtor() {
-  path_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  path_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+}
+
+void SourceLocation::ArenaDtor(void* object) {
+  SourceLocation* _this = reinterpret_cast< SourceLocation* >(object);
+  (void)_this;
+}
+void SourceLocation::RegisterArenaDtor(::google::protobuf::Arena* arena) {
 }
 
 void SourceLocation::SetCachedSize(int size) const {
@@ -2001,16 +2681,12 @@ const SourceLocation& SourceLocation::default_instance() {
 }
 
 SourceLocation* SourceLocation::New(::google::protobuf::Arena* arena) const {
-  SourceLocation* n = new SourceLocation;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<SourceLocation>(arena);
 }
 
 void SourceLocation::Clear() {
 // @@protoc_insertion_point(message_clear_start:google.cloud.diagnostics.debug.SourceLocation)
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  path_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   line_ = 0;
 }
 
@@ -2173,8 +2849,7 @@ void SourceLocation::MergeFrom(const SourceLocation& from) {
   (void) cached_has_bits;
 
   if (from.path().size() > 0) {
-
-    path_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.path_);
+    set_path(from.path());
   }
   if (from.line() != 0) {
     set_line(from.line());
@@ -2201,6 +2876,21 @@ bool SourceLocation::IsInitialized() const {
 
 void SourceLocation::Swap(SourceLocation* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    SourceLocation* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void SourceLocation::UnsafeArenaSwap(SourceLocation* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void SourceLocation::InternalSwap(SourceLocation* other) {
@@ -2219,46 +2909,54 @@ void SourceLocation::InternalSwap(SourceLocation* other) {
 
 // string path = 1;
 void SourceLocation::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  path_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& SourceLocation::path() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.SourceLocation.path)
-  return path_.GetNoArena();
+  return path_.Get();
 }
 void SourceLocation::set_path(const ::std::string& value) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  path_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.SourceLocation.path)
 }
 #if LANG_CXX11
 void SourceLocation::set_path(::std::string&& value) {
   
-  path_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  path_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.SourceLocation.path)
 }
 #endif
 void SourceLocation::set_path(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  path_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.SourceLocation.path)
 }
 void SourceLocation::set_path(const char* value, size_t size) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  path_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.SourceLocation.path)
 }
 ::std::string* SourceLocation::mutable_path() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.SourceLocation.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return path_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* SourceLocation::release_path() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.SourceLocation.path)
   
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return path_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* SourceLocation::unsafe_arena_release_path() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.SourceLocation.path)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return path_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void SourceLocation::set_allocated_path(::std::string* path) {
   if (path != NULL) {
@@ -2266,9 +2964,22 @@ void SourceLocation::set_allocated_path(::std::string* path) {
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
+  path_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.SourceLocation.path)
 }
+void SourceLocation::unsafe_arena_set_allocated_path(
+    ::std::string* path) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (path != NULL) {
+    
+  } else {
+    
+  }
+  path_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      path, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.SourceLocation.path)
+}
 
 // int32 line = 2;
 void SourceLocation::clear_line() {
@@ -2288,6 +2999,53 @@ void SourceLocation::set_line(::google::protobuf::int32 value) {
 
 // ===================================================================
 
+void Variable::_slow_mutable_status() {
+  status_ = ::google::protobuf::Arena::CreateMessage< ::google::cloud::diagnostics::debug::Status >(
+      GetArenaNoVirtual());
+}
+::google::cloud::diagnostics::debug::Status* Variable::_slow_release_status() {
+  if (status_ == NULL) {
+    return NULL;
+  } else {
+    ::google::cloud::diagnostics::debug::Status* temp = new ::google::cloud::diagnostics::debug::Status(*status_);
+    status_ = NULL;
+    return temp;
+  }
+}
+::google::cloud::diagnostics::debug::Status* Variable::unsafe_arena_release_status() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Variable.status)
+  
+  ::google::cloud::diagnostics::debug::Status* temp = status_;
+  status_ = NULL;
+  return temp;
+}
+void Variable::_slow_set_allocated_status(
+    ::google::protobuf::Arena* message_arena, ::google::cloud::diagnostics::debug::Status** status) {
+    if (message_arena != NULL && 
+        ::google::protobuf::Arena::GetArena(*status) == NULL) {
+      message_arena->Own(*status);
+    } else if (message_arena !=
+               ::google::protobuf::Arena::GetArena(*status)) {
+      ::google::cloud::diagnostics::debug::Status* new_status = 
+            ::google::protobuf::Arena::CreateMessage< ::google::cloud::diagnostics::debug::Status >(
+            message_arena);
+      new_status->CopyFrom(**status);
+      *status = new_status;
+    }
+}
+void Variable::unsafe_arena_set_allocated_status(
+    ::google::cloud::diagnostics::debug::Status* status) {
+  if (GetArenaNoVirtual() == NULL) {
+    delete status_;
+  }
+  status_ = status;
+  if (status) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Variable.status)
+}
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
 const int Variable::kNameFieldNumber;
 const int Variable::kTypeFieldNumber;
@@ -2304,6 +3062,15 @@ Variable::Variable()
   SharedCtor();
   // @@protoc_insertion_point(constructor:google.cloud.diagnostics.debug.Variable)
 }
+Variable::Variable(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena),
+  members_(arena) {
+  protobuf_breakpoint_2eproto::InitDefaults();
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:google.cloud.diagnostics.debug.Variable)
+}
 Variable::Variable(const Variable& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -2312,15 +3079,18 @@ Variable::Variable(const Variable& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   name_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.name().size() > 0) {
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name(),
+      GetArenaNoVirtual());
   }
   type_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.type().size() > 0) {
-    type_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.type_);
+    type_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.type(),
+      GetArenaNoVirtual());
   }
   value_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.value().size() > 0) {
-    value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.value_);
+    value_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.value(),
+      GetArenaNoVirtual());
   }
   if (from.has_status()) {
     status_ = new ::google::cloud::diagnostics::debug::Status(*from.status_);
@@ -2344,14 +3114,26 @@ Variable::~Variable() {
 }
 
 void Variable::SharedDtor() {
-  name_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  type_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  value_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  name_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  type_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+  value_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
   if (this != internal_default_instance()) {
     delete status_;
   }
 }
 
+void Variable::ArenaDtor(void* object) {
+  Variable* _this = reinterpret_cast< Variable* >(object);
+  (void)_this;
+}
+void Variable::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
+
 void Variable::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
@@ -2368,19 +3150,15 @@ const Variable& Variable::default_instance() {
 }
 
 Variable* Variable::New(::google::protobuf::Arena* arena) const {
-  Variable* n = new Variable;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<Variable>(arena);
 }
 
 void Variable::Clear() {
 // @@protoc_insertion_point(message_clear_start:google.cloud.diagnostics.debug.Variable)
   members_.Clear();
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  type_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  type_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+  value_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   if (GetArenaNoVirtual() == NULL && status_ != NULL) {
     delete status_;
   }
@@ -2672,16 +3450,13 @@ void Variable::MergeFrom(const Variable& from) {
 
   members_.MergeFrom(from.members_);
   if (from.name().size() > 0) {
-
-    name_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.name_);
+    set_name(from.name());
   }
   if (from.type().size() > 0) {
-
-    type_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.type_);
+    set_type(from.type());
   }
   if (from.value().size() > 0) {
-
-    value_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.value_);
+    set_value(from.value());
   }
   if (from.has_status()) {
     mutable_status()->::google::cloud::diagnostics::debug::Status::MergeFrom(from.status());
@@ -2708,6 +3483,21 @@ bool Variable::IsInitialized() const {
 
 void Variable::Swap(Variable* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    Variable* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void Variable::UnsafeArenaSwap(Variable* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void Variable::InternalSwap(Variable* other) {
@@ -2729,46 +3519,54 @@ void Variable::InternalSwap(Variable* other) {
 
 // string name = 1;
 void Variable::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& Variable::name() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Variable.name)
-  return name_.GetNoArena();
+  return name_.Get();
 }
 void Variable::set_name(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Variable.name)
 }
 #if LANG_CXX11
 void Variable::set_name(::std::string&& value) {
   
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  name_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.Variable.name)
 }
 #endif
 void Variable::set_name(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Variable.name)
 }
 void Variable::set_name(const char* value, size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Variable.name)
 }
 ::std::string* Variable::mutable_name() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Variable.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* Variable::release_name() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Variable.name)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* Variable::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Variable.name)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void Variable::set_allocated_name(::std::string* name) {
   if (name != NULL) {
@@ -2776,52 +3574,73 @@ void Variable::set_allocated_name(::std::string* name) {
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.Variable.name)
 }
+void Variable::unsafe_arena_set_allocated_name(
+    ::std::string* name) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      name, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Variable.name)
+}
 
 // string type = 2;
 void Variable::clear_type() {
-  type_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  type_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& Variable::type() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Variable.type)
-  return type_.GetNoArena();
+  return type_.Get();
 }
 void Variable::set_type(const ::std::string& value) {
   
-  type_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  type_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Variable.type)
 }
 #if LANG_CXX11
 void Variable::set_type(::std::string&& value) {
   
-  type_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  type_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.Variable.type)
 }
 #endif
 void Variable::set_type(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  type_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  type_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Variable.type)
 }
 void Variable::set_type(const char* value, size_t size) {
   
-  type_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  type_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Variable.type)
 }
 ::std::string* Variable::mutable_type() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Variable.type)
-  return type_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return type_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* Variable::release_type() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Variable.type)
   
-  return type_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return type_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* Variable::unsafe_arena_release_type() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Variable.type)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return type_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void Variable::set_allocated_type(::std::string* type) {
   if (type != NULL) {
@@ -2829,52 +3648,73 @@ void Variable::set_allocated_type(::std::string* type) {
   } else {
     
   }
-  type_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), type);
+  type_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), type,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.Variable.type)
 }
+void Variable::unsafe_arena_set_allocated_type(
+    ::std::string* type) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (type != NULL) {
+    
+  } else {
+    
+  }
+  type_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      type, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Variable.type)
+}
 
 // string value = 3;
 void Variable::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  value_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& Variable::value() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Variable.value)
-  return value_.GetNoArena();
+  return value_.Get();
 }
 void Variable::set_value(const ::std::string& value) {
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  value_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Variable.value)
 }
 #if LANG_CXX11
 void Variable::set_value(::std::string&& value) {
   
-  value_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  value_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.Variable.value)
 }
 #endif
 void Variable::set_value(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  value_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Variable.value)
 }
 void Variable::set_value(const char* value, size_t size) {
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  value_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Variable.value)
 }
 ::std::string* Variable::mutable_value() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Variable.value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return value_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* Variable::release_value() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Variable.value)
   
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return value_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* Variable::unsafe_arena_release_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Variable.value)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return value_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void Variable::set_allocated_value(::std::string* value) {
   if (value != NULL) {
@@ -2882,9 +3722,22 @@ void Variable::set_allocated_value(::std::string* value) {
   } else {
     
   }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  value_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.Variable.value)
 }
+void Variable::unsafe_arena_set_allocated_value(
+    ::std::string* value) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (value != NULL) {
+    
+  } else {
+    
+  }
+  value_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Variable.value)
+}
 
 // repeated .google.cloud.diagnostics.debug.Variable members = 4;
 int Variable::members_size() const {
@@ -2932,7 +3785,7 @@ const ::google::cloud::diagnostics::debug::Status& Variable::status() const {
 ::google::cloud::diagnostics::debug::Status* Variable::mutable_status() {
   
   if (status_ == NULL) {
-    status_ = new ::google::cloud::diagnostics::debug::Status;
+    _slow_mutable_status();
   }
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Variable.status)
   return status_;
@@ -2940,12 +3793,22 @@ const ::google::cloud::diagnostics::debug::Status& Variable::status() const {
 ::google::cloud::diagnostics::debug::Status* Variable::release_status() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Variable.status)
   
-  ::google::cloud::diagnostics::debug::Status* temp = status_;
-  status_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_status();
+  } else {
+    ::google::cloud::diagnostics::debug::Status* temp = status_;
+    status_ = NULL;
+    return temp;
+  }
 }
 void Variable::set_allocated_status(::google::cloud::diagnostics::debug::Status* status) {
-  delete status_;
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete status_;
+  }
+  if (status != NULL) {
+    _slow_set_allocated_status(message_arena, &status);
+  }
   status_ = status;
   if (status) {
     
@@ -2972,6 +3835,14 @@ Status::Status()
   SharedCtor();
   // @@protoc_insertion_point(constructor:google.cloud.diagnostics.debug.Status)
 }
+Status::Status(::google::protobuf::Arena* arena)
+  : ::google::protobuf::Message(),
+  _internal_metadata_(arena) {
+  protobuf_breakpoint_2eproto::InitDefaults();
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:google.cloud.diagnostics.debug.Status)
+}
 Status::Status(const Status& from)
   : ::google::protobuf::Message(),
       _internal_metadata_(NULL),
@@ -2979,7 +3850,8 @@ Status::Status(const Status& from)
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   if (from.message().size() > 0) {
-    message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.message_);
+    message_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.message(),
+      GetArenaNoVirtual());
   }
   iserror_ = from.iserror_;
   // @@protoc_insertion_point(copy_constructor:google.cloud.diagnostics.debug.Status)
@@ -2997,7 +3869,19 @@ Status::~Status() {
 }
 
 void Status::SharedDtor() {
-  message_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  message_.Destroy(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), arena);
+}
+
+void Status::ArenaDtor(void* object) {
+  Status* _this = reinterpret_cast< Status* >(object);
+  (void)_this;
+}
+void Status::RegisterArenaDtor(::google::protobuf::Arena* arena) {
 }
 
 void Status::SetCachedSize(int size) const {
@@ -3016,16 +3900,12 @@ const Status& Status::default_instance() {
 }
 
 Status* Status::New(::google::protobuf::Arena* arena) const {
-  Status* n = new Status;
-  if (arena != NULL) {
-    arena->Own(n);
-  }
-  return n;
+  return ::google::protobuf::Arena::CreateMessage<Status>(arena);
 }
 
 void Status::Clear() {
 // @@protoc_insertion_point(message_clear_start:google.cloud.diagnostics.debug.Status)
-  message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  message_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
   iserror_ = false;
 }
 
@@ -3186,8 +4066,7 @@ void Status::MergeFrom(const Status& from) {
   (void) cached_has_bits;
 
   if (from.message().size() > 0) {
-
-    message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.message_);
+    set_message(from.message());
   }
   if (from.iserror() != 0) {
     set_iserror(from.iserror());
@@ -3214,6 +4093,21 @@ bool Status::IsInitialized() const {
 
 void Status::Swap(Status* other) {
   if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    Status* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void Status::UnsafeArenaSwap(Status* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
   InternalSwap(other);
 }
 void Status::InternalSwap(Status* other) {
@@ -3246,46 +4140,54 @@ void Status::set_iserror(bool value) {
 
 // string message = 2;
 void Status::clear_message() {
-  message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  message_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 const ::std::string& Status::message() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Status.message)
-  return message_.GetNoArena();
+  return message_.Get();
 }
 void Status::set_message(const ::std::string& value) {
   
-  message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  message_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Status.message)
 }
 #if LANG_CXX11
 void Status::set_message(::std::string&& value) {
   
-  message_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  message_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.Status.message)
 }
 #endif
 void Status::set_message(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  message_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Status.message)
 }
 void Status::set_message(const char* value, size_t size) {
   
-  message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  message_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Status.message)
 }
 ::std::string* Status::mutable_message() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Status.message)
-  return message_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return message_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 ::std::string* Status::release_message() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Status.message)
   
-  return message_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return message_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+::std::string* Status::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Status.message)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return message_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 void Status::set_allocated_message(::std::string* message) {
   if (message != NULL) {
@@ -3293,9 +4195,22 @@ void Status::set_allocated_message(::std::string* message) {
   } else {
     
   }
-  message_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), message);
+  message_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), message,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.Status.message)
 }
+void Status::unsafe_arena_set_allocated_message(
+    ::std::string* message) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (message != NULL) {
+    
+  } else {
+    
+  }
+  message_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      message, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Status.message)
+}
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
@@ -92,6 +92,12 @@ class Breakpoint : public ::google::protobuf::Message /* @@protoc_insertion_poin
     CopyFrom(from);
     return *this;
   }
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
 
   static const ::google::protobuf::Descriptor* descriptor();
   static const Breakpoint& default_instance();
@@ -103,6 +109,7 @@ class Breakpoint : public ::google::protobuf::Message /* @@protoc_insertion_poin
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     0;
 
+  void UnsafeArenaSwap(Breakpoint* other);
   void Swap(Breakpoint* other);
 
   // implements Message ----------------------------------------------
@@ -130,12 +137,17 @@ class Breakpoint : public ::google::protobuf::Message /* @@protoc_insertion_poin
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(Breakpoint* other);
+  protected:
+  explicit Breakpoint(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -179,6 +191,28 @@ class Breakpoint : public ::google::protobuf::Message /* @@protoc_insertion_poin
   const ::google::protobuf::RepeatedPtrField< ::std::string>& expressions() const;
   ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_expressions();
 
+  // repeated string log_messages = 14;
+  int log_messages_size() const;
+  void clear_log_messages();
+  static const int kLogMessagesFieldNumber = 14;
+  const ::std::string& log_messages(int index) const;
+  ::std::string* mutable_log_messages(int index);
+  void set_log_messages(int index, const ::std::string& value);
+  #if LANG_CXX11
+  void set_log_messages(int index, ::std::string&& value);
+  #endif
+  void set_log_messages(int index, const char* value);
+  void set_log_messages(int index, const char* value, size_t size);
+  ::std::string* add_log_messages();
+  void add_log_messages(const ::std::string& value);
+  #if LANG_CXX11
+  void add_log_messages(::std::string&& value);
+  #endif
+  void add_log_messages(const char* value);
+  void add_log_messages(const char* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& log_messages() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_log_messages();
+
   // repeated .google.cloud.diagnostics.debug.Variable evaluated_expressions = 10;
   int evaluated_expressions_size() const;
   void clear_evaluated_expressions();
@@ -204,6 +238,9 @@ class Breakpoint : public ::google::protobuf::Message /* @@protoc_insertion_poin
   ::std::string* mutable_id();
   ::std::string* release_id();
   void set_allocated_id(::std::string* id);
+  ::std::string* unsafe_arena_release_id();
+  void unsafe_arena_set_allocated_id(
+      ::std::string* id);
 
   // string condition = 9;
   void clear_condition();
@@ -218,42 +255,98 @@ class Breakpoint : public ::google::protobuf::Message /* @@protoc_insertion_poin
   ::std::string* mutable_condition();
   ::std::string* release_condition();
   void set_allocated_condition(::std::string* condition);
+  ::std::string* unsafe_arena_release_condition();
+  void unsafe_arena_set_allocated_condition(
+      ::std::string* condition);
+
+  // string log_message_format = 13;
+  void clear_log_message_format();
+  static const int kLogMessageFormatFieldNumber = 13;
+  const ::std::string& log_message_format() const;
+  void set_log_message_format(const ::std::string& value);
+  #if LANG_CXX11
+  void set_log_message_format(::std::string&& value);
+  #endif
+  void set_log_message_format(const char* value);
+  void set_log_message_format(const char* value, size_t size);
+  ::std::string* mutable_log_message_format();
+  ::std::string* release_log_message_format();
+  void set_allocated_log_message_format(::std::string* log_message_format);
+  ::std::string* unsafe_arena_release_log_message_format();
+  void unsafe_arena_set_allocated_log_message_format(
+      ::std::string* log_message_format);
 
   // .google.cloud.diagnostics.debug.SourceLocation location = 2;
   bool has_location() const;
   void clear_location();
   static const int kLocationFieldNumber = 2;
+  private:
+  void _slow_mutable_location();
+  void _slow_set_allocated_location(
+      ::google::protobuf::Arena* message_arena, ::google::cloud::diagnostics::debug::SourceLocation** location);
+  ::google::cloud::diagnostics::debug::SourceLocation* _slow_release_location();
+  public:
   const ::google::cloud::diagnostics::debug::SourceLocation& location() const;
   ::google::cloud::diagnostics::debug::SourceLocation* mutable_location();
   ::google::cloud::diagnostics::debug::SourceLocation* release_location();
   void set_allocated_location(::google::cloud::diagnostics::debug::SourceLocation* location);
+  ::google::cloud::diagnostics::debug::SourceLocation* unsafe_arena_release_location();
+  void unsafe_arena_set_allocated_location(
+      ::google::cloud::diagnostics::debug::SourceLocation* location);
 
   // .google.protobuf.Timestamp create_time = 5;
   bool has_create_time() const;
   void clear_create_time();
   static const int kCreateTimeFieldNumber = 5;
+  private:
+  void _slow_mutable_create_time();
+  void _slow_set_allocated_create_time(
+      ::google::protobuf::Arena* message_arena, ::google::protobuf::Timestamp** create_time);
+  ::google::protobuf::Timestamp* _slow_release_create_time();
+  public:
   const ::google::protobuf::Timestamp& create_time() const;
   ::google::protobuf::Timestamp* mutable_create_time();
   ::google::protobuf::Timestamp* release_create_time();
   void set_allocated_create_time(::google::protobuf::Timestamp* create_time);
+  ::google::protobuf::Timestamp* unsafe_arena_release_create_time();
+  void unsafe_arena_set_allocated_create_time(
+      ::google::protobuf::Timestamp* create_time);
 
   // .google.protobuf.Timestamp final_time = 6;
   bool has_final_time() const;
   void clear_final_time();
   static const int kFinalTimeFieldNumber = 6;
+  private:
+  void _slow_mutable_final_time();
+  void _slow_set_allocated_final_time(
+      ::google::protobuf::Arena* message_arena, ::google::protobuf::Timestamp** final_time);
+  ::google::protobuf::Timestamp* _slow_release_final_time();
+  public:
   const ::google::protobuf::Timestamp& final_time() const;
   ::google::protobuf::Timestamp* mutable_final_time();
   ::google::protobuf::Timestamp* release_final_time();
   void set_allocated_final_time(::google::protobuf::Timestamp* final_time);
+  ::google::protobuf::Timestamp* unsafe_arena_release_final_time();
+  void unsafe_arena_set_allocated_final_time(
+      ::google::protobuf::Timestamp* final_time);
 
   // .google.cloud.diagnostics.debug.Status status = 11;
   bool has_status() const;
   void clear_status();
   static const int kStatusFieldNumber = 11;
+  private:
+  void _slow_mutable_status();
+  void _slow_set_allocated_status(
+      ::google::protobuf::Arena* message_arena, ::google::cloud::diagnostics::debug::Status** status);
+  ::google::cloud::diagnostics::debug::Status* _slow_release_status();
+  public:
   const ::google::cloud::diagnostics::debug::Status& status() const;
   ::google::cloud::diagnostics::debug::Status* mutable_status();
   ::google::cloud::diagnostics::debug::Status* release_status();
   void set_allocated_status(::google::cloud::diagnostics::debug::Status* status);
+  ::google::cloud::diagnostics::debug::Status* unsafe_arena_release_status();
+  void unsafe_arena_set_allocated_status(
+      ::google::cloud::diagnostics::debug::Status* status);
 
   // bool activated = 4;
   void clear_activated();
@@ -277,11 +370,16 @@ class Breakpoint : public ::google::protobuf::Message /* @@protoc_insertion_poin
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::RepeatedPtrField< ::google::cloud::diagnostics::debug::StackFrame > stack_frames_;
   ::google::protobuf::RepeatedPtrField< ::std::string> expressions_;
   ::google::protobuf::RepeatedPtrField< ::google::cloud::diagnostics::debug::Variable > evaluated_expressions_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> log_messages_;
   ::google::protobuf::internal::ArenaStringPtr id_;
   ::google::protobuf::internal::ArenaStringPtr condition_;
+  ::google::protobuf::internal::ArenaStringPtr log_message_format_;
   ::google::cloud::diagnostics::debug::SourceLocation* location_;
   ::google::protobuf::Timestamp* create_time_;
   ::google::protobuf::Timestamp* final_time_;
@@ -305,6 +403,12 @@ class StackFrame : public ::google::protobuf::Message /* @@protoc_insertion_poin
     CopyFrom(from);
     return *this;
   }
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
 
   static const ::google::protobuf::Descriptor* descriptor();
   static const StackFrame& default_instance();
@@ -316,6 +420,7 @@ class StackFrame : public ::google::protobuf::Message /* @@protoc_insertion_poin
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     1;
 
+  void UnsafeArenaSwap(StackFrame* other);
   void Swap(StackFrame* other);
 
   // implements Message ----------------------------------------------
@@ -343,12 +448,17 @@ class StackFrame : public ::google::protobuf::Message /* @@protoc_insertion_poin
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(StackFrame* other);
+  protected:
+  explicit StackFrame(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -395,20 +505,35 @@ class StackFrame : public ::google::protobuf::Message /* @@protoc_insertion_poin
   ::std::string* mutable_method_name();
   ::std::string* release_method_name();
   void set_allocated_method_name(::std::string* method_name);
+  ::std::string* unsafe_arena_release_method_name();
+  void unsafe_arena_set_allocated_method_name(
+      ::std::string* method_name);
 
   // .google.cloud.diagnostics.debug.SourceLocation location = 2;
   bool has_location() const;
   void clear_location();
   static const int kLocationFieldNumber = 2;
+  private:
+  void _slow_mutable_location();
+  void _slow_set_allocated_location(
+      ::google::protobuf::Arena* message_arena, ::google::cloud::diagnostics::debug::SourceLocation** location);
+  ::google::cloud::diagnostics::debug::SourceLocation* _slow_release_location();
+  public:
   const ::google::cloud::diagnostics::debug::SourceLocation& location() const;
   ::google::cloud::diagnostics::debug::SourceLocation* mutable_location();
   ::google::cloud::diagnostics::debug::SourceLocation* release_location();
   void set_allocated_location(::google::cloud::diagnostics::debug::SourceLocation* location);
+  ::google::cloud::diagnostics::debug::SourceLocation* unsafe_arena_release_location();
+  void unsafe_arena_set_allocated_location(
+      ::google::cloud::diagnostics::debug::SourceLocation* location);
 
   // @@protoc_insertion_point(class_scope:google.cloud.diagnostics.debug.StackFrame)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::RepeatedPtrField< ::google::cloud::diagnostics::debug::Variable > arguments_;
   ::google::protobuf::RepeatedPtrField< ::google::cloud::diagnostics::debug::Variable > locals_;
   ::google::protobuf::internal::ArenaStringPtr method_name_;
@@ -429,6 +554,12 @@ class SourceLocation : public ::google::protobuf::Message /* @@protoc_insertion_
     CopyFrom(from);
     return *this;
   }
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
 
   static const ::google::protobuf::Descriptor* descriptor();
   static const SourceLocation& default_instance();
@@ -440,6 +571,7 @@ class SourceLocation : public ::google::protobuf::Message /* @@protoc_insertion_
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     2;
 
+  void UnsafeArenaSwap(SourceLocation* other);
   void Swap(SourceLocation* other);
 
   // implements Message ----------------------------------------------
@@ -467,12 +599,17 @@ class SourceLocation : public ::google::protobuf::Message /* @@protoc_insertion_
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(SourceLocation* other);
+  protected:
+  explicit SourceLocation(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -495,6 +632,9 @@ class SourceLocation : public ::google::protobuf::Message /* @@protoc_insertion_
   ::std::string* mutable_path();
   ::std::string* release_path();
   void set_allocated_path(::std::string* path);
+  ::std::string* unsafe_arena_release_path();
+  void unsafe_arena_set_allocated_path(
+      ::std::string* path);
 
   // int32 line = 2;
   void clear_line();
@@ -506,6 +646,9 @@ class SourceLocation : public ::google::protobuf::Message /* @@protoc_insertion_
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr path_;
   ::google::protobuf::int32 line_;
   mutable int _cached_size_;
@@ -524,6 +667,12 @@ class Variable : public ::google::protobuf::Message /* @@protoc_insertion_point(
     CopyFrom(from);
     return *this;
   }
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
 
   static const ::google::protobuf::Descriptor* descriptor();
   static const Variable& default_instance();
@@ -535,6 +684,7 @@ class Variable : public ::google::protobuf::Message /* @@protoc_insertion_point(
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     3;
 
+  void UnsafeArenaSwap(Variable* other);
   void Swap(Variable* other);
 
   // implements Message ----------------------------------------------
@@ -562,12 +712,17 @@ class Variable : public ::google::protobuf::Message /* @@protoc_insertion_point(
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(Variable* other);
+  protected:
+  explicit Variable(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -602,6 +757,9 @@ class Variable : public ::google::protobuf::Message /* @@protoc_insertion_point(
   ::std::string* mutable_name();
   ::std::string* release_name();
   void set_allocated_name(::std::string* name);
+  ::std::string* unsafe_arena_release_name();
+  void unsafe_arena_set_allocated_name(
+      ::std::string* name);
 
   // string type = 2;
   void clear_type();
@@ -616,6 +774,9 @@ class Variable : public ::google::protobuf::Message /* @@protoc_insertion_point(
   ::std::string* mutable_type();
   ::std::string* release_type();
   void set_allocated_type(::std::string* type);
+  ::std::string* unsafe_arena_release_type();
+  void unsafe_arena_set_allocated_type(
+      ::std::string* type);
 
   // string value = 3;
   void clear_value();
@@ -630,20 +791,35 @@ class Variable : public ::google::protobuf::Message /* @@protoc_insertion_point(
   ::std::string* mutable_value();
   ::std::string* release_value();
   void set_allocated_value(::std::string* value);
+  ::std::string* unsafe_arena_release_value();
+  void unsafe_arena_set_allocated_value(
+      ::std::string* value);
 
   // .google.cloud.diagnostics.debug.Status status = 5;
   bool has_status() const;
   void clear_status();
   static const int kStatusFieldNumber = 5;
+  private:
+  void _slow_mutable_status();
+  void _slow_set_allocated_status(
+      ::google::protobuf::Arena* message_arena, ::google::cloud::diagnostics::debug::Status** status);
+  ::google::cloud::diagnostics::debug::Status* _slow_release_status();
+  public:
   const ::google::cloud::diagnostics::debug::Status& status() const;
   ::google::cloud::diagnostics::debug::Status* mutable_status();
   ::google::cloud::diagnostics::debug::Status* release_status();
   void set_allocated_status(::google::cloud::diagnostics::debug::Status* status);
+  ::google::cloud::diagnostics::debug::Status* unsafe_arena_release_status();
+  void unsafe_arena_set_allocated_status(
+      ::google::cloud::diagnostics::debug::Status* status);
 
   // @@protoc_insertion_point(class_scope:google.cloud.diagnostics.debug.Variable)
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::RepeatedPtrField< ::google::cloud::diagnostics::debug::Variable > members_;
   ::google::protobuf::internal::ArenaStringPtr name_;
   ::google::protobuf::internal::ArenaStringPtr type_;
@@ -665,6 +841,12 @@ class Status : public ::google::protobuf::Message /* @@protoc_insertion_point(cl
     CopyFrom(from);
     return *this;
   }
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
 
   static const ::google::protobuf::Descriptor* descriptor();
   static const Status& default_instance();
@@ -676,6 +858,7 @@ class Status : public ::google::protobuf::Message /* @@protoc_insertion_point(cl
   static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
     4;
 
+  void UnsafeArenaSwap(Status* other);
   void Swap(Status* other);
 
   // implements Message ----------------------------------------------
@@ -703,12 +886,17 @@ class Status : public ::google::protobuf::Message /* @@protoc_insertion_point(cl
   void SharedDtor();
   void SetCachedSize(int size) const PROTOBUF_FINAL;
   void InternalSwap(Status* other);
+  protected:
+  explicit Status(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
   private:
   inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
+    return _internal_metadata_.arena();
   }
   inline void* MaybeArenaPtr() const {
-    return NULL;
+    return _internal_metadata_.raw_arena_ptr();
   }
   public:
 
@@ -731,6 +919,9 @@ class Status : public ::google::protobuf::Message /* @@protoc_insertion_point(cl
   ::std::string* mutable_message();
   ::std::string* release_message();
   void set_allocated_message(::std::string* message);
+  ::std::string* unsafe_arena_release_message();
+  void unsafe_arena_set_allocated_message(
+      ::std::string* message);
 
   // bool iserror = 1;
   void clear_iserror();
@@ -742,6 +933,9 @@ class Status : public ::google::protobuf::Message /* @@protoc_insertion_point(cl
  private:
 
   ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
   ::google::protobuf::internal::ArenaStringPtr message_;
   bool iserror_;
   mutable int _cached_size_;
@@ -757,46 +951,54 @@ class Status : public ::google::protobuf::Message /* @@protoc_insertion_point(cl
 
 // string id = 1;
 inline void Breakpoint::clear_id() {
-  id_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  id_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& Breakpoint::id() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Breakpoint.id)
-  return id_.GetNoArena();
+  return id_.Get();
 }
 inline void Breakpoint::set_id(const ::std::string& value) {
   
-  id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  id_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Breakpoint.id)
 }
 #if LANG_CXX11
 inline void Breakpoint::set_id(::std::string&& value) {
   
-  id_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  id_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.Breakpoint.id)
 }
 #endif
 inline void Breakpoint::set_id(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  id_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Breakpoint.id)
 }
 inline void Breakpoint::set_id(const char* value, size_t size) {
   
-  id_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  id_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Breakpoint.id)
 }
 inline ::std::string* Breakpoint::mutable_id() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.id)
-  return id_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return id_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* Breakpoint::release_id() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Breakpoint.id)
   
-  return id_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return id_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* Breakpoint::unsafe_arena_release_id() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Breakpoint.id)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return id_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void Breakpoint::set_allocated_id(::std::string* id) {
   if (id != NULL) {
@@ -804,9 +1006,22 @@ inline void Breakpoint::set_allocated_id(::std::string* id) {
   } else {
     
   }
-  id_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), id);
+  id_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), id,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.Breakpoint.id)
 }
+inline void Breakpoint::unsafe_arena_set_allocated_id(
+    ::std::string* id) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (id != NULL) {
+    
+  } else {
+    
+  }
+  id_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      id, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Breakpoint.id)
+}
 
 // .google.cloud.diagnostics.debug.SourceLocation location = 2;
 inline bool Breakpoint::has_location() const {
@@ -824,7 +1039,7 @@ inline const ::google::cloud::diagnostics::debug::SourceLocation& Breakpoint::lo
 inline ::google::cloud::diagnostics::debug::SourceLocation* Breakpoint::mutable_location() {
   
   if (location_ == NULL) {
-    location_ = new ::google::cloud::diagnostics::debug::SourceLocation;
+    _slow_mutable_location();
   }
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.location)
   return location_;
@@ -832,12 +1047,22 @@ inline ::google::cloud::diagnostics::debug::SourceLocation* Breakpoint::mutable_
 inline ::google::cloud::diagnostics::debug::SourceLocation* Breakpoint::release_location() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Breakpoint.location)
   
-  ::google::cloud::diagnostics::debug::SourceLocation* temp = location_;
-  location_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_location();
+  } else {
+    ::google::cloud::diagnostics::debug::SourceLocation* temp = location_;
+    location_ = NULL;
+    return temp;
+  }
 }
 inline void Breakpoint::set_allocated_location(::google::cloud::diagnostics::debug::SourceLocation* location) {
-  delete location_;
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete location_;
+  }
+  if (location != NULL) {
+    _slow_set_allocated_location(message_arena, &location);
+  }
   location_ = location;
   if (location) {
     
@@ -907,7 +1132,7 @@ inline const ::google::protobuf::Timestamp& Breakpoint::create_time() const {
 inline ::google::protobuf::Timestamp* Breakpoint::mutable_create_time() {
   
   if (create_time_ == NULL) {
-    create_time_ = new ::google::protobuf::Timestamp;
+    _slow_mutable_create_time();
   }
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.create_time)
   return create_time_;
@@ -915,16 +1140,21 @@ inline ::google::protobuf::Timestamp* Breakpoint::mutable_create_time() {
 inline ::google::protobuf::Timestamp* Breakpoint::release_create_time() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Breakpoint.create_time)
   
-  ::google::protobuf::Timestamp* temp = create_time_;
-  create_time_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_create_time();
+  } else {
+    ::google::protobuf::Timestamp* temp = create_time_;
+    create_time_ = NULL;
+    return temp;
+  }
 }
 inline void Breakpoint::set_allocated_create_time(::google::protobuf::Timestamp* create_time) {
-  delete create_time_;
-  if (create_time != NULL && create_time->GetArena() != NULL) {
-    ::google::protobuf::Timestamp* new_create_time = new ::google::protobuf::Timestamp;
-    new_create_time->CopyFrom(*create_time);
-    create_time = new_create_time;
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete create_time_;
+  }
+  if (create_time != NULL) {
+    _slow_set_allocated_create_time(message_arena, &create_time);
   }
   create_time_ = create_time;
   if (create_time) {
@@ -951,7 +1181,7 @@ inline const ::google::protobuf::Timestamp& Breakpoint::final_time() const {
 inline ::google::protobuf::Timestamp* Breakpoint::mutable_final_time() {
   
   if (final_time_ == NULL) {
-    final_time_ = new ::google::protobuf::Timestamp;
+    _slow_mutable_final_time();
   }
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.final_time)
   return final_time_;
@@ -959,16 +1189,21 @@ inline ::google::protobuf::Timestamp* Breakpoint::mutable_final_time() {
 inline ::google::protobuf::Timestamp* Breakpoint::release_final_time() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Breakpoint.final_time)
   
-  ::google::protobuf::Timestamp* temp = final_time_;
-  final_time_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_final_time();
+  } else {
+    ::google::protobuf::Timestamp* temp = final_time_;
+    final_time_ = NULL;
+    return temp;
+  }
 }
 inline void Breakpoint::set_allocated_final_time(::google::protobuf::Timestamp* final_time) {
-  delete final_time_;
-  if (final_time != NULL && final_time->GetArena() != NULL) {
-    ::google::protobuf::Timestamp* new_final_time = new ::google::protobuf::Timestamp;
-    new_final_time->CopyFrom(*final_time);
-    final_time = new_final_time;
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete final_time_;
+  }
+  if (final_time != NULL) {
+    _slow_set_allocated_final_time(message_arena, &final_time);
   }
   final_time_ = final_time;
   if (final_time) {
@@ -1064,46 +1299,54 @@ Breakpoint::mutable_expressions() {
 
 // string condition = 9;
 inline void Breakpoint::clear_condition() {
-  condition_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  condition_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& Breakpoint::condition() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Breakpoint.condition)
-  return condition_.GetNoArena();
+  return condition_.Get();
 }
 inline void Breakpoint::set_condition(const ::std::string& value) {
   
-  condition_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  condition_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Breakpoint.condition)
 }
 #if LANG_CXX11
 inline void Breakpoint::set_condition(::std::string&& value) {
   
-  condition_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  condition_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.Breakpoint.condition)
 }
 #endif
 inline void Breakpoint::set_condition(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  condition_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  condition_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Breakpoint.condition)
 }
 inline void Breakpoint::set_condition(const char* value, size_t size) {
   
-  condition_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  condition_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Breakpoint.condition)
 }
 inline ::std::string* Breakpoint::mutable_condition() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.condition)
-  return condition_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return condition_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* Breakpoint::release_condition() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Breakpoint.condition)
   
-  return condition_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return condition_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* Breakpoint::unsafe_arena_release_condition() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Breakpoint.condition)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return condition_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void Breakpoint::set_allocated_condition(::std::string* condition) {
   if (condition != NULL) {
@@ -1111,9 +1354,22 @@ inline void Breakpoint::set_allocated_condition(::std::string* condition) {
   } else {
     
   }
-  condition_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), condition);
+  condition_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), condition,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.Breakpoint.condition)
 }
+inline void Breakpoint::unsafe_arena_set_allocated_condition(
+    ::std::string* condition) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (condition != NULL) {
+    
+  } else {
+    
+  }
+  condition_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      condition, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Breakpoint.condition)
+}
 
 // repeated .google.cloud.diagnostics.debug.Variable evaluated_expressions = 10;
 inline int Breakpoint::evaluated_expressions_size() const {
@@ -1161,7 +1417,7 @@ inline const ::google::cloud::diagnostics::debug::Status& Breakpoint::status() c
 inline ::google::cloud::diagnostics::debug::Status* Breakpoint::mutable_status() {
   
   if (status_ == NULL) {
-    status_ = new ::google::cloud::diagnostics::debug::Status;
+    _slow_mutable_status();
   }
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.status)
   return status_;
@@ -1169,12 +1425,22 @@ inline ::google::cloud::diagnostics::debug::Status* Breakpoint::mutable_status()
 inline ::google::cloud::diagnostics::debug::Status* Breakpoint::release_status() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Breakpoint.status)
   
-  ::google::cloud::diagnostics::debug::Status* temp = status_;
-  status_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_status();
+  } else {
+    ::google::cloud::diagnostics::debug::Status* temp = status_;
+    status_ = NULL;
+    return temp;
+  }
 }
 inline void Breakpoint::set_allocated_status(::google::cloud::diagnostics::debug::Status* status) {
-  delete status_;
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete status_;
+  }
+  if (status != NULL) {
+    _slow_set_allocated_status(message_arena, &status);
+  }
   status_ = status;
   if (status) {
     
@@ -1198,52 +1464,203 @@ inline void Breakpoint::set_log_point(bool value) {
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Breakpoint.log_point)
 }
 
+// string log_message_format = 13;
+inline void Breakpoint::clear_log_message_format() {
+  log_message_format_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline const ::std::string& Breakpoint::log_message_format() const {
+  // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+  return log_message_format_.Get();
+}
+inline void Breakpoint::set_log_message_format(const ::std::string& value) {
+  
+  log_message_format_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+}
+#if LANG_CXX11
+inline void Breakpoint::set_log_message_format(::std::string&& value) {
+  
+  log_message_format_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+}
+#endif
+inline void Breakpoint::set_log_message_format(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  
+  log_message_format_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+}
+inline void Breakpoint::set_log_message_format(const char* value, size_t size) {
+  
+  log_message_format_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+}
+inline ::std::string* Breakpoint::mutable_log_message_format() {
+  
+  // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+  return log_message_format_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* Breakpoint::release_log_message_format() {
+  // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+  
+  return log_message_format_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* Breakpoint::unsafe_arena_release_log_message_format() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return log_message_format_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
+}
+inline void Breakpoint::set_allocated_log_message_format(::std::string* log_message_format) {
+  if (log_message_format != NULL) {
+    
+  } else {
+    
+  }
+  log_message_format_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), log_message_format,
+      GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+}
+inline void Breakpoint::unsafe_arena_set_allocated_log_message_format(
+    ::std::string* log_message_format) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (log_message_format != NULL) {
+    
+  } else {
+    
+  }
+  log_message_format_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      log_message_format, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Breakpoint.log_message_format)
+}
+
+// repeated string log_messages = 14;
+inline int Breakpoint::log_messages_size() const {
+  return log_messages_.size();
+}
+inline void Breakpoint::clear_log_messages() {
+  log_messages_.Clear();
+}
+inline const ::std::string& Breakpoint::log_messages(int index) const {
+  // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+  return log_messages_.Get(index);
+}
+inline ::std::string* Breakpoint::mutable_log_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+  return log_messages_.Mutable(index);
+}
+inline void Breakpoint::set_log_messages(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+  log_messages_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+inline void Breakpoint::set_log_messages(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+  log_messages_.Mutable(index)->assign(std::move(value));
+}
+#endif
+inline void Breakpoint::set_log_messages(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  log_messages_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+}
+inline void Breakpoint::set_log_messages(int index, const char* value, size_t size) {
+  log_messages_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+}
+inline ::std::string* Breakpoint::add_log_messages() {
+  // @@protoc_insertion_point(field_add_mutable:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+  return log_messages_.Add();
+}
+inline void Breakpoint::add_log_messages(const ::std::string& value) {
+  log_messages_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+}
+#if LANG_CXX11
+inline void Breakpoint::add_log_messages(::std::string&& value) {
+  log_messages_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+}
+#endif
+inline void Breakpoint::add_log_messages(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  log_messages_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+}
+inline void Breakpoint::add_log_messages(const char* value, size_t size) {
+  log_messages_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+Breakpoint::log_messages() const {
+  // @@protoc_insertion_point(field_list:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+  return log_messages_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+Breakpoint::mutable_log_messages() {
+  // @@protoc_insertion_point(field_mutable_list:google.cloud.diagnostics.debug.Breakpoint.log_messages)
+  return &log_messages_;
+}
+
 // -------------------------------------------------------------------
 
 // StackFrame
 
 // string method_name = 1;
 inline void StackFrame::clear_method_name() {
-  method_name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  method_name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& StackFrame::method_name() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.StackFrame.method_name)
-  return method_name_.GetNoArena();
+  return method_name_.Get();
 }
 inline void StackFrame::set_method_name(const ::std::string& value) {
   
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  method_name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.StackFrame.method_name)
 }
 #if LANG_CXX11
 inline void StackFrame::set_method_name(::std::string&& value) {
   
-  method_name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  method_name_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.StackFrame.method_name)
 }
 #endif
 inline void StackFrame::set_method_name(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  method_name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.StackFrame.method_name)
 }
 inline void StackFrame::set_method_name(const char* value, size_t size) {
   
-  method_name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  method_name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.StackFrame.method_name)
 }
 inline ::std::string* StackFrame::mutable_method_name() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.StackFrame.method_name)
-  return method_name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return method_name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* StackFrame::release_method_name() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.StackFrame.method_name)
   
-  return method_name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return method_name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* StackFrame::unsafe_arena_release_method_name() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.StackFrame.method_name)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return method_name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void StackFrame::set_allocated_method_name(::std::string* method_name) {
   if (method_name != NULL) {
@@ -1251,9 +1668,22 @@ inline void StackFrame::set_allocated_method_name(::std::string* method_name) {
   } else {
     
   }
-  method_name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), method_name);
+  method_name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), method_name,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.StackFrame.method_name)
 }
+inline void StackFrame::unsafe_arena_set_allocated_method_name(
+    ::std::string* method_name) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (method_name != NULL) {
+    
+  } else {
+    
+  }
+  method_name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      method_name, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.StackFrame.method_name)
+}
 
 // .google.cloud.diagnostics.debug.SourceLocation location = 2;
 inline bool StackFrame::has_location() const {
@@ -1271,7 +1701,7 @@ inline const ::google::cloud::diagnostics::debug::SourceLocation& StackFrame::lo
 inline ::google::cloud::diagnostics::debug::SourceLocation* StackFrame::mutable_location() {
   
   if (location_ == NULL) {
-    location_ = new ::google::cloud::diagnostics::debug::SourceLocation;
+    _slow_mutable_location();
   }
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.StackFrame.location)
   return location_;
@@ -1279,12 +1709,22 @@ inline ::google::cloud::diagnostics::debug::SourceLocation* StackFrame::mutable_
 inline ::google::cloud::diagnostics::debug::SourceLocation* StackFrame::release_location() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.StackFrame.location)
   
-  ::google::cloud::diagnostics::debug::SourceLocation* temp = location_;
-  location_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_location();
+  } else {
+    ::google::cloud::diagnostics::debug::SourceLocation* temp = location_;
+    location_ = NULL;
+    return temp;
+  }
 }
 inline void StackFrame::set_allocated_location(::google::cloud::diagnostics::debug::SourceLocation* location) {
-  delete location_;
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete location_;
+  }
+  if (location != NULL) {
+    _slow_set_allocated_location(message_arena, &location);
+  }
   location_ = location;
   if (location) {
     
@@ -1360,46 +1800,54 @@ StackFrame::locals() const {
 
 // string path = 1;
 inline void SourceLocation::clear_path() {
-  path_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  path_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& SourceLocation::path() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.SourceLocation.path)
-  return path_.GetNoArena();
+  return path_.Get();
 }
 inline void SourceLocation::set_path(const ::std::string& value) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  path_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.SourceLocation.path)
 }
 #if LANG_CXX11
 inline void SourceLocation::set_path(::std::string&& value) {
   
-  path_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  path_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.SourceLocation.path)
 }
 #endif
 inline void SourceLocation::set_path(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  path_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.SourceLocation.path)
 }
 inline void SourceLocation::set_path(const char* value, size_t size) {
   
-  path_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  path_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.SourceLocation.path)
 }
 inline ::std::string* SourceLocation::mutable_path() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.SourceLocation.path)
-  return path_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return path_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* SourceLocation::release_path() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.SourceLocation.path)
   
-  return path_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return path_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* SourceLocation::unsafe_arena_release_path() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.SourceLocation.path)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return path_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void SourceLocation::set_allocated_path(::std::string* path) {
   if (path != NULL) {
@@ -1407,9 +1855,22 @@ inline void SourceLocation::set_allocated_path(::std::string* path) {
   } else {
     
   }
-  path_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path);
+  path_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), path,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.SourceLocation.path)
 }
+inline void SourceLocation::unsafe_arena_set_allocated_path(
+    ::std::string* path) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (path != NULL) {
+    
+  } else {
+    
+  }
+  path_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      path, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.SourceLocation.path)
+}
 
 // int32 line = 2;
 inline void SourceLocation::clear_line() {
@@ -1431,46 +1892,54 @@ inline void SourceLocation::set_line(::google::protobuf::int32 value) {
 
 // string name = 1;
 inline void Variable::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& Variable::name() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Variable.name)
-  return name_.GetNoArena();
+  return name_.Get();
 }
 inline void Variable::set_name(const ::std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Variable.name)
 }
 #if LANG_CXX11
 inline void Variable::set_name(::std::string&& value) {
   
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  name_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.Variable.name)
 }
 #endif
 inline void Variable::set_name(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Variable.name)
 }
 inline void Variable::set_name(const char* value, size_t size) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  name_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Variable.name)
 }
 inline ::std::string* Variable::mutable_name() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Variable.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* Variable::release_name() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Variable.name)
   
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return name_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* Variable::unsafe_arena_release_name() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Variable.name)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return name_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void Variable::set_allocated_name(::std::string* name) {
   if (name != NULL) {
@@ -1478,52 +1947,73 @@ inline void Variable::set_allocated_name(::std::string* name) {
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  name_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.Variable.name)
 }
+inline void Variable::unsafe_arena_set_allocated_name(
+    ::std::string* name) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (name != NULL) {
+    
+  } else {
+    
+  }
+  name_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      name, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Variable.name)
+}
 
 // string type = 2;
 inline void Variable::clear_type() {
-  type_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  type_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& Variable::type() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Variable.type)
-  return type_.GetNoArena();
+  return type_.Get();
 }
 inline void Variable::set_type(const ::std::string& value) {
   
-  type_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  type_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Variable.type)
 }
 #if LANG_CXX11
 inline void Variable::set_type(::std::string&& value) {
   
-  type_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  type_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.Variable.type)
 }
 #endif
 inline void Variable::set_type(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  type_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  type_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Variable.type)
 }
 inline void Variable::set_type(const char* value, size_t size) {
   
-  type_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  type_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Variable.type)
 }
 inline ::std::string* Variable::mutable_type() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Variable.type)
-  return type_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return type_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* Variable::release_type() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Variable.type)
   
-  return type_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return type_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* Variable::unsafe_arena_release_type() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Variable.type)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return type_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void Variable::set_allocated_type(::std::string* type) {
   if (type != NULL) {
@@ -1531,52 +2021,73 @@ inline void Variable::set_allocated_type(::std::string* type) {
   } else {
     
   }
-  type_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), type);
+  type_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), type,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.Variable.type)
 }
+inline void Variable::unsafe_arena_set_allocated_type(
+    ::std::string* type) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (type != NULL) {
+    
+  } else {
+    
+  }
+  type_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      type, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Variable.type)
+}
 
 // string value = 3;
 inline void Variable::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  value_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& Variable::value() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Variable.value)
-  return value_.GetNoArena();
+  return value_.Get();
 }
 inline void Variable::set_value(const ::std::string& value) {
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  value_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Variable.value)
 }
 #if LANG_CXX11
 inline void Variable::set_value(::std::string&& value) {
   
-  value_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  value_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.Variable.value)
 }
 #endif
 inline void Variable::set_value(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  value_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Variable.value)
 }
 inline void Variable::set_value(const char* value, size_t size) {
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  value_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Variable.value)
 }
 inline ::std::string* Variable::mutable_value() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Variable.value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return value_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* Variable::release_value() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Variable.value)
   
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return value_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* Variable::unsafe_arena_release_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Variable.value)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return value_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void Variable::set_allocated_value(::std::string* value) {
   if (value != NULL) {
@@ -1584,9 +2095,22 @@ inline void Variable::set_allocated_value(::std::string* value) {
   } else {
     
   }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  value_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.Variable.value)
 }
+inline void Variable::unsafe_arena_set_allocated_value(
+    ::std::string* value) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (value != NULL) {
+    
+  } else {
+    
+  }
+  value_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      value, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Variable.value)
+}
 
 // repeated .google.cloud.diagnostics.debug.Variable members = 4;
 inline int Variable::members_size() const {
@@ -1634,7 +2158,7 @@ inline const ::google::cloud::diagnostics::debug::Status& Variable::status() con
 inline ::google::cloud::diagnostics::debug::Status* Variable::mutable_status() {
   
   if (status_ == NULL) {
-    status_ = new ::google::cloud::diagnostics::debug::Status;
+    _slow_mutable_status();
   }
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Variable.status)
   return status_;
@@ -1642,12 +2166,22 @@ inline ::google::cloud::diagnostics::debug::Status* Variable::mutable_status() {
 inline ::google::cloud::diagnostics::debug::Status* Variable::release_status() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Variable.status)
   
-  ::google::cloud::diagnostics::debug::Status* temp = status_;
-  status_ = NULL;
-  return temp;
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_status();
+  } else {
+    ::google::cloud::diagnostics::debug::Status* temp = status_;
+    status_ = NULL;
+    return temp;
+  }
 }
 inline void Variable::set_allocated_status(::google::cloud::diagnostics::debug::Status* status) {
-  delete status_;
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete status_;
+  }
+  if (status != NULL) {
+    _slow_set_allocated_status(message_arena, &status);
+  }
   status_ = status;
   if (status) {
     
@@ -1677,46 +2211,54 @@ inline void Status::set_iserror(bool value) {
 
 // string message = 2;
 inline void Status::clear_message() {
-  message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  message_.ClearToEmpty(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline const ::std::string& Status::message() const {
   // @@protoc_insertion_point(field_get:google.cloud.diagnostics.debug.Status.message)
-  return message_.GetNoArena();
+  return message_.Get();
 }
 inline void Status::set_message(const ::std::string& value) {
   
-  message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  message_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value, GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set:google.cloud.diagnostics.debug.Status.message)
 }
 #if LANG_CXX11
 inline void Status::set_message(::std::string&& value) {
   
-  message_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  message_.Set(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_rvalue:google.cloud.diagnostics.debug.Status.message)
 }
 #endif
 inline void Status::set_message(const char* value) {
   GOOGLE_DCHECK(value != NULL);
   
-  message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  message_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_char:google.cloud.diagnostics.debug.Status.message)
 }
 inline void Status::set_message(const char* value, size_t size) {
   
-  message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
+  message_.Set(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_pointer:google.cloud.diagnostics.debug.Status.message)
 }
 inline ::std::string* Status::mutable_message() {
   
   // @@protoc_insertion_point(field_mutable:google.cloud.diagnostics.debug.Status.message)
-  return message_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return message_.Mutable(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
 }
 inline ::std::string* Status::release_message() {
   // @@protoc_insertion_point(field_release:google.cloud.diagnostics.debug.Status.message)
   
-  return message_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return message_.Release(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), GetArenaNoVirtual());
+}
+inline ::std::string* Status::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:google.cloud.diagnostics.debug.Status.message)
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  
+  return message_.UnsafeArenaRelease(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      GetArenaNoVirtual());
 }
 inline void Status::set_allocated_message(::std::string* message) {
   if (message != NULL) {
@@ -1724,9 +2266,22 @@ inline void Status::set_allocated_message(::std::string* message) {
   } else {
     
   }
-  message_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), message);
+  message_.SetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), message,
+      GetArenaNoVirtual());
   // @@protoc_insertion_point(field_set_allocated:google.cloud.diagnostics.debug.Status.message)
 }
+inline void Status::unsafe_arena_set_allocated_message(
+    ::std::string* message) {
+  GOOGLE_DCHECK(GetArenaNoVirtual() != NULL);
+  if (message != NULL) {
+    
+  } else {
+    
+  }
+  message_.UnsafeArenaSetAllocated(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      message, GetArenaNoVirtual());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:google.cloud.diagnostics.debug.Status.message)
+}
 
 #endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
 // -------------------------------------------------------------------
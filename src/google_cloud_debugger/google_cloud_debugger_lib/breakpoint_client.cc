@@ -14,6 +14,8 @@
 
 #include "breakpoint_client.h"
 
+#include <algorithm>
+#include <cstring>
 #include <mutex>
 
 #include "constants.h"
@@ -34,7 +36,99 @@ HRESULT BreakpointClient::WaitForConnection() {
 }
 
 HRESULT BreakpointClient::ReadBreakpoint(Breakpoint *breakpoint) {
+  if (breakpoint == nullptr) {
+    return E_POINTER;
+  }
+
   std::lock_guard<std::mutex> lock(mutex_);
+  if (framing_version_ == kLengthPrefixedFramingVersion) {
+    return ReadLengthPrefixedBreakpoint(breakpoint);
+  }
+  return ReadSentinelBreakpoint(breakpoint);
+}
+
+HRESULT BreakpointClient::ReadLengthPrefixedBreakpoint(
+    Breakpoint *breakpoint) {
+  HRESULT hr = FillReadBuffer(kFramedMessageHeaderSize);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  const char *header = read_buffer_.data() + read_start_;
+  if (kFramedMessageMagic.compare(0, kFramedMessageMagic.size(), header,
+                                  kFramedMessageMagic.size()) != 0 ||
+      static_cast<std::uint8_t>(header[kFramedMessageMagic.size()]) !=
+          kLengthPrefixedFramingVersion) {
+    cerr << "invalid breakpoint message header" << std::endl;
+    return E_FAIL;
+  }
+
+  const unsigned char *size_bytes =
+      reinterpret_cast<const unsigned char *>(header) +
+      kFramedMessageMagic.size() + 1;
+  std::uint32_t message_size = static_cast<std::uint32_t>(size_bytes[0]) |
+                               static_cast<std::uint32_t>(size_bytes[1]) << 8 |
+                               static_cast<std::uint32_t>(size_bytes[2]) << 16 |
+                               static_cast<std::uint32_t>(size_bytes[3]) << 24;
+  if (message_size > kMaximumFramedMessageSize) {
+    cerr << "breakpoint message is too large: " << message_size << std::endl;
+    return E_FAIL;
+  }
+
+  hr = FillReadBuffer(kFramedMessageHeaderSize + message_size);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // FillReadBuffer may have moved the unconsumed bytes.
+  const char *message =
+      read_buffer_.data() + read_start_ + kFramedMessageHeaderSize;
+  read_start_ += kFramedMessageHeaderSize + message_size;
+  if (read_start_ == read_end_) {
+    read_start_ = read_end_ = 0;
+  }
+
+  if (!breakpoint->ParseFromArray(message, message_size)) {
+    cerr << "failed to serialize from protobuf" << std::endl;
+    return E_FAIL;
+  }
+  return S_OK;
+}
+
+HRESULT BreakpointClient::FillReadBuffer(std::size_t size) {
+  if (read_end_ - read_start_ >= size) {
+    return S_OK;
+  }
+
+  if (read_buffer_.size() - read_start_ < size) {
+    std::memmove(read_buffer_.data(), read_buffer_.data() + read_start_,
+                 read_end_ - read_start_);
+    read_end_ -= read_start_;
+    read_start_ = 0;
+    if (read_buffer_.size() < size) {
+      read_buffer_.resize(
+          std::max(size, static_cast<std::size_t>(kBufferSize)));
+    }
+  }
+
+  while (read_end_ - read_start_ < size) {
+    std::size_t bytes_read = 0;
+    HRESULT hr = pipe_->ReadBytes(read_buffer_.data() + read_end_,
+                                  read_buffer_.size() - read_end_, &bytes_read);
+    if (FAILED(hr)) {
+      return hr;
+    }
+
+    if (bytes_read == 0) {
+      cerr << "pipe closed in the middle of a breakpoint message" << std::endl;
+      return E_FAIL;
+    }
+    read_end_ += bytes_read;
+  }
+  return S_OK;
+}
+
+HRESULT BreakpointClient::ReadSentinelBreakpoint(Breakpoint *breakpoint) {
   string buffer;
   std::swap(buffer, buffer_);
   string str;
@@ -54,7 +148,7 @@ HRESULT BreakpointClient::ReadBreakpoint(Breakpoint *breakpoint) {
 
   // Ensure we have a start to the breakpoint message.
   std::size_t found_start = buffer.find(kStartBreakpointMessage);
-  if (found_end == string::npos) {
+  if (found_start == string::npos || found_start > found_end) {
     cerr << "invalid breakpoint message" << std::endl;
     return E_FAIL;
   }
@@ -72,14 +166,46 @@ HRESULT BreakpointClient::ReadBreakpoint(Breakpoint *breakpoint) {
 }
 
 HRESULT BreakpointClient::WriteBreakpoint(const Breakpoint &breakpoint) {
-  string bp_str;
-  if (!breakpoint.SerializeToString(&bp_str)) {
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  if (framing_version_ == kLengthPrefixedFramingVersion) {
+    if (!breakpoint.SerializeToString(&write_buffer_)) {
+      cerr << "failed to serialize to protobuf" << std::endl;
+      return E_FAIL;
+    }
+
+    if (write_buffer_.size() > kMaximumFramedMessageSize) {
+      cerr << "breakpoint message is too large: " << write_buffer_.size()
+           << std::endl;
+      return E_FAIL;
+    }
+
+    // The header and the message are handed to the pipe separately
+    // so the serialized message does not have to be copied.
+    char header[kFramedMessageHeaderSize];
+    EncodeFramedMessageHeader(write_buffer_.size(), header);
+    return pipe_->WriteBuffers(
+        {PipeBuffer{header, kFramedMessageHeaderSize},
+         PipeBuffer{write_buffer_.data(), write_buffer_.size()}});
+  }
+
+  write_buffer_.assign(kStartBreakpointMessage);
+  if (!breakpoint.AppendToString(&write_buffer_)) {
     cerr << "failed to serialize to protobuf" << std::endl;
     return E_FAIL;
   }
-  bp_str.insert(0, kStartBreakpointMessage);
-  bp_str.append(kEndBreakpointMessage);
-  return pipe_->Write(bp_str);
+  write_buffer_.append(kEndBreakpointMessage);
+  return pipe_->Write(write_buffer_);
+}
+
+void BreakpointClient::EncodeFramedMessageHeader(std::uint32_t message_size,
+                                                 char *header) {
+  std::memcpy(header, kFramedMessageMagic.data(), kFramedMessageMagic.size());
+  char *rest = header + kFramedMessageMagic.size();
+  rest[0] = static_cast<char>(kLengthPrefixedFramingVersion);
+  rest[1] = static_cast<char>(message_size & 0xFF);
+  rest[2] = static_cast<char>((message_size >> 8) & 0xFF);
+  rest[3] = static_cast<char>((message_size >> 16) & 0xFF);
+  rest[4] = static_cast<char>((message_size >> 24) & 0xFF);
 }
 
 HRESULT BreakpointClient::ShutDown() {
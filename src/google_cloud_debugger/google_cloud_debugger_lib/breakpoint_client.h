@@ -17,9 +17,11 @@
 
 #include <cor.h>
 #include <windef.h>
+#include <cstdint>
 #include <iostream>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "dbg_breakpoint.h"
 #include "constants.h"
@@ -54,15 +56,66 @@ class BreakpointClient {
   // Shuts down the pipe.
   HRESULT ShutDown();
 
+  // Sets the version of the pipe protocol used to frame breakpoint
+  // messages. Must be kSentinelFramingVersion (the default) or
+  // kLengthPrefixedFramingVersion and must match the breakpoint server.
+  void SetFramingVersion(std::uint8_t framing_version) {
+    framing_version_ = framing_version;
+  }
+
+  // Returns the version of the pipe protocol used to frame
+  // breakpoint messages.
+  std::uint8_t GetFramingVersion() const { return framing_version_; }
+
+  // Writes the header of a length-prefixed breakpoint message of
+  // message_size bytes to header, which must hold at least
+  // kFramedMessageHeaderSize bytes.
+  static void EncodeFramedMessageHeader(std::uint32_t message_size,
+                                        char *header);
+
  private:
+  // Reads a length-prefixed breakpoint message into breakpoint.
+  // The message is parsed in place from read_buffer_.
+  HRESULT ReadLengthPrefixedBreakpoint(
+      google::cloud::diagnostics::debug::Breakpoint *breakpoint);
+
+  // Reads a breakpoint message framed by kStartBreakpointMessage
+  // and kEndBreakpointMessage into breakpoint.
+  HRESULT ReadSentinelBreakpoint(
+      google::cloud::diagnostics::debug::Breakpoint *breakpoint);
+
+  // Reads from the pipe until read_buffer_ holds at least size
+  // unconsumed bytes. Unconsumed bytes are moved to the front of
+  // read_buffer_ if there is not enough room after them.
+  HRESULT FillReadBuffer(std::size_t size);
+
   // The pipe client to send messages.
   std::unique_ptr<INamedPipe> pipe_;
 
-  // A buffer to hold partial breakpoint messages.
+  // Version of the pipe protocol used to frame breakpoint messages.
+  std::uint8_t framing_version_ = kSentinelFramingVersion;
+
+  // A buffer to hold partial breakpoint messages
+  // framed by kStartBreakpointMessage and kEndBreakpointMessage.
   std::string buffer_;
 
-  // Mutex to protect the buffer.
+  // A buffer to hold partial length-prefixed breakpoint messages.
+  // It is reused across reads so it only grows to the size of the
+  // largest message. Bytes from read_start_ to read_end_ have been
+  // read from the pipe but not consumed yet.
+  std::vector<char> read_buffer_;
+  std::size_t read_start_ = 0;
+  std::size_t read_end_ = 0;
+
+  // Mutex to protect the read buffers.
   std::mutex mutex_;
+
+  // A buffer to hold serialized breakpoints.
+  // It is reused across writes.
+  std::string write_buffer_;
+
+  // Mutex to protect write_buffer_.
+  std::mutex write_mutex_;
 };
 
 }  // namespace google_cloud_debugger
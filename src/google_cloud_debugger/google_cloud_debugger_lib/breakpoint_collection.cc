@@ -50,7 +50,8 @@ HRESULT BreakpointCollection::SetDebuggerCallback(
 }
 
 HRESULT BreakpointCollection::CreateAndInitializeBreakpointClient(
-    unique_ptr<BreakpointClient> *client, std::string pipe_name) {
+    unique_ptr<BreakpointClient> *client, std::string pipe_name,
+    std::uint8_t framing_version) {
   if (client == nullptr) {
     return E_INVALIDARG;
   }
@@ -68,6 +69,7 @@ HRESULT BreakpointCollection::CreateAndInitializeBreakpointClient(
     cerr << "Cannot create breakpoint client.";
     return E_OUTOFMEMORY;
   }
+  result->SetFramingVersion(framing_version);
 
   HRESULT hr = result->Initialize();
   if (FAILED(hr)) {
@@ -87,9 +89,16 @@ HRESULT BreakpointCollection::CreateAndInitializeBreakpointClient(
 }
 
 HRESULT BreakpointCollection::WriteBreakpoint(const Breakpoint &breakpoint) {
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  if (write_client_shut_down_) {
+    cerr << "Breakpoint client for writing breakpoints is shut down.";
+    return E_FAIL;
+  }
+
   if (!breakpoint_client_write_) {
     HRESULT hr = CreateAndInitializeBreakpointClient(
-        &breakpoint_client_write_, debugger_callback_->GetPipeName());
+        &breakpoint_client_write_, debugger_callback_->GetPipeName(),
+        debugger_callback_->GetPipeFramingVersion());
     if (FAILED(hr)) {
       cerr << "Failed to initialize breakpoint client for writing breakpoints.";
       return hr;
@@ -99,10 +108,45 @@ HRESULT BreakpointCollection::WriteBreakpoint(const Breakpoint &breakpoint) {
   return breakpoint_client_write_->WriteBreakpoint(breakpoint);
 }
 
+HRESULT BreakpointCollection::QueueBreakpoint(
+    std::shared_ptr<Breakpoint> breakpoint) {
+  if (!breakpoint) {
+    return E_INVALIDARG;
+  }
+
+  std::uint32_t queue_size = debugger_callback_
+                                 ? debugger_callback_->GetSnapshotQueueSize()
+                                 : SnapshotWriter::kDefaultMaxPending;
+  if (queue_size == 0) {
+    return WriteBreakpoint(*breakpoint);
+  }
+
+  SnapshotWriter *snapshot_writer;
+  {
+    std::lock_guard<std::mutex> lock(snapshot_writer_mutex_);
+    if (!snapshot_writer_) {
+      snapshot_writer_ = unique_ptr<SnapshotWriter>(
+          new (std::nothrow) SnapshotWriter(
+              [this](const Breakpoint &breakpoint) {
+                return WriteBreakpoint(breakpoint);
+              },
+              queue_size));
+      if (!snapshot_writer_) {
+        cerr << "Cannot create snapshot writer.";
+        return E_OUTOFMEMORY;
+      }
+    }
+    snapshot_writer = snapshot_writer_.get();
+  }
+
+  return snapshot_writer->Enqueue(std::move(breakpoint));
+}
+
 HRESULT BreakpointCollection::ReadBreakpoint(Breakpoint *breakpoint) {
   if (!breakpoint_client_read_) {
     HRESULT hr = CreateAndInitializeBreakpointClient(
-        &breakpoint_client_read_, debugger_callback_->GetPipeName());
+        &breakpoint_client_read_, debugger_callback_->GetPipeName(),
+        debugger_callback_->GetPipeFramingVersion());
     if (FAILED(hr)) {
       cerr << "Failed to initialize breakpoint client for reading breakpoints.";
       return hr;
@@ -123,23 +167,41 @@ HRESULT BreakpointCollection::EvaluateAndPrintBreakpoint(
 
   {
     std::lock_guard<std::mutex> lock(mutex_);
-    for (auto &&kvp : location_to_breakpoints_) {
-      // Since the breakpoints are grouped by location, if
-      // one matches, all of them do.
-      if (kvp.second->GetMethodToken() == function_token
-        && kvp.second->GetILOffset() == il_offset) {
-        matched_breakpoints = kvp.second->GetBreakpoints();
-        break;
-      }
+    // Since the breakpoints are grouped by location, if
+    // one matches, all of them do.
+    const auto &location = method_il_offset_to_location_.find(
+        GetMethodILOffsetKey(function_token, il_offset));
+    if (location != method_il_offset_to_location_.end()) {
+      ++locations_examined_;
+      matched_breakpoints = location->second->GetBreakpoints();
+    }
+  }
+
+  // Breakpoints whose condition would be evaluated too often are
+  // dropped before the eval coordinator starts working on the hit.
+  std::vector<std::shared_ptr<DbgBreakpoint>> allowed_breakpoints;
+  for (auto &&breakpoint : matched_breakpoints) {
+    if (breakpoint->GetCondition().empty()) {
+      allowed_breakpoints.push_back(breakpoint);
+      continue;
+    }
+
+    std::string reason;
+    BreakpointRateLimiter::Decision decision =
+        rate_limiter_.AcquireConditionEvaluation(breakpoint->GetId(), &reason);
+    if (decision == BreakpointRateLimiter::Decision::kAllow) {
+      allowed_breakpoints.push_back(breakpoint);
+    } else if (decision == BreakpointRateLimiter::Decision::kDisable) {
+      DisableBreakpoint(*breakpoint, reason);
     }
   }
 
-  if (matched_breakpoints.empty()) {
+  if (allowed_breakpoints.empty()) {
     return S_FALSE;
   }
 
   hr = eval_coordinator->ProcessBreakpoints(
-      debug_thread, this, std::move(matched_breakpoints), pdb_files);
+      debug_thread, this, std::move(allowed_breakpoints), pdb_files);
   if (FAILED(hr)) {
     cerr << "Failed to get stack frame's information.";
   }
@@ -147,6 +209,28 @@ HRESULT BreakpointCollection::EvaluateAndPrintBreakpoint(
   return hr;
 }
 
+HRESULT BreakpointCollection::DisableBreakpoint(const DbgBreakpoint &breakpoint,
+                                                const std::string &reason) {
+  cerr << "Disabling breakpoint " << breakpoint.GetId() << ": " << reason
+       << std::endl;
+
+  DbgBreakpoint deactivated_breakpoint;
+  deactivated_breakpoint.Initialize(breakpoint);
+  deactivated_breakpoint.SetActivated(false);
+  HRESULT hr = UpdateBreakpoint(deactivated_breakpoint);
+  if (FAILED(hr)) {
+    cerr << "Failed to deactivate breakpoint " << breakpoint.GetId()
+         << " with HRESULT: " << std::hex << hr;
+    return hr;
+  }
+
+  std::shared_ptr<Breakpoint> disabled_breakpoint =
+      std::make_shared<Breakpoint>();
+  disabled_breakpoint->set_id(breakpoint.GetId());
+  SetErrorStatusMessage(disabled_breakpoint.get(), reason);
+  return QueueBreakpoint(std::move(disabled_breakpoint));
+}
+
 HRESULT BreakpointCollection::ReadAndParseBreakpoint(
     DbgBreakpoint *breakpoint) {
   assert(breakpoint != nullptr);
@@ -168,6 +252,8 @@ HRESULT BreakpointCollection::ReadAndParseBreakpoint(
                                breakpoint_read.expressions().end()));
   breakpoint->SetActivated(breakpoint_read.activated());
   breakpoint->SetKillServer(breakpoint_read.kill_server());
+  breakpoint->SetLogPoint(breakpoint_read.log_point());
+  breakpoint->SetLogMessageFormat(breakpoint_read.log_message_format());
 
   return S_OK;
 }
@@ -233,18 +319,54 @@ HRESULT BreakpointCollection::UpdateBreakpoint(
     return S_FALSE;
   }
 
+  // Parses the condition and expressions once here instead of
+  // every time the breakpoint is hit.
+  new_breakpoint->ParseConditionAndExpressions();
+  return AddBreakpointLocation(breakpoint_location, std::move(new_breakpoint));
+}
+
+HRESULT BreakpointCollection::AddBreakpointLocation(
+    const std::string &breakpoint_location,
+    std::shared_ptr<DbgBreakpoint> breakpoint) {
+  if (!breakpoint) {
+    return E_INVALIDARG;
+  }
+
+  std::uint64_t method_il_offset_key = GetMethodILOffsetKey(
+      breakpoint->GetMethodToken(), breakpoint->GetILOffset());
+
   // Create a new location collection.
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    std::unique_ptr<BreakpointLocationCollection> bp_location(new BreakpointLocationCollection());
-    hr = bp_location->AddFirstBreakpoint(std::move(new_breakpoint));
-    if (FAILED(hr)) {
-      return hr;
-    }
+  std::unique_ptr<BreakpointLocationCollection> bp_location(
+      new (std::nothrow) BreakpointLocationCollection());
+  if (!bp_location) {
+    return E_OUTOFMEMORY;
+  }
+
+  HRESULT hr = bp_location->AddFirstBreakpoint(std::move(breakpoint));
+  if (FAILED(hr)) {
+    return hr;
+  }
 
-    location_to_breakpoints_[breakpoint.GetBreakpointLocation()]
-      = std::move(bp_location);
+  std::lock_guard<std::mutex> lock(mutex_);
+  // If a collection already exists at this location, it will be
+  // replaced so its entry in the index has to be dropped first.
+  const auto &existing_location =
+      location_to_breakpoints_.find(breakpoint_location);
+  if (existing_location != location_to_breakpoints_.end()) {
+    const auto &existing_index = method_il_offset_to_location_.find(
+        GetMethodILOffsetKey(existing_location->second->GetMethodToken(),
+                             existing_location->second->GetILOffset()));
+    if (existing_index != method_il_offset_to_location_.end() &&
+        existing_index->second == existing_location->second.get()) {
+      method_il_offset_to_location_.erase(existing_index);
+    }
   }
+
+  // Different file paths can resolve to the same method and IL offset.
+  // In that case, the first location registered keeps handling the hits.
+  method_il_offset_to_location_.emplace(method_il_offset_key,
+                                        bp_location.get());
+  location_to_breakpoints_[breakpoint_location] = std::move(bp_location);
   return S_OK;
 }
 
@@ -266,6 +388,11 @@ HRESULT BreakpointCollection::SyncBreakpoints() {
     if (FAILED(hr)) {
       cerr << "Failed to activate breakpoint.";
     }
+
+    // The usage of a breakpoint the agent removed is no longer needed.
+    if (!breakpoint.Activated()) {
+      rate_limiter_.RemoveBreakpoint(breakpoint.GetId());
+    }
   }
 
   return S_OK;
@@ -274,26 +401,43 @@ HRESULT BreakpointCollection::SyncBreakpoints() {
 HRESULT BreakpointCollection::CancelSyncBreakpoints() {
   HRESULT hr = S_OK;
 
+  // Writes the breakpoints that are still queued before the agent
+  // is told to shut down.
+  {
+    std::lock_guard<std::mutex> lock(snapshot_writer_mutex_);
+    if (snapshot_writer_) {
+      snapshot_writer_->Stop();
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  if (write_client_shut_down_) {
+    return S_OK;
+  }
+
   // We are shutting down the debugger, signal the agent
   // to shutdown as well.
-  Breakpoint kill_breakpoint;
-  kill_breakpoint.set_kill_server(true);
-  hr = breakpoint_client_write_->WriteBreakpoint(kill_breakpoint);
-
-  if (FAILED(hr)) {
-	  return hr;
+  if (breakpoint_client_write_) {
+    Breakpoint kill_breakpoint;
+    kill_breakpoint.set_kill_server(true);
+    hr = breakpoint_client_write_->WriteBreakpoint(kill_breakpoint);
+    if (FAILED(hr)) {
+      return hr;
+    }
   }
 
   if (breakpoint_client_read_) {
-	hr = breakpoint_client_read_->ShutDown();
-  }
-  
-  if (FAILED(hr)) {
-	return hr;
+    hr = breakpoint_client_read_->ShutDown();
+    if (FAILED(hr)) {
+      return hr;
+    }
   }
 
+  // Breakpoints written after this, for example by a breakpoint hit
+  // that is still being processed, are rejected.
+  write_client_shut_down_ = true;
   if (breakpoint_client_write_) {
-	hr = breakpoint_client_write_->ShutDown();
+    hr = breakpoint_client_write_->ShutDown();
   }
 
   return hr;
@@ -312,9 +456,59 @@ HRESULT BreakpointCollection::ActivateBreakpointHelper(
     return E_INVALIDARG;
   }
 
-  CComPtr<ICorDebugModule> debug_module;
-  CComPtr<IUnknown> temp_import;
+  HRESULT hr;
+  MethodTokenCache *method_token_cache = portable_pdb->GetMethodTokenCache();
+  MethodTokenCache::Entry method;
+  if (!method_token_cache ||
+      !method_token_cache->Find(breakpoint->GetMethodDef(), &method)) {
+    hr = ResolveMethod(portable_pdb, breakpoint->GetMethodDef(), &method);
+    if (FAILED(hr)) {
+      return hr;
+    }
+
+    if (method_token_cache) {
+      method_token_cache->Add(breakpoint->GetMethodDef(), method);
+    }
+  }
+
+  // Activates the breakpoint in this method.
+  breakpoint->SetMethodToken(method.method_token);
+
+  CComPtr<ICorDebugCode> debug_code;
+  hr = method.debug_function->GetILCode(&debug_code);
+  if (FAILED(hr)) {
+    cerr << "Failed to get ICorDebugCode from function with hr " << std::hex
+         << hr;
+    return hr;
+  }
+
+  CComPtr<ICorDebugFunctionBreakpoint> function_breakpoint;
+  hr = debug_code->CreateBreakpoint(breakpoint->GetILOffset(),
+                                    &function_breakpoint);
+  if (FAILED(hr)) {
+    cerr << "Failed to set breakpoint in at offset "
+         << breakpoint->GetILOffset() << " in function "
+         << breakpoint->GetMethodToken() << " with HRESULT " << std::hex << hr;
+    return hr;
+  }
+
+  hr = function_breakpoint->Activate(TRUE);
+  if (FAILED(hr)) {
+    cerr << "Failed to activate breakpoint in at offset "
+         << breakpoint->GetILOffset() << " in function "
+         << breakpoint->GetMethodToken() << " with HRESULT " << std::hex << hr;
+    return hr;
+  }
 
+  breakpoint->SetMethodName(method.method_name);
+  breakpoint->SetCorDebugBreakpoint(function_breakpoint);
+  return S_OK;
+}
+
+HRESULT BreakpointCollection::ResolveMethod(
+    google_cloud_debugger_portable_pdb::IPortablePdbFile *portable_pdb,
+    uint32_t method_def, MethodTokenCache::Entry *method) {
+  CComPtr<ICorDebugModule> debug_module;
   HRESULT hr = portable_pdb->GetDebugModule(&debug_module);
   if (FAILED(hr)) {
     cout << "Failed to get ICorDebugModule from portable PDB.";
@@ -332,9 +526,8 @@ HRESULT BreakpointCollection::ActivateBreakpointHelper(
   vector<WCHAR> method_name;
   PCCOR_SIGNATURE signature;
   ULONG method_virtual_addr;
-  hr = GetMethodData(metadata_import, breakpoint->GetMethodDef(), &type_def,
-                     &signature, &method_virtual_addr, &method_name);
-
+  hr = GetMethodData(metadata_import, method_def, &type_def, &signature,
+                     &method_virtual_addr, &method_name);
   if (FAILED(hr)) {
     return hr;
   }
@@ -342,6 +535,7 @@ HRESULT BreakpointCollection::ActivateBreakpointHelper(
   HCORENUM cor_enum = nullptr;
   bool method_found = false;
   bool has_error = false;
+  vector<mdMethodDef> method_tokens(100, 0);
 
   while (!method_found && !has_error) {
     // Enumerate all the methods with the same name as this.
@@ -352,7 +546,6 @@ HRESULT BreakpointCollection::ActivateBreakpointHelper(
     // So what we have to do here is search for a method in
     // IMetaDataImport->EnumMethodsWithName that has the same signature
     // and use its method token.
-    vector<mdMethodDef> method_tokens(100, 0);
     ULONG method_defs_returned = 0;
     hr = metadata_import->EnumMethodsWithName(
         &cor_enum, type_def, method_name.data(), method_tokens.data(),
@@ -384,11 +577,8 @@ HRESULT BreakpointCollection::ActivateBreakpointHelper(
         continue;
       }
 
-      // Activates the breakpoint in this method.
-      CComPtr<ICorDebugFunction> debug_function;
-      breakpoint->SetMethodToken(method_tokens[i]);
-      hr =
-          debug_module->GetFunctionFromToken(method_tokens[i], &debug_function);
+      hr = debug_module->GetFunctionFromToken(method_tokens[i],
+                                              &method->debug_function);
       if (FAILED(hr)) {
         cerr << "Failed to get function from function token "
              << method_tokens[i] << " with HRESULT " << std::hex << hr;
@@ -396,40 +586,8 @@ HRESULT BreakpointCollection::ActivateBreakpointHelper(
         break;
       }
 
-      CComPtr<ICorDebugCode> debug_code;
-      hr = debug_function->GetILCode(&debug_code);
-      if (FAILED(hr)) {
-        cerr << "Failed to get ICorDebugCode from function with hr " << std::hex
-             << hr;
-        has_error = true;
-        break;
-      }
-
-      CComPtr<ICorDebugFunctionBreakpoint> function_breakpoint;
-      hr = debug_code->CreateBreakpoint(breakpoint->GetILOffset(),
-                                        &function_breakpoint);
-
-      if (FAILED(hr)) {
-        cerr << "Failed to set breakpoint in at offset "
-             << breakpoint->GetILOffset() << " in function "
-             << breakpoint->GetMethodToken() << " with HRESULT " << std::hex
-             << hr;
-        has_error = true;
-        break;
-      }
-
-      hr = function_breakpoint->Activate(TRUE);
-      if (FAILED(hr)) {
-        cerr << "Failed to activate breakpoint in at offset "
-             << breakpoint->GetILOffset() << " in function "
-             << breakpoint->GetMethodToken() << " with HRESULT " << std::hex
-             << hr;
-        has_error = true;
-        break;
-      }
-
-      breakpoint->SetMethodName(std::move(method_name));
-      breakpoint->SetCorDebugBreakpoint(function_breakpoint);
+      method->method_token = method_tokens[i];
+      method->method_name = std::move(method_name);
       method_found = true;
       break;
     }
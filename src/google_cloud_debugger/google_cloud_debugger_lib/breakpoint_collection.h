@@ -15,16 +15,20 @@
 #ifndef BREAKPOINT_COLLECTION_H_
 #define BREAKPOINT_COLLECTION_H_
 
+#include <cstdint>
 #include <unordered_map>
 #include <memory>
 #include <mutex>
 #include <vector>
 
 #include "breakpoint_client.h"
+#include "breakpoint_rate_limiter.h"
 #include "ccomptr.h"
 #include "dbg_breakpoint.h"
 #include "i_breakpoint_collection.h"
 #include "breakpoint_location_collection.h"
+#include "method_token_cache.h"
+#include "snapshot_writer.h"
 
 namespace google_cloud_debugger {
 
@@ -65,19 +69,31 @@ class BreakpointCollection : public IBreakpointCollection {
   HRESULT SyncBreakpoints() override;
 
   // Cancel SyncBreakpoints operation (should be called from another thread).
+  // The breakpoints queued so far are written before the agent is told
+  // to shut down and the named pipe clients are shut down.
   HRESULT CancelSyncBreakpoints() override;
 
-  // Writes a breakpoint to the named pipe server.
+  // Writes a breakpoint to the named pipe server. Writes from different
+  // threads are serialized so their messages do not interleave.
   HRESULT WriteBreakpoint(
       const google::cloud::diagnostics::debug::Breakpoint &breakpoint) override;
 
+  // Queues a breakpoint to be written to the named pipe server by
+  // snapshot_writer_. If the snapshot queue size of the debugger callback
+  // is 0, the breakpoint is written right away instead.
+  HRESULT QueueBreakpoint(
+      std::shared_ptr<google::cloud::diagnostics::debug::Breakpoint>
+          breakpoint) override;
+
   // Reads a breakpoint from the named pipe server.
   HRESULT ReadBreakpoint(
       google::cloud::diagnostics::debug::Breakpoint *breakpoint) override;
 
   // Evaluates and prints out the breakpoint that corresponds to
   // the IL offset il_offset inside the function with token
-  // function_token.
+  // function_token. The breakpoints are looked up through
+  // method_il_offset_to_location_ so the cost of this lookup does not
+  // depend on the number of active breakpoint locations.
   HRESULT EvaluateAndPrintBreakpoint(
       mdMethodDef function_token, ULONG32 il_offset,
       IEvalCoordinator *eval_coordinator, ICorDebugThread *debug_thread,
@@ -85,6 +101,48 @@ class BreakpointCollection : public IBreakpointCollection {
           std::shared_ptr<google_cloud_debugger_portable_pdb::IPortablePdbFile>>
           &pdb_files) override;
 
+  // Returns the number of breakpoint locations EvaluateAndPrintBreakpoint
+  // has compared against a breakpoint hit so far. Since hits are looked up
+  // in method_il_offset_to_location_, this grows by at most 1 per hit.
+  std::uint64_t GetLocationsExamined() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return locations_examined_;
+  }
+
+  // Sets the clients used to read and write breakpoints instead of
+  // connecting to the named pipe server. This is used for testing.
+  void SetBreakpointClients(std::unique_ptr<BreakpointClient> read_client,
+                            std::unique_ptr<BreakpointClient> write_client) {
+    breakpoint_client_read_ = std::move(read_client);
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    breakpoint_client_write_ = std::move(write_client);
+  }
+
+  // Returns the rate limiter of the breakpoints in this collection.
+  BreakpointRateLimiter *GetRateLimiter() override { return &rate_limiter_; }
+
+  // Deactivates breakpoint and queues a breakpoint with reason as its
+  // error status to be written to the named pipe server.
+  HRESULT DisableBreakpoint(const DbgBreakpoint &breakpoint,
+                            const std::string &reason) override;
+
+  // Creates a new BreakpointLocationCollection from breakpoint, which
+  // must already be set and activated, and adds it to
+  // location_to_breakpoints_ under breakpoint_location. The location
+  // is also indexed by the method token and IL offset of breakpoint.
+  HRESULT AddBreakpointLocation(const std::string &breakpoint_location,
+                                std::shared_ptr<DbgBreakpoint> breakpoint);
+
+  // Activate a breakpoint in a portable pdb file.
+  // This function should only be used if breakpoint is already set, i.e.
+  // the TryGetBreakpoint method is called on the breakpoint.
+  // The method the breakpoint is in is looked up in the method token
+  // cache of portable_pdb first and only resolved through IMetaDataImport
+  // the first time a breakpoint is set in that method.
+  HRESULT ActivateBreakpointHelper(
+      DbgBreakpoint *breakpoint,
+      google_cloud_debugger_portable_pdb::IPortablePdbFile *portable_pdb);
+
  private:
   // Reads an incoming breakpoint from the named pipe and populates
   // The DbgBreakpoint object based on that.
@@ -97,12 +155,32 @@ class BreakpointCollection : public IBreakpointCollection {
   std::unordered_map<std::string, std::unique_ptr<BreakpointLocationCollection>>
     location_to_breakpoints_;
 
-  // Activate a breakpoint in a portable pdb file.
-  // This function should only be used if breakpoint is already set, i.e.
-  // the TryGetBreakpoint method is called on the breakpoint.
-  HRESULT ActivateBreakpointHelper(
-      DbgBreakpoint *breakpoint,
-      google_cloud_debugger_portable_pdb::IPortablePdbFile *portable_pdb);
+  // Returns the key used by method_il_offset_to_location_ for the location
+  // at IL offset il_offset in the method with token method_token.
+  static std::uint64_t GetMethodILOffsetKey(mdMethodDef method_token,
+                                            ULONG32 il_offset) {
+    return (static_cast<std::uint64_t>(method_token) << 32) | il_offset;
+  }
+
+  // Secondary index of location_to_breakpoints_ that maps the method token
+  // and IL offset of a location (see GetMethodILOffsetKey) to the
+  // location collection. Used to dispatch a breakpoint hit in constant time.
+  // The pointers are owned by location_to_breakpoints_, which must be
+  // kept in sync with this map.
+  std::unordered_map<std::uint64_t, BreakpointLocationCollection *>
+      method_il_offset_to_location_;
+
+  // Number of breakpoint locations compared against breakpoint hits.
+  // See GetLocationsExamined.
+  std::uint64_t locations_examined_ = 0;
+
+  // Resolves the method token, ICorDebugFunction and name of the method
+  // with definition method_def in the module of portable_pdb by searching
+  // the methods with the same name for one with the same signature and
+  // virtual address.
+  HRESULT ResolveMethod(
+      google_cloud_debugger_portable_pdb::IPortablePdbFile *portable_pdb,
+      uint32_t method_def, MethodTokenCache::Entry *method);
 
   // Helper function to get type definition token, signature, virtual address
   // and name of a method (identified using method_def).
@@ -112,8 +190,10 @@ class BreakpointCollection : public IBreakpointCollection {
                         std::vector<WCHAR> *method_name);
 
   // Helper function to create and initialize a breakpoint client.
+  // framing_version is the version of the pipe protocol the client uses.
   static HRESULT CreateAndInitializeBreakpointClient(
-      std::unique_ptr<BreakpointClient> *client, std::string pipe_name);
+      std::unique_ptr<BreakpointClient> *client, std::string pipe_name,
+      std::uint8_t framing_version);
 
   // COM Pointer to the DebuggerCallback that this breakpoint collection
   // is associated with. This is used to get the list of Portable PDB Files
@@ -126,6 +206,24 @@ class BreakpointCollection : public IBreakpointCollection {
   // Named pipe server for writing breakpoints.
   std::unique_ptr<BreakpointClient> breakpoint_client_write_;
 
+  // True once breakpoint_client_write_ is shut down.
+  bool write_client_shut_down_ = false;
+
+  // Protects breakpoint_client_write_ and write_client_shut_down_.
+  // Held for the whole write of a breakpoint.
+  std::mutex write_mutex_;
+
+  // Writes queued breakpoints with breakpoint_client_write_. Declared
+  // after it so it is destroyed (and finishes writing) first.
+  std::unique_ptr<SnapshotWriter> snapshot_writer_;
+
+  // Protects snapshot_writer_.
+  std::mutex snapshot_writer_mutex_;
+
+  // Limits the condition evaluations, snapshots and stopped time of the
+  // breakpoints in this collection.
+  BreakpointRateLimiter rate_limiter_;
+
   std::mutex mutex_;
 };
 
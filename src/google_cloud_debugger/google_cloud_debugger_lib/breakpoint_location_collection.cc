@@ -79,6 +79,7 @@ HRESULT BreakpointLocationCollection::UpdateBreakpoints(
   new_breakpoint->SetMethodToken(method_token_);
   new_breakpoint->SetMethodName(method_name_);
   new_breakpoint->SetCorDebugBreakpoint(debug_breakpoint_);
+  new_breakpoint->ParseConditionAndExpressions();
 
   hr = ActivateCorDebugBreakpointHelper(breakpoint.Activated());
   if (FAILED(hr)) {
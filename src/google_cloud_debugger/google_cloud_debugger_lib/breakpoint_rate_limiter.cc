@@ -0,0 +1,228 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "breakpoint_rate_limiter.h"
+
+#include <algorithm>
+#include <sstream>
+#include <tuple>
+#include <utility>
+
+using std::lock_guard;
+using std::mutex;
+using std::string;
+using std::chrono::duration;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+namespace google_cloud_debugger {
+
+namespace {
+
+// Appended to the reason a breakpoint is disabled for.
+const char kDisabledSuffix[] =
+    " The breakpoint was disabled to limit the overhead on the application.";
+
+// Returns the number of microseconds in stopped_time as a double, which
+// is the unit the stopped time buckets count in.
+double ToMicroseconds(microseconds stopped_time) {
+  return static_cast<double>(stopped_time.count());
+}
+
+}  // namespace
+
+TokenBucket::TokenBucket(double capacity, double fill_rate, TimePoint now)
+    : capacity_(capacity),
+      fill_rate_(fill_rate),
+      tokens_(capacity),
+      last_fill_(now) {}
+
+bool TokenBucket::TryTake(double tokens, TimePoint now) {
+  Refill(now);
+  if (tokens_ < tokens) {
+    return false;
+  }
+
+  tokens_ -= tokens;
+  return true;
+}
+
+void TokenBucket::Take(double tokens, TimePoint now) {
+  Refill(now);
+  tokens_ -= tokens;
+}
+
+double TokenBucket::Available(TimePoint now) {
+  Refill(now);
+  return tokens_;
+}
+
+void TokenBucket::Refill(TimePoint now) {
+  if (now <= last_fill_) {
+    return;
+  }
+
+  double seconds = duration<double>(now - last_fill_).count();
+  tokens_ = std::min(capacity_, tokens_ + seconds * fill_rate_);
+  last_fill_ = now;
+}
+
+BreakpointRateLimiter::BreakpointBuckets::BreakpointBuckets(
+    const Limits &limits, Clock::time_point now)
+    : conditions(
+          limits.breakpoint_conditions_per_second * limits.burst_seconds,
+          limits.breakpoint_conditions_per_second, now),
+      snapshots(limits.breakpoint_snapshots_per_second * limits.burst_seconds,
+                limits.breakpoint_snapshots_per_second, now),
+      stopped_time(
+          ToMicroseconds(limits.breakpoint_stopped_time_per_second) *
+              limits.stopped_time_burst_seconds,
+          ToMicroseconds(limits.breakpoint_stopped_time_per_second), now) {}
+
+BreakpointRateLimiter::BreakpointRateLimiter()
+    : BreakpointRateLimiter(Limits(), Clock::now) {}
+
+BreakpointRateLimiter::BreakpointRateLimiter(const Limits &limits,
+                                             NowFunction now)
+    : limits_(limits),
+      now_(now),
+      global_conditions_(
+          limits.global_conditions_per_second * limits.burst_seconds,
+          limits.global_conditions_per_second, now_()),
+      global_snapshots_(limits.global_snapshots_per_second *
+                            limits.burst_seconds,
+                        limits.global_snapshots_per_second, now_()),
+      global_stopped_time_(
+          ToMicroseconds(limits.global_stopped_time_per_second) *
+              limits.stopped_time_burst_seconds,
+          ToMicroseconds(limits.global_stopped_time_per_second), now_()) {}
+
+BreakpointRateLimiter::Decision
+BreakpointRateLimiter::AcquireConditionEvaluation(const string &breakpoint_id,
+                                                  string *reason) {
+  lock_guard<mutex> lock(mutex_);
+  Clock::time_point now = now_();
+  BreakpointBuckets *buckets = GetBuckets(breakpoint_id, now);
+  if (buckets->disabled) {
+    *reason = "Breakpoint is being disabled.";
+    return Decision::kSkip;
+  }
+
+  if (GlobalStoppedTimeExceeded(now, reason)) {
+    return Decision::kSkip;
+  }
+
+  if (!buckets->conditions.TryTake(1, now)) {
+    buckets->disabled = true;
+    std::ostringstream message;
+    message << "The condition of the breakpoint was evaluated more than "
+            << limits_.breakpoint_conditions_per_second
+            << " times per second." << kDisabledSuffix;
+    *reason = message.str();
+    return Decision::kDisable;
+  }
+
+  if (!global_conditions_.TryTake(1, now)) {
+    *reason = "Too many breakpoint conditions are being evaluated.";
+    return Decision::kSkip;
+  }
+
+  return Decision::kAllow;
+}
+
+BreakpointRateLimiter::Decision BreakpointRateLimiter::AcquireSnapshot(
+    const string &breakpoint_id, string *reason) {
+  lock_guard<mutex> lock(mutex_);
+  Clock::time_point now = now_();
+  BreakpointBuckets *buckets = GetBuckets(breakpoint_id, now);
+  if (buckets->disabled) {
+    *reason = "Breakpoint is being disabled.";
+    return Decision::kSkip;
+  }
+
+  if (GlobalStoppedTimeExceeded(now, reason)) {
+    return Decision::kSkip;
+  }
+
+  if (!buckets->snapshots.TryTake(1, now)) {
+    buckets->disabled = true;
+    std::ostringstream message;
+    message << "The breakpoint was hit more than "
+            << limits_.breakpoint_snapshots_per_second << " times per second."
+            << kDisabledSuffix;
+    *reason = message.str();
+    return Decision::kDisable;
+  }
+
+  if (!global_snapshots_.TryTake(1, now)) {
+    *reason = "Too many snapshots are being captured.";
+    return Decision::kSkip;
+  }
+
+  return Decision::kAllow;
+}
+
+BreakpointRateLimiter::Decision BreakpointRateLimiter::ChargeStoppedTime(
+    const string &breakpoint_id, microseconds stopped_time, string *reason) {
+  lock_guard<mutex> lock(mutex_);
+  Clock::time_point now = now_();
+  global_stopped_time_.Take(ToMicroseconds(stopped_time), now);
+
+  BreakpointBuckets *buckets = GetBuckets(breakpoint_id, now);
+  buckets->stopped_time.Take(ToMicroseconds(stopped_time), now);
+  if (buckets->disabled || buckets->stopped_time.Available(now) >= 0) {
+    return Decision::kAllow;
+  }
+
+  buckets->disabled = true;
+  std::ostringstream message;
+  message << "The breakpoint stopped the application for more than "
+          << duration_cast<milliseconds>(
+                 limits_.breakpoint_stopped_time_per_second)
+                 .count()
+          << " ms per second." << kDisabledSuffix;
+  *reason = message.str();
+  return Decision::kDisable;
+}
+
+void BreakpointRateLimiter::RemoveBreakpoint(const string &breakpoint_id) {
+  lock_guard<mutex> lock(mutex_);
+  breakpoint_buckets_.erase(breakpoint_id);
+}
+
+BreakpointRateLimiter::BreakpointBuckets *BreakpointRateLimiter::GetBuckets(
+    const string &breakpoint_id, Clock::time_point now) {
+  auto buckets = breakpoint_buckets_.find(breakpoint_id);
+  if (buckets == breakpoint_buckets_.end()) {
+    buckets = breakpoint_buckets_
+                  .emplace(std::piecewise_construct,
+                           std::forward_as_tuple(breakpoint_id),
+                           std::forward_as_tuple(limits_, now))
+                  .first;
+  }
+  return &buckets->second;
+}
+
+bool BreakpointRateLimiter::GlobalStoppedTimeExceeded(Clock::time_point now,
+                                                      string *reason) {
+  if (global_stopped_time_.Available(now) >= 0) {
+    return false;
+  }
+
+  *reason = "Breakpoints stopped the application for too long.";
+  return true;
+}
+
+}  //  namespace google_cloud_debugger
@@ -0,0 +1,208 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BREAKPOINT_RATE_LIMITER_H_
+#define BREAKPOINT_RATE_LIMITER_H_
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace google_cloud_debugger {
+
+// A token bucket. The bucket holds up to capacity tokens and is refilled
+// at fill_rate tokens per second. Time is passed in by the caller so the
+// bucket can be driven by any clock.
+class TokenBucket {
+ public:
+  typedef std::chrono::steady_clock::time_point TimePoint;
+
+  // Creates a full bucket.
+  TokenBucket(double capacity, double fill_rate, TimePoint now);
+
+  // Takes tokens from the bucket if it has that many.
+  // Returns false and leaves the bucket unchanged otherwise.
+  bool TryTake(double tokens, TimePoint now);
+
+  // Takes tokens from the bucket even if that puts the bucket in debt.
+  // The debt is paid back as the bucket is refilled.
+  void Take(double tokens, TimePoint now);
+
+  // Returns the number of tokens in the bucket. This is negative while
+  // the bucket is in debt.
+  double Available(TimePoint now);
+
+ private:
+  // Adds the tokens accumulated since last_fill_.
+  void Refill(TimePoint now);
+
+  // Maximum number of tokens in the bucket.
+  double capacity_;
+
+  // Tokens added per second.
+  double fill_rate_;
+
+  // Tokens in the bucket as of last_fill_.
+  double tokens_;
+
+  // Last time the bucket was refilled.
+  TimePoint last_fill_;
+};
+
+// Limits how much a breakpoint hit may cost the debuggee. Every hit of
+// a breakpoint stops the thread while its condition is evaluated, the
+// stack is walked and the variables are captured, so a breakpoint in a
+// hot loop could otherwise stall the application.
+//
+// Condition evaluations, snapshots and the time the debuggee is stopped
+// are limited per breakpoint and across all breakpoints. A breakpoint
+// that exceeds its own limits should be disabled, since it will keep
+// exceeding them. When only a global limit is exceeded, the hit is
+// skipped instead: the breakpoint is not at fault and the limit frees
+// up again as the buckets refill.
+//
+// This class is thread safe.
+class BreakpointRateLimiter {
+ public:
+  typedef std::chrono::steady_clock Clock;
+
+  // Returns the current time.
+  typedef std::function<Clock::time_point()> NowFunction;
+
+  // What to do with a breakpoint hit.
+  enum class Decision {
+    // Process the hit.
+    kAllow,
+    // Ignore the hit. A global limit is exceeded.
+    kSkip,
+    // Disable the breakpoint. One of its own limits is exceeded.
+    kDisable
+  };
+
+  // The limits of the rate limiter.
+  struct Limits {
+    // Condition evaluations per second of a single breakpoint.
+    double breakpoint_conditions_per_second = 100;
+
+    // Condition evaluations per second of all breakpoints.
+    double global_conditions_per_second = 1000;
+
+    // Snapshots per second of a single breakpoint.
+    double breakpoint_snapshots_per_second = 10;
+
+    // Snapshots per second of all breakpoints.
+    double global_snapshots_per_second = 50;
+
+    // Time a single breakpoint may keep the debuggee stopped every
+    // second, i.e. its share of a CPU.
+    std::chrono::microseconds breakpoint_stopped_time_per_second =
+        std::chrono::milliseconds(50);
+
+    // Time all breakpoints together may keep the debuggee stopped every
+    // second.
+    std::chrono::microseconds global_stopped_time_per_second =
+        std::chrono::milliseconds(200);
+
+    // Number of seconds worth of condition evaluations and snapshots
+    // that can be used in a burst.
+    double burst_seconds = 2;
+
+    // Number of seconds worth of stopped time that can be used in a
+    // burst. This is larger than burst_seconds so a single slow capture
+    // does not disable a breakpoint.
+    double stopped_time_burst_seconds = 10;
+  };
+
+  // Creates a rate limiter with the default limits.
+  BreakpointRateLimiter();
+
+  // Creates a rate limiter with limits that reads the time from now.
+  BreakpointRateLimiter(const Limits &limits, NowFunction now);
+
+  // Called before the condition of breakpoint breakpoint_id is evaluated.
+  // Sets reason if the result is not Decision::kAllow.
+  Decision AcquireConditionEvaluation(const std::string &breakpoint_id,
+                                      std::string *reason);
+
+  // Called before a snapshot of breakpoint breakpoint_id is captured.
+  // Sets reason if the result is not Decision::kAllow.
+  Decision AcquireSnapshot(const std::string &breakpoint_id,
+                           std::string *reason);
+
+  // Charges stopped_time, the time the debuggee was stopped to process
+  // a hit of breakpoint breakpoint_id. Returns Decision::kDisable and
+  // sets reason if the breakpoint used up its stopped time budget.
+  Decision ChargeStoppedTime(const std::string &breakpoint_id,
+                             std::chrono::microseconds stopped_time,
+                             std::string *reason);
+
+  // Forgets the usage of breakpoint breakpoint_id. Called when the
+  // breakpoint is removed.
+  void RemoveBreakpoint(const std::string &breakpoint_id);
+
+ private:
+  // The buckets of a single breakpoint.
+  struct BreakpointBuckets {
+    BreakpointBuckets(const Limits &limits, Clock::time_point now);
+
+    // Condition evaluations of the breakpoint.
+    TokenBucket conditions;
+
+    // Snapshots of the breakpoint.
+    TokenBucket snapshots;
+
+    // Stopped time of the breakpoint in microseconds.
+    TokenBucket stopped_time;
+
+    // True once the breakpoint exceeded one of its limits. Hits that
+    // are already in flight are skipped so it is only disabled once.
+    bool disabled = false;
+  };
+
+  // Returns the buckets of breakpoint breakpoint_id, creating them if
+  // needed. mutex_ must be held.
+  BreakpointBuckets *GetBuckets(const std::string &breakpoint_id,
+                                Clock::time_point now);
+
+  // Returns true if all breakpoints together used up the stopped time
+  // budget. mutex_ must be held.
+  bool GlobalStoppedTimeExceeded(Clock::time_point now, std::string *reason);
+
+  // The limits.
+  Limits limits_;
+
+  // Returns the current time.
+  NowFunction now_;
+
+  // Condition evaluations of all breakpoints.
+  TokenBucket global_conditions_;
+
+  // Snapshots of all breakpoints.
+  TokenBucket global_snapshots_;
+
+  // Stopped time of all breakpoints in microseconds.
+  TokenBucket global_stopped_time_;
+
+  // Buckets of each breakpoint by breakpoint ID.
+  std::unordered_map<std::string, BreakpointBuckets> breakpoint_buckets_;
+
+  // Protects every member above.
+  std::mutex mutex_;
+};
+
+}  //  namespace google_cloud_debugger
+
+#endif  //  BREAKPOINT_RATE_LIMITER_H_
@@ -15,6 +15,8 @@
 #ifndef CONSTANTS_H_
 #define CONSTANTS_H_
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 namespace google_cloud_debugger {
@@ -37,6 +39,24 @@ static const std::string kStartBreakpointMessage = "START_DEBUG_MESSAGE";
 // The end of a breakpoint message.
 static const std::string kEndBreakpointMessage = "END_DEBUG_MESSAGE";
 
+// Version of the pipe protocol that wraps breakpoint messages in
+// kStartBreakpointMessage and kEndBreakpointMessage.
+static const std::uint8_t kSentinelFramingVersion = 1;
+
+// Version of the pipe protocol that prefixes breakpoint messages with a
+// header of kFramedMessageHeaderSize bytes: kFramedMessageMagic, the
+// version and the size of the message as a little-endian 32-bit integer.
+static const std::uint8_t kLengthPrefixedFramingVersion = 2;
+
+// The start of the header of a length-prefixed breakpoint message.
+static const std::string kFramedMessageMagic = "GCD";
+
+// The size of the header of a length-prefixed breakpoint message.
+static const std::size_t kFramedMessageHeaderSize = 8;
+
+// The largest length-prefixed breakpoint message that will be read.
+static const std::uint32_t kMaximumFramedMessageSize = 64 * 1024 * 1024;
+
 // File extension for dll file.
 static const std::string kDllExtension = ".dll";
 
@@ -15,6 +15,8 @@
 #include "cor_debug_helper.h"
 
 #include <assert.h>
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <vector>
 
@@ -333,13 +335,25 @@ HRESULT CorDebugHelper::CreateStrongHandle(ICorDebugValue *debug_value,
 HRESULT CorDebugHelper::ExtractStringFromICorDebugStringValue(
     ICorDebugStringValue *debug_string, std::string *returned_string,
     std::ostream *err_stream) {
-  if (!returned_string || !debug_string || !err_stream) {
+  std::uint32_t string_length;
+  std::uint32_t captured_length;
+  return ExtractStringPrefixFromICorDebugStringValue(
+      debug_string, UINT32_MAX, returned_string, &string_length,
+      &captured_length, err_stream);
+}
+
+HRESULT CorDebugHelper::ExtractStringPrefixFromICorDebugStringValue(
+    ICorDebugStringValue *debug_string, std::uint32_t max_length,
+    std::string *returned_string, std::uint32_t *string_length,
+    std::uint32_t *captured_length, std::ostream *err_stream) {
+  if (!returned_string || !debug_string || !string_length ||
+      !captured_length || !err_stream) {
     return E_INVALIDARG;
   }
 
   HRESULT hr;
   ULONG32 str_len;
-  ULONG32 str_returned_len;
+  ULONG32 str_returned_len = 0;
 
   hr = debug_string->GetLength(&str_len);
   if (FAILED(hr)) {
@@ -347,22 +361,35 @@ HRESULT CorDebugHelper::ExtractStringFromICorDebugStringValue(
     return hr;
   }
 
-  if (str_len == 0) {
-    *returned_string = "";
+  *string_length = str_len;
+  *captured_length = 0;
+  returned_string->clear();
+  if (str_len == 0 || max_length == 0) {
     return S_OK;
   }
 
+  ULONG32 read_len = std::min(str_len, max_length);
+
   // Plus 1 for the NULL at the end of the string.
-  str_len += 1;
-  std::vector<WCHAR> string_value(str_len, 0);
+  std::vector<WCHAR> string_value(read_len + 1, 0);
 
-  hr = debug_string->GetString(str_len, &str_returned_len, string_value.data());
+  hr = debug_string->GetString(string_value.size(), &str_returned_len,
+                               string_value.data());
   if (FAILED(hr)) {
     *err_stream << "Failed to extract the string.";
     return hr;
   }
 
-  *returned_string = ConvertWCharPtrToString(string_value);
+  // Do not split a surrogate pair when the string is truncated.
+  if (read_len < str_len && read_len > 0 &&
+      string_value[read_len - 1] >= 0xD800 &&
+      string_value[read_len - 1] <= 0xDBFF) {
+    --read_len;
+  }
+
+  returned_string->reserve(read_len);
+  AppendWCharToUtf8(string_value.data(), read_len, returned_string);
+  *captured_length = read_len;
   return S_OK;
 }
 
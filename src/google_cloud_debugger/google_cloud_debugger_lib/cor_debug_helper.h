@@ -94,6 +94,14 @@ class CorDebugHelper : public ICorDebugHelper {
       ICorDebugStringValue *debug_string, std::string *returned_string,
       std::ostream *err_stream) override;
 
+  // Extracts out at most the first max_length characters of the string
+  // from ICorDebugStringValue. Only that many characters are read and
+  // they are converted to UTF-8 without intermediate copies.
+  virtual HRESULT ExtractStringPrefixFromICorDebugStringValue(
+      ICorDebugStringValue *debug_string, std::uint32_t max_length,
+      std::string *returned_string, std::uint32_t *string_length,
+      std::uint32_t *captured_length, std::ostream *err_stream) override;
+
   // Given a metadata token for the parameter param_token,
   // extracts out the parameter name.
   // metadata_import is the MetaDataImport of the module
@@ -16,10 +16,18 @@
 
 #include <algorithm>
 #include <assert.h>
+#include <cstring>
 #include <iostream>
 #include <iterator>
 #include <vector>
 
+#ifdef PLATFORM_UNIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "metadata_headers.h"
 
 #include "cor_debug_helper.h"
@@ -30,7 +38,6 @@ using std::cerr;
 using std::ifstream;
 using std::ios;
 using std::min;
-using std::streampos;
 using std::string;
 using std::unique_ptr;
 using std::vector;
@@ -51,30 +58,96 @@ const std::uint32_t kCompressedSignedIntOneByteUncompressMask = 0xFFFFFFC0;
 const std::uint32_t kCompressedSignedIntTwoByteUncompressMask = 0xFFFFE000;
 const std::uint32_t kCompressedSignedIntFourByteUncompressMask = 0xF0000000;
 
-// Size of the buffer used by GetString to read characters into.
-const std::uint32_t kStringBufferSize = 100;
+CustomBinaryStream::~CustomBinaryStream() { Reset(); }
+
+void CustomBinaryStream::Reset() {
+#ifdef PLATFORM_UNIX
+  if (mapped_file_ != nullptr) {
+    munmap(mapped_file_, mapped_size_);
+  }
+#endif
+  mapped_file_ = nullptr;
+  mapped_size_ = 0;
+  owned_bytes_.clear();
+  data_ = nullptr;
+  position_ = 0;
+  absolute_end_ = 0;
+  relative_end_ = 0;
+}
 
 bool CustomBinaryStream::ConsumeStream(std::istream *stream) {
   assert(stream != nullptr);
 
-  stream_.reset(stream);
+  unique_ptr<std::istream> stream_owner(stream);
+  Reset();
 
-  if (stream_->good()) {
-    stream_->unsetf(std::ios::skipws);
-    stream_->seekg(0, stream_->end);
-    absolute_end_ = stream_->tellg();
-    relative_end_ = absolute_end_;
-    stream_->seekg(0, stream_->beg);
-    begin_ = stream_->tellg();
+  if (!stream->good()) {
+    cerr << "Invalid stream.";
+    return false;
+  }
 
-    return true;
+  stream->unsetf(std::ios::skipws);
+  stream->seekg(0, stream->end);
+  std::streamoff size = stream->tellg();
+  stream->seekg(0, stream->beg);
+  if (size < 0 || size > UINT32_MAX) {
+    cerr << "Invalid stream.";
+    return false;
   }
 
-  cerr << "Invalid stream.";
-  return false;
+  owned_bytes_.resize(size);
+  stream->read(reinterpret_cast<char *>(owned_bytes_.data()), size);
+  if (stream->gcount() != size) {
+    owned_bytes_.clear();
+    cerr << "Failed to read the stream.";
+    return false;
+  }
+
+  data_ = owned_bytes_.data();
+  absolute_end_ = size;
+  relative_end_ = absolute_end_;
+  return true;
 }
 
 bool CustomBinaryStream::ConsumeFile(const string &file) {
+#ifdef PLATFORM_UNIX
+  Reset();
+
+  // Let the caller throws the error.
+  int fd = open(file.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return false;
+  }
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) == -1 || file_stat.st_size > UINT32_MAX) {
+    close(fd);
+    return false;
+  }
+
+  // mmap does not accept an empty mapping.
+  if (file_stat.st_size == 0) {
+    close(fd);
+    data_ = owned_bytes_.data();
+    return true;
+  }
+
+  void *mapped_file =
+      mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping keeps the file alive so the descriptor is not needed.
+  close(fd);
+  if (mapped_file == MAP_FAILED) {
+    cerr << "Failed to map file " << file << " into memory.";
+    return false;
+  }
+
+  mapped_file_ = mapped_file;
+  mapped_size_ = file_stat.st_size;
+  data_ = static_cast<const uint8_t *>(mapped_file_);
+  absolute_end_ = file_stat.st_size;
+  relative_end_ = absolute_end_;
+  return true;
+#else
   unique_ptr<std::ifstream> file_stream = unique_ptr<std::ifstream>(
       new (std::nothrow) ifstream(file, ios::in | ios::binary | ios::ate));
   // Let the caller throws the error.
@@ -83,226 +156,215 @@ bool CustomBinaryStream::ConsumeFile(const string &file) {
   }
 
   return ConsumeStream(file_stream.release());
+#endif
 }
 
 bool CustomBinaryStream::ReadBytes(uint8_t *result, uint32_t bytes_to_read,
                                    uint32_t *bytes_read) {
-  assert(stream_ != nullptr);
-  if (relative_end_ - stream_->tellg() < bytes_to_read) {
-    cerr << "End of stream reached.";
+  const uint8_t *data;
+  if (!ReadBytesView(bytes_to_read, &data)) {
+    *bytes_read = 0;
     return false;
   }
 
-  stream_->read(reinterpret_cast<char *>(result), bytes_to_read);
-  *bytes_read = stream_->gcount();
-  return *bytes_read == bytes_to_read;
+  if (bytes_to_read != 0) {
+    memcpy(result, data, bytes_to_read);
+  }
+  *bytes_read = bytes_to_read;
+  return true;
 }
 
-bool CustomBinaryStream::HasNext() const {
-  assert(stream_ != nullptr);
-  return stream_->tellg() < relative_end_;
+bool CustomBinaryStream::ReadBytesView(uint32_t bytes_to_read,
+                                       const uint8_t **data) {
+  if (relative_end_ - position_ < bytes_to_read) {
+    cerr << "End of stream reached.";
+    return false;
+  }
+
+  *data = data_ + position_;
+  position_ += bytes_to_read;
+  return true;
 }
 
+bool CustomBinaryStream::HasNext() const { return position_ < relative_end_; }
+
 bool CustomBinaryStream::Peek(uint8_t *result) const {
-  assert(stream_ != nullptr);
   if (!HasNext()) {
     cerr << "End of stream reached.";
     return false;
   }
 
-  *result = stream_->peek();
+  *result = data_[position_];
   return true;
 }
 
 bool CustomBinaryStream::SeekFromCurrent(uint32_t index) {
-  assert(stream_ != nullptr);
   // Have to take into account the end_ based on the stream
   // length that we set.
-  if (relative_end_ - stream_->tellg() < index) {
+  if (relative_end_ - position_ < index) {
     cerr << "Seeking to a position out of range of the stream.";
     return false;
   }
 
-  stream_->seekg(index, stream_->cur);
-  if (stream_->fail()) {
-    cerr << "Seek operation failed.";
-    stream_->clear();
-    return false;
-  }
-
+  position_ += index;
   return true;
 }
 
 bool CustomBinaryStream::SeekFromOrigin(uint32_t position) {
-  assert(stream_ != nullptr);
-
-  stream_->seekg(position, stream_->beg);
-  if (stream_->fail()) {
+  if (position > absolute_end_) {
     cerr << "Seek operation failed.";
-    stream_->clear();
     return false;
   }
+
+  position_ = position;
   return true;
 }
 
 bool CustomBinaryStream::SetStreamLength(uint32_t length) {
-  assert(stream_ != nullptr);
-
-  streampos cur_pos = stream_->tellg();
-  stream_->seekg(length, stream_->cur);
-  if (stream_->fail()) {
-    stream_->clear();
-    stream_->seekg(cur_pos);
+  if (absolute_end_ - position_ < length) {
     cerr << "Setting stream length to " << length
          << " will set the relative end of the stream to a position"
          << " outside the absolute end of the stream.";
     return false;
   }
 
-  if (stream_->tellg() > relative_end_) {
-    stream_->seekg(cur_pos);
+  if (position_ + length > relative_end_) {
     cerr << "Setting stream length to " << length
          << " will set the relative end of the stream to a position"
          << " outside the relative end of the stream.";
     return false;
   }
 
-  // Sets the relative end and sets the stream back.
-  relative_end_ = stream_->tellg();
-  stream_->seekg(cur_pos);
+  relative_end_ = position_ + length;
   return true;
 }
 
-void CustomBinaryStream::ResetStreamLength() {
-  assert(stream_ != nullptr);
+void CustomBinaryStream::ResetStreamLength() { relative_end_ = absolute_end_; }
 
-  relative_end_ = absolute_end_;
-}
+bool CustomBinaryStream::GetString(std::string *result,
+                                   std::uint32_t offset) const {
+  const char *data;
+  uint32_t length;
+  if (!GetStringView(offset, &data, &length)) {
+    result->clear();
+    return false;
+  }
 
-bool CustomBinaryStream::GetString(std::string *result, std::uint32_t offset) {
-  result->clear();
-  assert(stream_ != nullptr);
+  result->assign(data, length);
+  return true;
+}
 
-  // Makes a copy of the current position so we can restores the stream.
-  streampos previous_pos = stream_->tellg();
-  stream_->seekg(offset, stream_->beg);
-  if (stream_->fail()) {
-    stream_->clear();
-    stream_->seekg(previous_pos);
+bool CustomBinaryStream::GetStringView(uint32_t offset, const char **data,
+                                       uint32_t *length) const {
+  if (offset > relative_end_) {
     cerr << "Failed to seek to the offset point.";
     return false;
   }
 
-  // Read 100 characters at a time or until the end of the stream,
-  // whichever is smaller.
-  uint32_t chars_left = relative_end_ - stream_->tellg();
-  uint32_t char_to_read = min(kStringBufferSize, chars_left);
-  vector<char> buffer(char_to_read, 0);
-
-  while (char_to_read != 0) {
-    // Reads char_to_read bytes from the buffer.
-    stream_->read(buffer.data(), char_to_read);
-    if (stream_->fail()) {
-      stream_->clear();
-      stream_->seekg(previous_pos);
-      cerr << "Failed to read characters from the stream.";
-      return false;
-    }
-
-    // Finds the null character.
-    vector<char>::iterator null_char_pos =
-        std::find(buffer.begin(), buffer.end(), 0);
-
-    result->append(buffer.begin(), null_char_pos);
-    // Stop reading if we found the null character.
-    if (null_char_pos != buffer.end()) {
-      break;
+  // The string ends at the null character or the end of the stream,
+  // whichever comes first.
+  const uint8_t *start = data_ + offset;
+  const uint8_t *end = data_ + relative_end_;
+  const uint8_t *null_char_pos = end;
+  if (start != end) {
+    const void *found = memchr(start, 0, end - start);
+    if (found != nullptr) {
+      null_char_pos = static_cast<const uint8_t *>(found);
     }
-
-    // If we didn't find the null character, continue reading.
-    chars_left = relative_end_ - stream_->tellg();
-    char_to_read = min((uint32_t)buffer.size(), chars_left);
   }
 
-  stream_->seekg(previous_pos);
+  *data = reinterpret_cast<const char *>(start);
+  *length = null_char_pos - start;
   return true;
 }
 
-bool CustomBinaryStream::GetBlobBytes(
-    std::uint32_t offset, std::vector<uint8_t> *result) {
-  result->clear();
-  assert(stream_ != nullptr);
-
-  // Makes a copy of the current position so we can restores the stream.
-  streampos previous_pos = stream_->tellg();
-  stream_->seekg(offset, stream_->beg);
-  if (stream_->fail()) {
-    stream_->clear();
-    stream_->seekg(previous_pos);
-    cerr << "Failed to seek to the offset point.";
+bool CustomBinaryStream::GetBlobBytes(std::uint32_t offset,
+                                      std::vector<uint8_t> *result) const {
+  const uint8_t *data;
+  uint32_t length;
+  if (!GetBlobView(offset, &data, &length)) {
+    result->clear();
     return false;
   }
 
-  uint32_t const_size = 0;
-  if (!ReadCompressedUInt32(&const_size)) {
-      stream_->clear();
-      stream_->seekg(previous_pos);
-      cerr << "Failed to get length of blob.";
-      return false;
+  result->assign(data, data + length);
+  return true;
+}
+
+bool CustomBinaryStream::GetBlobView(uint32_t offset, const uint8_t **data,
+                                     uint32_t *length) const {
+  uint32_t blob_size = 0;
+  if (!DecodeCompressedUInt32(&offset, relative_end_, &blob_size)) {
+    cerr << "Failed to get length of blob.";
+    return false;
   }
 
-  uint32_t bytes_read;
-  result->resize(const_size);
-  if (!ReadBytes(result->data(), const_size, &bytes_read)) {
-    stream_->seekg(previous_pos);
+  if (relative_end_ - offset < blob_size) {
+    cerr << "End of stream reached.";
     return false;
   }
 
-  stream_->seekg(previous_pos);
+  *data = data_ + offset;
+  *length = blob_size;
   return true;
 }
 
 bool CustomBinaryStream::ReadByte(uint8_t *result) {
-  uint32_t bytes_read = 0;
-  return ReadBytes(result, 1, &bytes_read);
+  if (!HasNext()) {
+    cerr << "End of stream reached.";
+    return false;
+  }
+
+  *result = data_[position_++];
+  return true;
 }
 
 bool CustomBinaryStream::ReadUInt16(uint16_t *result) {
-  uint32_t bytes_read = 0;
-  vector<uint8_t> buffer(2, 0);
-  if (!ReadBytes(buffer.data(), 2, &bytes_read)) {
+  const uint8_t *data;
+  if (!ReadBytesView(2, &data)) {
     return false;
   }
 
-  memcpy(result, buffer.data(), 2);
+  memcpy(result, data, 2);
   return true;
 }
 
 bool CustomBinaryStream::ReadUInt32(uint32_t *result) {
-  uint32_t bytes_read = 0;
-  vector<uint8_t> buffer(4, 0);
-  if (!ReadBytes(buffer.data(), 4, &bytes_read)) {
+  const uint8_t *data;
+  if (!ReadBytesView(4, &data)) {
     return false;
   }
 
-  memcpy(result, buffer.data(), 4);
+  memcpy(result, data, 4);
   return true;
 }
 
 bool CustomBinaryStream::ReadCompressedUInt32(uint32_t *uncompress_int) {
-  uint8_t first_byte;
-  if (!ReadByte(&first_byte)) {
+  if (!DecodeCompressedUInt32(&position_, relative_end_, uncompress_int)) {
+    cerr << "End of stream reached.";
+    return false;
+  }
+
+  return true;
+}
+
+bool CustomBinaryStream::DecodeCompressedUInt32(
+    uint32_t *position, uint32_t end, uint32_t *uncompress_int) const {
+  if (*position >= end) {
     return false;
   }
 
+  const uint8_t *bytes = data_ + *position;
+  uint8_t first_byte = bytes[0];
+
   // If the first bit is a 0, return the value. Range 0 - 0x7F.
   if ((first_byte & kCompressedIntOneByteMask) == 0) {
     *uncompress_int = first_byte;
+    *position += 1;
     return true;
   }
 
-  uint8_t second_byte;
-  if (!ReadByte(&second_byte)) {
+  if (end - *position < 2) {
     return false;
   }
 
@@ -310,14 +372,13 @@ bool CustomBinaryStream::ReadCompressedUInt32(uint32_t *uncompress_int) {
   // Mask it with 0b11000000 (0xC0) and confirm the result is 0b10000000 (0x80).
   // Result should be in the range 0x80 - 0x3FFF.
   if ((first_byte & kCompressedIntTwoByteMask) == kCompressedIntOneByteMask) {
-    *uncompress_int = ((first_byte << 8) | second_byte) &
+    *uncompress_int = ((first_byte << 8) | bytes[1]) &
                       kCompressedUIntTwoByteUncompressMask;
+    *position += 2;
     return true;
   }
 
-  uint8_t third_byte;
-  uint8_t fourth_byte;
-  if (!ReadByte(&third_byte) || !ReadByte(&fourth_byte)) {
+  if (end - *position < 4) {
     return false;
   }
 
@@ -325,9 +386,10 @@ bool CustomBinaryStream::ReadCompressedUInt32(uint32_t *uncompress_int) {
   // Mask it with 0b11100000 (0xE0) and confirm the result is 0b11000000 (0xC0).
   // Result should be in the range 0x4000 - 0x1FFFFFFF.
   if ((first_byte & kCompressedIntFourByteMask) == kCompressedIntTwoByteMask) {
-    *uncompress_int = ((first_byte << 24) | (second_byte << 16) |
-                       (third_byte << 8) | fourth_byte) &
+    *uncompress_int = ((first_byte << 24) | (bytes[1] << 16) |
+                       (bytes[2] << 8) | bytes[3]) &
                       kCompressedUIntFourByteUncompressMask;
+    *position += 4;
     return true;
   }
 
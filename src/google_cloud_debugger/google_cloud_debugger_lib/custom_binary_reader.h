@@ -15,6 +15,7 @@
 #ifndef CUSTOM_BINARY_READER_H_
 #define CUSTOM_BINARY_READER_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <fstream>
 #include <iterator>
@@ -37,14 +38,27 @@ enum Heap : std::uint8_t {
   BlobsHeap = 0x04
 };
 
-// Class that consumes a file or a uint8_t vector and produces a
+// Class that consumes a file or a stream and produces a
 // binary stream. This stream is used to read byte, integers,
 // compressed integers and table index.
+//
+// The content is kept in a single contiguous buffer. Files are memory
+// mapped where the platform supports it, so reads are bounds-checked
+// pointer accesses instead of istream calls, and strings and blobs
+// can be exposed as views into the buffer without copying them.
 class CustomBinaryStream {
  public:
+  CustomBinaryStream() = default;
+
+  // Unmaps the file consumed by ConsumeFile, if any.
+  ~CustomBinaryStream();
+
+  CustomBinaryStream(const CustomBinaryStream &) = delete;
+  CustomBinaryStream &operator=(const CustomBinaryStream &) = delete;
+
   // Consumes a binary stream pointer, takes ownership
-  // of the underlying stream and makes it the underlying
-  // stream of this class.
+  // of the underlying stream and copies its content into
+  // the buffer of this class.
   bool ConsumeStream(std::istream *stream);
 
   // Consumes a file and exposes the file content as a binary stream.
@@ -73,12 +87,24 @@ class CustomBinaryStream {
 
   // Gets a string starting from the offset to a null terminating character or the end of the stream.
   // This function does not change the stream pointer.
-  bool GetString(std::string *result, std::uint32_t offset);
+  bool GetString(std::string *result, std::uint32_t offset) const;
+
+  // Similar to GetString but sets data to point to the first character
+  // of the string in the buffer and length to the length of the string.
+  // The view is valid for as long as this stream is alive.
+  bool GetStringView(std::uint32_t offset, const char **data,
+                     std::uint32_t *length) const;
 
   // Gets blob bytes starting from offset in the stream.
   // The first byte will tell us the length of the blob.
   // This function does not change the stream pointer.
-  bool GetBlobBytes(std::uint32_t offset, std::vector<uint8_t> *result);
+  bool GetBlobBytes(std::uint32_t offset, std::vector<uint8_t> *result) const;
+
+  // Similar to GetBlobBytes but sets data to point to the first byte
+  // of the blob in the buffer and length to the length of the blob.
+  // The view is valid for as long as this stream is alive.
+  bool GetBlobView(std::uint32_t offset, const std::uint8_t **data,
+                   std::uint32_t *length) const;
 
   // Reads the next byte in the stream. Returns false if the byte
   // cannot be read.
@@ -89,6 +115,11 @@ class CustomBinaryStream {
   bool ReadBytes(std::uint8_t *result, std::uint32_t bytes_to_read,
                  std::uint32_t *bytes_read);
 
+  // Sets data to point to the next bytes_to_read bytes in the buffer
+  // and advances the stream past them. Returns false if there are
+  // less than bytes_to_read bytes left.
+  bool ReadBytesView(std::uint32_t bytes_to_read, const std::uint8_t **data);
+
   // Reads the next UInt16 from the stream. Returns false if the UInt16
   // cannot be read.
   bool ReadUInt16(std::uint16_t *result);
@@ -124,21 +155,43 @@ class CustomBinaryStream {
                       std::uint32_t *table_index);
 
   // Returns the current position of the stream.
-  std::streampos Current() { return stream_->tellg(); }
+  std::uint32_t Current() const { return position_; }
+
+  // Returns the original length of the stream.
+  std::uint32_t GetLength() const { return absolute_end_; }
 
  private:
-  // The underlying binary stream.
-  std::unique_ptr<std::istream> stream_;
+  // Decodes a compressed unsigned integer starting at *position.
+  // The integer has to end before end. Advances *position past
+  // the integer if it is decoded.
+  bool DecodeCompressedUInt32(std::uint32_t *position, std::uint32_t end,
+                              std::uint32_t *result) const;
+
+  // Releases the buffer of this stream.
+  void Reset();
+
+  // Points to the first byte of the content of this stream.
+  // This is either mapped_file_ or owned_bytes_.data().
+  const std::uint8_t *data_ = nullptr;
+
+  // Buffer that holds the content when it cannot be memory mapped.
+  std::vector<std::uint8_t> owned_bytes_;
+
+  // Address of the memory mapped file, if any.
+  void *mapped_file_ = nullptr;
+
+  // Size of the memory mapped file.
+  std::size_t mapped_size_ = 0;
 
-  // The begin position of the stream.
-  std::streampos begin_;
+  // The current position of the stream.
+  std::uint32_t position_ = 0;
 
   // The absolute end position of the stream.
-  std::streampos absolute_end_;
+  std::uint32_t absolute_end_ = 0;
 
   // The relative end position of the stream (sets by SetStreamLength), which
   // is as far in a PDB file as we need to read.
-  std::streampos relative_end_;
+  std::uint32_t relative_end_ = 0;
 };
 
 }  // namespace google_cloud_debugger_portable_pdb
@@ -14,12 +14,15 @@
 
 #include "dbg_array.h"
 
+#include <cstring>
 #include <iostream>
+#include <limits>
 
 #include "class_names.h"
 #include "dbg_breakpoint.h"
 #include "i_dbg_object_factory.h"
 #include "i_cor_debug_helper.h"
+#include "i_eval_coordinator.h"
 #include "type_signature.h"
 #include "variable_wrapper.h"
 
@@ -156,65 +159,29 @@ HRESULT DbgArray::PopulateMembers(
     return S_OK;
   }
 
-  int total_items = 1;
-  for (int i = 0; i < dimensions_.size(); ++i) {
-    total_items *= dimensions_[i];
-  }
+  int total_items = GetArraySize();
 
-  // We use this dimensions_tracker to help us track which combination
-  // of the array dimensions we are currently at (see comments just before the
-  // while loop).
-  vector<ULONG32> dimensions_tracker(dimensions_.size(), 0);
-
-  int current_index = 0;
   // If this was not set yet, use the current maximum collection size
   // from DbgBreakpoint.
   if (max_items_to_retrieved_ == 0) {
     max_items_to_retrieved_ = DbgBreakpoint::GetMaximumCollectionSize();
   }
 
-  // In this while loop, we visit all possible combinations of the dimensions_
-  // array to print out all the items. For example, let's assume that the array
-  // has dimensions 2x3x4, then the while loop will go in this direction:
-  // 0 0 0 -> 0 0 1 -> 0 0 2 -> 0 0 3 ->
-  // 0 1 0 -> 0 1 1 -> 0 1 2 -> 0 1 3 ->
-  // 0 2 0 -> 0 2 1 -> 0 2 2 -> 0 2 3 ->
-  // 1 0 0 -> 1 0 1 -> 1 0 2 -> 1 0 3 ->
-  // 1 1 0 -> 1 1 1 -> 1 1 2 -> 1 1 3 ->
-  // 1 2 0 -> 1 2 1 -> 1 2 2 -> 1 2 3 ->
-  // 2 0 0 -> 2 0 1 -> 2 0 2 -> 2 0 3 ->
-  // 2 1 0 -> 2 1 1 -> 2 1 2 -> 2 1 3 ->
-  // 2 2 0 -> 2 2 1 -> 2 2 2 -> 2 2 3
-  while (current_index < total_items &&
-         current_index < max_items_to_retrieved_) {
-    // Uses the current combination as the name.
-    string name = "[";
-    for (int index = 0; index < dimensions_tracker.size(); ++index) {
-      name += std::to_string(dimensions_tracker[index]);
-      if (index != dimensions_tracker.size() - 1) {
-        name += ", ";
-      }
-    }
-    name += "]";
+  int item_count = total_items;
+  if (item_count > max_items_to_retrieved_) {
+    item_count = max_items_to_retrieved_;
+  }
 
+  if (PopulatePrimitiveMembers(variable_proto, item_count,
+                               eval_coordinator) == S_OK) {
+    return S_OK;
+  }
+
+  string name;
+  int current_index = 0;
+  while (current_index < item_count) {
+    GetItemName(current_index, &name);
     ++current_index;
-    // Increase the combination by 1. For example: 0 0 0 becomes 0 0 1,
-    // 0 1 0 becomes 0 1 1, 0 1 1 becomes 1 0 0.
-    // First, we will find an index that we can increase.
-    if (current_index < total_items) {
-      int current_dimension_index = dimensions_.size() - 1;
-      while (current_dimension_index >= 0) {
-        // Spill over the addition until we can't.
-        ++dimensions_tracker[current_dimension_index];
-        if (dimensions_tracker[current_dimension_index] ==
-            dimensions_[current_dimension_index]) {
-          dimensions_tracker[current_dimension_index] = 0;
-          current_dimension_index -= 1;
-        } else {
-          break;
-        }
-      }
-    }
 
     // Adds a member at this index.
     Variable *member = variable_proto->add_members();
@@ -249,6 +216,196 @@ HRESULT DbgArray::PopulateMembers(
   return S_OK;
 }
 
+void DbgArray::GetItemName(int position, string *name) {
+  // Items are laid out like C++ arrays, so the last index changes
+  // fastest. For example, the items of a 2x3 array are
+  // [0, 0], [0, 1], [0, 2], [1, 0], [1, 1], [1, 2].
+  name->assign("[");
+  for (int i = 0; i < dimensions_.size(); ++i) {
+    // The number of items covered by one step of the index of
+    // dimension i.
+    int stride = 1;
+    for (int j = i + 1; j < dimensions_.size(); ++j) {
+      stride *= dimensions_[j];
+    }
+
+    if (i != 0) {
+      name->append(", ");
+    }
+    name->append(std::to_string((position / stride) % dimensions_[i]));
+  }
+  name->append("]");
+}
+
+HRESULT DbgArray::PopulatePrimitiveMembers(Variable *variable_proto,
+                                           int item_count,
+                                           IEvalCoordinator *eval_coordinator) {
+  if (item_count <= 0 || item_count > kMaximumPrimitiveItemsToRead ||
+      !empty_object_ || !object_handle_) {
+    return S_FALSE;
+  }
+
+  // Char is left out as its items are 2 bytes while DbgPrimitive
+  // stores them as char.
+  CorElementType item_type = empty_object_->GetCorElementType();
+  ULONG32 item_size = 0;
+  switch (item_type) {
+    case CorElementType::ELEMENT_TYPE_BOOLEAN:
+    case CorElementType::ELEMENT_TYPE_I1:
+    case CorElementType::ELEMENT_TYPE_U1:
+      item_size = 1;
+      break;
+    case CorElementType::ELEMENT_TYPE_I2:
+    case CorElementType::ELEMENT_TYPE_U2:
+      item_size = 2;
+      break;
+    case CorElementType::ELEMENT_TYPE_I4:
+    case CorElementType::ELEMENT_TYPE_U4:
+    case CorElementType::ELEMENT_TYPE_R4:
+      item_size = 4;
+      break;
+    case CorElementType::ELEMENT_TYPE_I8:
+    case CorElementType::ELEMENT_TYPE_U8:
+    case CorElementType::ELEMENT_TYPE_R8:
+      item_size = 8;
+      break;
+    case CorElementType::ELEMENT_TYPE_I:
+    case CorElementType::ELEMENT_TYPE_U:
+      item_size = sizeof(intptr_t);
+      break;
+    default:
+      return S_FALSE;
+  }
+
+  CComPtr<ICorDebugThread> debug_thread;
+  HRESULT hr = eval_coordinator->GetActiveDebugThread(&debug_thread);
+  if (FAILED(hr) || !debug_thread) {
+    return S_FALSE;
+  }
+
+  CComPtr<ICorDebugProcess> debug_process;
+  hr = debug_thread->GetProcess(&debug_process);
+  if (FAILED(hr) || !debug_process) {
+    return S_FALSE;
+  }
+
+  // The items of an array are stored one after another, so all of
+  // them can be read starting from the address of the first one.
+  CComPtr<ICorDebugValue> first_item;
+  hr = GetArrayItem(0, &first_item);
+  if (FAILED(hr) || !first_item) {
+    return S_FALSE;
+  }
+
+  CORDB_ADDRESS first_item_address = 0;
+  ULONG32 first_item_size = 0;
+  hr = first_item->GetAddress(&first_item_address);
+  if (FAILED(hr) || first_item_address == 0) {
+    return S_FALSE;
+  }
+
+  hr = first_item->GetSize(&first_item_size);
+  if (FAILED(hr) || first_item_size != item_size) {
+    return S_FALSE;
+  }
+
+  if (static_cast<size_t>(item_count) >
+      std::numeric_limits<size_t>::max() / item_size) {
+    return S_FALSE;
+  }
+
+  vector<BYTE> buffer(static_cast<size_t>(item_size) * item_count);
+  SIZE_T bytes_read = 0;
+  hr = debug_process->ReadMemory(first_item_address, buffer.size(),
+                                 buffer.data(), &bytes_read);
+  if (FAILED(hr) || bytes_read != buffer.size()) {
+    return S_FALSE;
+  }
+
+  string type_string;
+  hr = empty_object_->GetTypeString(&type_string);
+  if (FAILED(hr)) {
+    return S_FALSE;
+  }
+
+  switch (item_type) {
+    case CorElementType::ELEMENT_TYPE_BOOLEAN:
+      AddPrimitiveMembers<bool>(buffer, item_count, type_string,
+                                variable_proto);
+      break;
+    case CorElementType::ELEMENT_TYPE_I1:
+      AddPrimitiveMembers<int8_t>(buffer, item_count, type_string,
+                                  variable_proto);
+      break;
+    case CorElementType::ELEMENT_TYPE_U1:
+      AddPrimitiveMembers<uint8_t>(buffer, item_count, type_string,
+                                   variable_proto);
+      break;
+    case CorElementType::ELEMENT_TYPE_I2:
+      AddPrimitiveMembers<int16_t>(buffer, item_count, type_string,
+                                   variable_proto);
+      break;
+    case CorElementType::ELEMENT_TYPE_U2:
+      AddPrimitiveMembers<uint16_t>(buffer, item_count, type_string,
+                                    variable_proto);
+      break;
+    case CorElementType::ELEMENT_TYPE_I4:
+      AddPrimitiveMembers<int32_t>(buffer, item_count, type_string,
+                                   variable_proto);
+      break;
+    case CorElementType::ELEMENT_TYPE_U4:
+      AddPrimitiveMembers<uint32_t>(buffer, item_count, type_string,
+                                    variable_proto);
+      break;
+    case CorElementType::ELEMENT_TYPE_I8:
+      AddPrimitiveMembers<int64_t>(buffer, item_count, type_string,
+                                   variable_proto);
+      break;
+    case CorElementType::ELEMENT_TYPE_U8:
+      AddPrimitiveMembers<uint64_t>(buffer, item_count, type_string,
+                                    variable_proto);
+      break;
+    case CorElementType::ELEMENT_TYPE_R4:
+      AddPrimitiveMembers<float>(buffer, item_count, type_string,
+                                 variable_proto);
+      break;
+    case CorElementType::ELEMENT_TYPE_R8:
+      AddPrimitiveMembers<double>(buffer, item_count, type_string,
+                                  variable_proto);
+      break;
+    case CorElementType::ELEMENT_TYPE_I:
+      AddPrimitiveMembers<intptr_t>(buffer, item_count, type_string,
+                                    variable_proto);
+      break;
+    case CorElementType::ELEMENT_TYPE_U:
+      AddPrimitiveMembers<uintptr_t>(buffer, item_count, type_string,
+                                     variable_proto);
+      break;
+    default:
+      return S_FALSE;
+  }
+
+  return S_OK;
+}
+
+template <typename T>
+void DbgArray::AddPrimitiveMembers(const vector<BYTE> &buffer, int item_count,
+                                   const string &type_string,
+                                   Variable *variable_proto) {
+  string name;
+  for (int i = 0; i < item_count; ++i) {
+    T value;
+    memcpy(&value, buffer.data() + i * sizeof(T), sizeof(T));
+
+    // Formatted the same way DbgPrimitive formats them.
+    GetItemName(i, &name);
+    Variable *member = variable_proto->add_members();
+    member->set_name(name);
+    member->set_type(type_string);
+    member->set_value(std::to_string(value));
+  }
+}
+
 HRESULT DbgArray::GetTypeString(std::string *type_string) {
   if (FAILED(initialize_hr_)) {
     return initialize_hr_;
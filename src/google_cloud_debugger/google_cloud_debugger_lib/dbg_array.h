@@ -16,6 +16,7 @@
 #define DBG_ARRAY_H_
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "dbg_reference_object.h"
@@ -38,8 +39,8 @@ class DbgArray : public DbgReferenceObject {
   }
    
   DbgArray(ICorDebugType *debug_type, int depth,
-           std::shared_ptr<ICorDebugHelper> debug_helper,
-           std::shared_ptr<IDbgObjectFactory> object_factory)
+           const std::shared_ptr<ICorDebugHelper> &debug_helper,
+           const std::shared_ptr<IDbgObjectFactory> &object_factory)
       : DbgReferenceObject(debug_type, depth, debug_helper,
                            object_factory) {}
 
@@ -96,7 +97,36 @@ class DbgArray : public DbgReferenceObject {
   // Returns TypeSignature of this array.
   HRESULT GetTypeSignature(TypeSignature *type_signature) override;
 
+  // Maximum number of items of an array of primitives that are read
+  // with a single ReadMemory call. Larger arrays, which can only be
+  // requested by expressions, are retrieved item by item so that the
+  // size of the snapshot is checked for every item.
+  static const int kMaximumPrimitiveItemsToRead = 1000;
+
  private:
+  // Sets name to the indices of the item at position, for example
+  // [1, 2] for position 5 of a 2x3 array.
+  void GetItemName(int position, std::string *name);
+
+  // Populates variable_proto with the first item_count items of an
+  // array of primitives. Instead of creating a DbgObject for every
+  // item, the items are read from the debuggee with a single
+  // ICorDebugProcess::ReadMemory call and formatted directly.
+  // Returns S_FALSE without touching variable_proto if the items are
+  // not primitives, if there are more than kMaximumPrimitiveItemsToRead
+  // of them or if they cannot be read that way.
+  HRESULT PopulatePrimitiveMembers(
+      google::cloud::diagnostics::debug::Variable *variable_proto,
+      int item_count, IEvalCoordinator *eval_coordinator);
+
+  // Adds item_count members whose values are the items of type T
+  // in buffer to variable_proto.
+  template <typename T>
+  void AddPrimitiveMembers(
+      const std::vector<BYTE> &buffer, int item_count,
+      const std::string &type_string,
+      google::cloud::diagnostics::debug::Variable *variable_proto);
+
   // The type of the array.
   CComPtr<ICorDebugType> array_type_;
 
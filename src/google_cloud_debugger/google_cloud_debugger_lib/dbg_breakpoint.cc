@@ -23,10 +23,12 @@
 #include "expression_evaluator.h"
 #include "expression_util.h"
 #include "dbg_class_property.h"
+#include "dbg_object.h"
 #include "i_dbg_stack_frame.h"
 #include "i_eval_coordinator.h"
 #include "i_portable_pdb_file.h"
 #include "i_stack_frame_collection.h"
+#include "snapshot_size_budget.h"
 #include "variable_wrapper.h"
 
 using google::cloud::diagnostics::debug::Breakpoint;
@@ -36,6 +38,7 @@ using google_cloud_debugger_portable_pdb::DocumentIndex;
 using google_cloud_debugger_portable_pdb::LocalConstantRow;
 using google_cloud_debugger_portable_pdb::LocalScopeRow;
 using google_cloud_debugger_portable_pdb::LocalVariableRow;
+using google_cloud_debugger_portable_pdb::SourceIndex;
 using std::string;
 using std::unique_ptr;
 using std::vector;
@@ -45,9 +48,15 @@ namespace google_cloud_debugger {
 std::int32_t DbgBreakpoint::current_max_collection_size_ =
     DbgBreakpoint::kMaximumCollectionSize;
 
+DbgBreakpoint::DbgBreakpoint() {}
+
+DbgBreakpoint::~DbgBreakpoint() {}
+
 void DbgBreakpoint::Initialize(const DbgBreakpoint &other) {
   Initialize(other.file_name_, other.id_, other.line_, other.column_,
              other.condition_, other.expressions_);
+  log_point_ = other.log_point_;
+  log_message_format_ = other.log_message_format_;
 }
 
 void DbgBreakpoint::Initialize(const string &file_name, const string &id,
@@ -63,6 +72,31 @@ void DbgBreakpoint::Initialize(const string &file_name, const string &id,
   column_ = column;
   condition_ = condition;
   expressions_ = expressions;
+  expressions_parsed_ = false;
+}
+
+void DbgBreakpoint::ParseConditionAndExpressions() {
+  condition_evaluator_.reset();
+  if (!condition_.empty()) {
+    condition_evaluator_ = CompileExpression(condition_).evaluator;
+  }
+
+  expression_evaluators_.clear();
+  expression_evaluators_.reserve(expressions_.size());
+  for (auto &expression : expressions_) {
+    expression_evaluators_.push_back(CompileExpression(expression).evaluator);
+  }
+
+  expressions_parsed_ = true;
+  parsed_method_token_ = method_token_;
+  parsed_il_offset_ = il_offset_;
+}
+
+void DbgBreakpoint::ParseConditionAndExpressionsIfNeeded() {
+  if (!expressions_parsed_ || parsed_method_token_ != method_token_ ||
+      parsed_il_offset_ != il_offset_) {
+    ParseConditionAndExpressions();
+  }
 }
 
 HRESULT DbgBreakpoint::GetCorDebugBreakpoint(
@@ -86,81 +120,39 @@ bool DbgBreakpoint::TrySetBreakpoint(
     return false;
   }
 
-  uint32_t current_doc_index_index = -1;
-  uint32_t best_match_index = current_doc_index_index;
-  size_t best_file_name_location_matched = UINT32_MAX;
-
-  // Loop through all the documents and try to find the one that
-  // best matches the breakpoint's file name.
-  for (auto &&document_index : pdb_file->GetDocumentIndexTable()) {
-    ++current_doc_index_index;
-    string document_name = document_index->GetFilePath();
-    // Normalize path separators. The PDB may use either Unix or Windows-style
-    // paths, but the Cloud Debugger only uses Unix.
-    std::replace(document_name.begin(), document_name.end(), '\\', '/');
-    if (document_name.size() < file_name_.size()) {
-      continue;
-    }
-
-    std::transform(
-        document_name.begin(), document_name.end(), document_name.begin(),
-        [](unsigned char c) -> unsigned char { return std::tolower(c); });
-
-    size_t file_name_location = document_name.rfind(file_name_);
-    // Has to matched from the end.
-    if (file_name_location + file_name_.size() != document_name.size()) {
-      continue;
-    }
-
-    // Try to find the best match.
-    // Best match here means the file with the longest path that matches
-    // the file name so file_name_location should be as small as possible.
-    if (file_name_location < best_file_name_location_matched) {
-      // Try to find the best matched method.
-      // This is because the breakpoint can be inside method A but if
-      // method A is defined inside method B then we should use method A
-      // to get the local variables instead of method B. An example is a
-      // delegate function that is defined inside a normal function.
-      bool found_breakpoint = false;
-      uint32_t best_matched_method_first_line = 0;
-      for (auto &&method : document_index->GetMethods()) {
-        if (method.first_line > line_ || method.last_line < line_) {
-          continue;
-        }
-
-        // If this method's first line is greater than the previous one,
-        // this means that this method is inside it.
-        if (method.first_line > best_matched_method_first_line) {
-          // If this is false, it means no sequence points in the method
-          // corresponds to this breakpoint.
-          if (TrySetBreakpointInMethod(method)) {
-            best_matched_method_first_line = method.first_line;
-            found_breakpoint = true;
-          }
-        }
-      }
-
-      if (found_breakpoint) {
-        best_file_name_location_matched = file_name_location;
-        best_match_index = current_doc_index_index;
-      }
-    }
+  // The source index picks the document with the longest path that
+  // matches the breakpoint's file name. Inside that document, it picks
+  // the innermost method that contains the breakpoint. This is because
+  // the breakpoint can be inside method A but if method A is defined
+  // inside method B then we should use method A to get the local
+  // variables instead of method B. An example is a delegate function
+  // that is defined inside a normal function.
+  SourceIndex::Location location;
+  if (!pdb_file->GetSourceIndex().FindLocation(file_name_, line_,
+                                               &location)) {
+    return false;
   }
 
-  return best_match_index != -1;
+  il_offset_ = location.sequence_point->il_offset;
+  line_ = location.sequence_point->start_line;
+  method_def_ = location.method->method_def;
+  return true;
 }
 
 HRESULT DbgBreakpoint::EvaluateExpressions(IDbgStackFrame *stack_frame,
                                            IEvalCoordinator *eval_coordinator,
                                            IDbgObjectFactory *obj_factory) {
-  for (auto &expression : expressions_) {
-    CompiledExpression compiled_expression = CompileExpression(expression);
-    if (compiled_expression.evaluator == nullptr) {
+  ParseConditionAndExpressionsIfNeeded();
+
+  for (size_t i = 0; i < expressions_.size(); ++i) {
+    const string &expression = expressions_[i];
+    ExpressionEvaluator *evaluator = expression_evaluators_[i].get();
+    if (evaluator == nullptr) {
       WriteError("Failed to compile expression: " + expression);
       return E_FAIL;
     }
 
-    // When we call compiled_expression.evaluator->Evaluate below,
+    // When we call evaluator->Evaluate below,
     // this may affect variables in the frame.
     // Because of that, we gets a fresh active frame for each iteration.
     CComPtr<ICorDebugILFrame> active_frame;
@@ -170,16 +162,15 @@ HRESULT DbgBreakpoint::EvaluateExpressions(IDbgStackFrame *stack_frame,
       return hr;
     }
 
-    hr = compiled_expression.evaluator->Compile(stack_frame, active_frame,
-                                                GetErrorStream());
+    hr = evaluator->Compile(stack_frame, active_frame, GetErrorStream());
     if (FAILED(hr)) {
       WriteError("Failed to evaluate expression: " + expression + ".");
       return hr;
     }
 
     std::shared_ptr<DbgObject> expression_obj;
-    hr = compiled_expression.evaluator->Evaluate(
-        &expression_obj, eval_coordinator, obj_factory, GetErrorStream());
+    hr = evaluator->Evaluate(&expression_obj, eval_coordinator, obj_factory,
+                             GetErrorStream());
     if (FAILED(hr)) {
       WriteError("Failed to evaluate expression: " + expression + ".");
       return hr;
@@ -199,8 +190,9 @@ HRESULT DbgBreakpoint::EvaluateCondition(IDbgStackFrame *stack_frame,
     return S_OK;
   }
 
-  CompiledExpression compiled_expression = CompileExpression(condition_);
-  if (compiled_expression.evaluator == nullptr) {
+  ParseConditionAndExpressionsIfNeeded();
+
+  if (condition_evaluator_ == nullptr) {
     // TODO(quoct): Get the error from CompileExpression.
     return E_FAIL;
   }
@@ -211,22 +203,21 @@ HRESULT DbgBreakpoint::EvaluateCondition(IDbgStackFrame *stack_frame,
     return hr;
   }
 
-  hr = compiled_expression.evaluator->Compile(stack_frame, active_frame,
-                                              GetErrorStream());
+  hr = condition_evaluator_->Compile(stack_frame, active_frame,
+                                    GetErrorStream());
   if (FAILED(hr)) {
     return hr;
   }
 
-  const TypeSignature &type_sig =
-      compiled_expression.evaluator->GetStaticType();
+  const TypeSignature &type_sig = condition_evaluator_->GetStaticType();
   if (type_sig.cor_type != CorElementType::ELEMENT_TYPE_BOOLEAN) {
     WriteError("Condition of the breakpoint must be of type boolean.");
     return E_FAIL;
   }
 
   std::shared_ptr<DbgObject> condition_result;
-  hr = compiled_expression.evaluator->Evaluate(
-      &condition_result, eval_coordinator, obj_factory, GetErrorStream());
+  hr = condition_evaluator_->Evaluate(&condition_result, eval_coordinator,
+                                     obj_factory, GetErrorStream());
   if (FAILED(hr)) {
     return hr;
   }
@@ -275,6 +266,85 @@ HRESULT DbgBreakpoint::PopulateBreakpoint(Breakpoint *breakpoint,
   return stack_frames->PopulateStackFrames(breakpoint, eval_coordinator);
 }
 
+HRESULT DbgBreakpoint::PopulateLogMessage(string *message) {
+  if (!message) {
+    return E_INVALIDARG;
+  }
+
+  // Only the value of each expression is printed, so a single
+  // variable is reused to read them instead of building a tree
+  // of members like PopulateExpression does.
+  Variable value_proto;
+  vector<string> arguments;
+  arguments.reserve(expressions_.size());
+  for (auto &&expression : expressions_) {
+    auto value = expressions_map_.find(expression);
+    if (value == expressions_map_.end() || !value->second) {
+      arguments.push_back("<unavailable>");
+      continue;
+    }
+
+    DbgObject *object = value->second.get();
+    if (object->GetIsNull()) {
+      arguments.push_back("null");
+      continue;
+    }
+
+    value_proto.Clear();
+    HRESULT hr = object->PopulateValue(&value_proto);
+    if (FAILED(hr)) {
+      arguments.push_back("<error>");
+      continue;
+    }
+
+    // Classes and arrays have no value of their own, so their type
+    // is printed instead.
+    if (value_proto.value().empty() &&
+        object->GetCorElementType() != CorElementType::ELEMENT_TYPE_STRING) {
+      string type_string;
+      if (SUCCEEDED(object->GetTypeString(&type_string))) {
+        arguments.push_back(type_string);
+        continue;
+      }
+    }
+
+    arguments.push_back(value_proto.value());
+  }
+
+  *message = FormatLogMessage(log_message_format_, arguments);
+  return S_OK;
+}
+
+string DbgBreakpoint::FormatLogMessage(const string &format,
+                                       const vector<string> &arguments) {
+  string message;
+  message.reserve(format.size());
+  for (size_t i = 0; i < format.size(); ++i) {
+    if (format[i] != '$' || i + 1 == format.size()) {
+      message += format[i];
+      continue;
+    }
+
+    char next = format[i + 1];
+    if (next == '$') {
+      message += '$';
+      ++i;
+    } else if (std::isdigit(static_cast<unsigned char>(next))) {
+      size_t index = next - '0';
+      if (index < arguments.size()) {
+        message += arguments[index];
+      } else {
+        message += format.substr(i, 2);
+      }
+      ++i;
+    } else {
+      message += '$';
+    }
+  }
+
+  return message;
+}
+
 HRESULT DbgBreakpoint::PopulateExpression(Breakpoint *breakpoint,
                                           IEvalCoordinator *eval_coordinator) {
   std::queue<VariableWrapper> bfs_queue;
@@ -293,12 +363,9 @@ HRESULT DbgBreakpoint::PopulateExpression(Breakpoint *breakpoint,
 
   if (bfs_queue.size() != 0) {
     current_max_collection_size_ = kMaximumCollectionExpressionSize;
-    HRESULT hr = VariableWrapper::PerformBFS(
-        &bfs_queue,
-        [breakpoint]() {
-          return breakpoint->ByteSize() > DbgBreakpoint::kMaximumBreakpointSize;
-        },
-        eval_coordinator);
+    SnapshotSizeBudget budget(kMaximumBreakpointSize, breakpoint->ByteSize());
+    HRESULT hr =
+        VariableWrapper::PerformBFS(&bfs_queue, &budget, eval_coordinator);
     current_max_collection_size_ = kMaximumCollectionSize;
     return hr;
   }
@@ -306,22 +373,4 @@ HRESULT DbgBreakpoint::PopulateExpression(Breakpoint *breakpoint,
   return S_OK;
 }
 
-bool DbgBreakpoint::TrySetBreakpointInMethod(
-    const google_cloud_debugger_portable_pdb::MethodInfo &method) {
-  const auto &find_seq = std::find_if(
-      method.sequence_points.begin(), method.sequence_points.end(),
-      [&](const google_cloud_debugger_portable_pdb::SequencePoint &seq) {
-        return !seq.is_hidden && seq.start_line >= line_;
-      });
-
-  if (find_seq == method.sequence_points.end()) {
-    return false;
-  }
-
-  il_offset_ = find_seq->il_offset;
-  line_ = find_seq->start_line;
-  method_def_ = method.method_def;
-  return true;
-}
-
 }  // namespace google_cloud_debugger
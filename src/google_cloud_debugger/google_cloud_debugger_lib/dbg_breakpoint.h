@@ -16,6 +16,7 @@
 #define DBG_BREAKPOINT_H_
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -28,7 +29,6 @@
 
 namespace google_cloud_debugger_portable_pdb {
 class IPortablePdbFile;
-struct MethodInfo;
 };  // namespace google_cloud_debugger_portable_pdb
 
 namespace google_cloud_debugger {
@@ -38,6 +38,7 @@ class IStackFrameCollection;
 class IDbgStackFrame;
 class IDbgObjectFactory;
 class DbgObject;
+class ExpressionEvaluator;
 
 // This class represents a breakpoint in the Debugger.
 // To use the class, call the Initialize method to populate the
@@ -45,6 +46,10 @@ class DbgObject;
 // To actually set the breakpoint, the TrySetBreakpoint method must be called.
 class DbgBreakpoint : public StringStreamWrapper {
  public:
+  DbgBreakpoint();
+
+  ~DbgBreakpoint();
+
   // Populate this breakpoint with the other breakpoint's file name,
   // id, line and column.
   void Initialize(const DbgBreakpoint &other);
@@ -126,7 +131,10 @@ class DbgBreakpoint : public StringStreamWrapper {
   const std::string &GetCondition() const { return condition_; }
 
   // Sets the condition of the breakpoint.
-  void SetCondition(const std::string &condition) { condition_ = condition; }
+  void SetCondition(const std::string &condition) {
+    condition_ = condition;
+    expressions_parsed_ = false;
+  }
 
   // Gets the result of the evaluated condition.
   // This should only be called after EvaluateCondition is called.
@@ -140,8 +148,38 @@ class DbgBreakpoint : public StringStreamWrapper {
   // Sets the expressions of the breakpoint.
   void SetExpressions(const std::vector<std::string> &expressions) {
     expressions_ = expressions;
+    expressions_parsed_ = false;
+  }
+
+  // Returns true if this breakpoint is a logpoint. A logpoint only
+  // evaluates its expressions against the top frame and logs a message
+  // instead of capturing a snapshot.
+  bool IsLogPoint() const { return log_point_; }
+
+  // Sets whether this breakpoint is a logpoint.
+  void SetLogPoint(bool log_point) { log_point_ = log_point; }
+
+  // Returns the format of the message logged by a logpoint.
+  const std::string &GetLogMessageFormat() const {
+    return log_message_format_;
+  }
+
+  // Sets the format of the message logged by a logpoint.
+  // See FormatLogMessage for the syntax.
+  void SetLogMessageFormat(const std::string &log_message_format) {
+    log_message_format_ = log_message_format;
   }
 
+  // Parses condition_ and expressions_ into expression evaluators.
+  // The evaluators are reused every time the breakpoint is hit so
+  // only ExpressionEvaluator::Compile has to be run against the
+  // stack frame of the hit. The evaluators also keep the metadata
+  // (fields, properties and methods) they bind to between hits,
+  // so this has to be called again if the breakpoint moves to another
+  // method or IL offset. Expressions that cannot be parsed are
+  // reported when the breakpoint is evaluated.
+  void ParseConditionAndExpressions();
+
   // Returns a string representation of the breakpoint location
   // by concatenating file name and line number.
   std::string GetBreakpointLocation() const {
@@ -171,6 +209,16 @@ class DbgBreakpoint : public StringStreamWrapper {
       google::cloud::diagnostics::debug::Breakpoint *breakpoint,
       IStackFrameCollection *stack_frames, IEvalCoordinator *eval_coordinator);
 
+  // Formats the message of a logpoint into message using the values of
+  // the expressions evaluated by EvaluateExpressions. Unlike
+  // PopulateBreakpoint, no stack frame or variable is captured.
+  HRESULT PopulateLogMessage(std::string *message);
+
+  // Formats a logpoint message. $0 to $9 in format are replaced by
+  // the corresponding entry of arguments and $$ by a single $.
+  static std::string FormatLogMessage(
+      const std::string &format, const std::vector<std::string> &arguments);
+
   // Breakpoint proto's size should not contain more bytes of
   // information than this number. (65536 bytes = 64kb).
   static const std::uint32_t kMaximumBreakpointSize = 65536;
@@ -188,10 +236,9 @@ class DbgBreakpoint : public StringStreamWrapper {
       google::cloud::diagnostics::debug::Breakpoint *breakpoint,
       IEvalCoordinator *eval_coordinator);
    
-  // Given a method, try to see whether we can set this breakpoint in
-  // the method.
-  bool TrySetBreakpointInMethod(
-      const google_cloud_debugger_portable_pdb::MethodInfo &method);
+  // Calls ParseConditionAndExpressions if the condition and expressions
+  // have not been parsed for the current method token and IL offset.
+  void ParseConditionAndExpressionsIfNeeded();
 
   // The line number of the breakpoint.
   uint32_t line_;
@@ -206,13 +253,13 @@ class DbgBreakpoint : public StringStreamWrapper {
   std::string id_;
 
   // The IL Offset of this breakpoint.
-  uint32_t il_offset_;
+  uint32_t il_offset_ = 0;
 
   // The method definition of the method this breakpoint is in.
-  uint32_t method_def_;
+  uint32_t method_def_ = 0;
 
   // The method token of the method this breakpoint is in.
-  mdMethodDef method_token_;
+  mdMethodDef method_token_ = 0;
 
   // Condition of a breakpoint. If false, don't report information back.
   std::string condition_;
@@ -220,6 +267,22 @@ class DbgBreakpoint : public StringStreamWrapper {
   // Expressions of a breakpoint.
   std::vector<std::string> expressions_;
 
+  // True if condition_ and expressions_ have been parsed into
+  // condition_evaluator_ and expression_evaluators_.
+  bool expressions_parsed_ = false;
+
+  // Method token and IL offset the evaluators were parsed for.
+  // The metadata bound by the evaluators is only valid there.
+  mdMethodDef parsed_method_token_ = 0;
+  uint32_t parsed_il_offset_ = 0;
+
+  // Parsed condition_. Null if condition_ is empty or cannot be parsed.
+  std::unique_ptr<ExpressionEvaluator> condition_evaluator_;
+
+  // Parsed expressions_, in the same order as expressions_.
+  // An evaluator is null if its expression cannot be parsed.
+  std::vector<std::unique_ptr<ExpressionEvaluator>> expression_evaluators_;
+
   // Map where key is the expression and value is its evaluated value.
   std::unordered_map<std::string, std::shared_ptr<DbgObject>> expressions_map_;
 
@@ -238,6 +301,12 @@ class DbgBreakpoint : public StringStreamWrapper {
   // True if this breakpoint should kill the server it was sent to.
   bool kill_server_ = false;
 
+  // True if this breakpoint is a logpoint.
+  bool log_point_ = false;
+
+  // Format of the message logged by a logpoint.
+  std::string log_message_format_;
+
   // The current maximum number of items in a collection that we will expand.
   static std::int32_t current_max_collection_size_;
 
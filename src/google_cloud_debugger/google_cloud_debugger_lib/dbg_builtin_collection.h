@@ -27,8 +27,8 @@ namespace google_cloud_debugger {
 class DbgBuiltinCollection : public DbgClass {
  public:
   DbgBuiltinCollection(ICorDebugType *debug_type, int depth,
-                       std::shared_ptr<ICorDebugHelper> debug_helper,
-                       std::shared_ptr<IDbgObjectFactory> obj_factory)
+                       const std::shared_ptr<ICorDebugHelper> &debug_helper,
+                       const std::shared_ptr<IDbgObjectFactory> &obj_factory)
       : DbgClass(debug_type, depth, debug_helper, obj_factory) {}
 
   HRESULT PopulateMembers(
@@ -15,7 +15,6 @@
 #include "dbg_class.h"
 
 #include <algorithm>
-#include <array>
 #include <cstdint>
 #include <iostream>
 
@@ -28,7 +27,6 @@
 #include "variable_wrapper.h"
 
 using google::cloud::diagnostics::debug::Variable;
-using std::array;
 using std::char_traits;
 using std::min;
 using std::shared_ptr;
@@ -38,10 +36,9 @@ using std::vector;
 
 namespace google_cloud_debugger {
 
-std::unordered_map<
-    std::string,
-    std::unordered_map<std::string, std::shared_ptr<IDbgClassMember>>>
-    DbgClass::static_class_members_;
+StaticMemberCache DbgClass::static_member_cache_;
+
+TypeLayoutCache DbgClass::type_layout_cache_;
 
 HRESULT DbgClass::GetNonStaticField(const std::string &field_name,
                                     std::shared_ptr<DbgObject> *field_value) {
@@ -148,130 +145,84 @@ HRESULT DbgClass::GetGenericTypes(
   return S_OK;
 }
 
+HRESULT DbgClass::GetTypeLayout(IMetaDataImport *metadata_import) {
+  if (type_layout_) {
+    return S_OK;
+  }
+
+  return type_layout_cache_.GetTypeLayout(debug_module_, metadata_import,
+                                          class_token_, &type_layout_,
+                                          GetErrorStream());
+}
+
 HRESULT DbgClass::ProcessFields(IMetaDataImport *metadata_import,
                                 ICorDebugObjectValue *debug_obj_value,
                                 ICorDebugClass *debug_class) {
-  CComPtr<ICorDebugType> debug_type;
-  HCORENUM cor_enum = nullptr;
+  HRESULT hr = GetTypeLayout(metadata_import);
+  if (FAILED(hr)) {
+    return hr;
+  }
 
+  CComPtr<ICorDebugType> debug_type;
   debug_type = GetDebugType();
-  while (true) {
-    HRESULT hr;
-    array<mdFieldDef, 100> field_defs;
-    ULONG field_defs_returned = 0;
-
-    hr = metadata_import->EnumFields(&cor_enum, class_token_, field_defs.data(),
-                                     field_defs.size(), &field_defs_returned);
-    if (FAILED(hr)) {
-      WriteError("Failed to enumerate class fields.");
-      return hr;
+  class_fields_.reserve(class_fields_.size() + type_layout_->fields.size());
+  for (const FieldLayout &field_layout : type_layout_->fields) {
+    unique_ptr<DbgClassField> class_field(new (std::nothrow) DbgClassField(
+        field_layout.field_def, GetCreationDepth() - 1, debug_type,
+        debug_helper_, object_factory_));
+    if (!class_field) {
+      WriteError("Run out of memory when trying to create field ");
+      WriteError(std::to_string(field_layout.field_def));
+      return E_OUTOFMEMORY;
     }
 
-    if (field_defs_returned != 0) {
-      class_fields_.reserve(class_fields_.size() + field_defs_returned);
-
-      for (int i = 0; i < field_defs_returned; ++i) {
-        unique_ptr<DbgClassField> class_field(new (std::nothrow) DbgClassField(
-            field_defs[i], GetCreationDepth() - 1, debug_type, debug_helper_,
-            object_factory_));
-        if (!class_field) {
-          WriteError("Run out of memory when trying to create field ");
-          WriteError(std::to_string(field_defs[i]));
-          return E_OUTOFMEMORY;
-        }
-
-        class_field->Initialize(debug_module_, metadata_import, debug_obj_value,
-                                debug_class);
-        if (class_field->IsBackingField()) {
-          // Insert class names into set so we can use it to check later
-          // for backing fields.
-          class_backing_fields_names_.insert(class_field->GetMemberName());
-        }
-
-        AddStaticClassMemberToVector(std::move(class_field), &class_fields_);
-      }
-    } else {
-      break;
-    }
-  }
-
-  if (cor_enum) {
-    metadata_import->CloseEnum(cor_enum);
+    class_field->Initialize(field_layout, debug_module_, metadata_import,
+                            debug_obj_value, debug_class);
+    AddStaticClassMemberToVector(std::move(class_field), &class_fields_);
   }
 
   return S_OK;
 }
 
 HRESULT DbgClass::ProcessProperties(IMetaDataImport *metadata_import) {
-  HRESULT hr;
-  array<mdProperty, 100> property_defs;
-  HCORENUM cor_enum = nullptr;
-  ULONG property_defs_returned = 0;
-
-  while (true) {
-    hr = metadata_import->EnumProperties(
-        &cor_enum, class_token_, property_defs.data(), property_defs.size(),
-        &property_defs_returned);
-    if (FAILED(hr)) {
-      WriteError("Failed to enumerate class properties.");
-      return hr;
-    }
-
-    if (property_defs_returned != 0) {
-      class_properties_.reserve(class_properties_.size() +
-                                property_defs_returned);
-
-      for (int i = 0; i < property_defs_returned; ++i) {
-        unique_ptr<DbgClassProperty> class_property(new (
-            std::nothrow) DbgClassProperty(debug_helper_, object_factory_));
-        if (!class_property) {
-          WriteError(
-              "Ran out of memory while trying to initialize class property ");
-          WriteError(std::to_string(property_defs[i]));
-          return E_OUTOFMEMORY;
-        }
+  HRESULT hr = GetTypeLayout(metadata_import);
+  if (FAILED(hr)) {
+    return hr;
+  }
 
-        class_property->Initialize(property_defs[i], metadata_import,
-                                   debug_module_, GetCreationDepth() - 1);
-        // If property name is MyProperty, checks whether there is a backing
-        // field with the name <MyProperty>k__BackingField. Note that we have
-        // logic to process backing fields' names to strip out the "<" and
-        // ">k__BackingField" of the field name and places them in the set
-        // class_backing_fields_names. Hence, we only need to check whether
-        // MyProperty is in this set or not. If it is, then it is backed
-        // by a field already, so don't add it to class_properties_.
-        if (class_backing_fields_names_.find(class_property->GetMemberName()) !=
-            class_backing_fields_names_.end()) {
-          continue;
-        }
+  // Properties that are backed by a field are not in the layout since
+  // the fields already show them.
+  class_properties_.reserve(class_properties_.size() +
+                            type_layout_->properties.size());
+  for (const PropertyLayout &property_layout : type_layout_->properties) {
+    unique_ptr<DbgClassProperty> class_property(
+        new (std::nothrow) DbgClassProperty(debug_helper_, object_factory_));
+    if (!class_property) {
+      WriteError(
+          "Ran out of memory while trying to initialize class property ");
+      WriteError(std::to_string(property_layout.property_def));
+      return E_OUTOFMEMORY;
+    }
 
-        if (class_property->IsStatic()) {
-          // Checks whether we already have a shared pointer of this property
-          // in the cache. If not, moves the unique_ptr there.
-          shared_ptr<IDbgClassMember> static_property_value =
-              GetStaticClassMember(module_name_, class_name_,
-                                   class_property->GetMemberName());
-          if (!static_property_value) {
-            std::string property_name = class_property->GetMemberName();
-            static_property_value =
-                shared_ptr<IDbgClassMember>(class_property.release());
-            StoreStaticClassMember(module_name_, class_name_, property_name,
-                                   static_property_value);
-          }
-          class_properties_.emplace_back(static_property_value);
-        } else {
-          class_properties_.push_back(std::move(class_property));
-        }
+    class_property->Initialize(property_layout, debug_module_,
+                               GetCreationDepth() - 1);
+    if (SUCCEEDED(class_property->GetInitializeHr()) &&
+        class_property->IsStatic()) {
+      // Checks whether we already have a shared pointer of this property
+      // in the cache. If not, moves the unique_ptr there.
+      unique_ptr<IDbgClassMember> class_member(class_property.release());
+      shared_ptr<IDbgClassMember> static_property_value =
+          GetOrAddStaticClassMember(&class_member);
+      if (static_property_value) {
+        class_properties_.emplace_back(static_property_value);
+      } else {
+        class_properties_.push_back(std::move(class_member));
       }
     } else {
-      break;
+      class_properties_.push_back(std::move(class_property));
     }
   }
 
-  if (cor_enum != nullptr) {
-    metadata_import->CloseEnum(cor_enum);
-  }
-
   return S_OK;
 }
 
@@ -458,17 +409,25 @@ ULONG64 DbgClass::ExtractEnumValue(CorElementType enum_type, void *enum_value) {
   }
 }
 
-void DbgClass::StoreStaticClassMember(const string &module_name,
-                                      const string &class_name,
-                                      const string &member_name,
-                                      shared_ptr<IDbgClassMember> object) {
-  string key = GetStaticCacheKey(module_name, class_name);
-  if (static_class_members_.find(key) == static_class_members_.end()) {
-    static_class_members_[key] =
-        std::unordered_map<string, shared_ptr<IDbgClassMember>>();
+shared_ptr<IDbgClassMember> DbgClass::GetOrAddStaticClassMember(
+    unique_ptr<IDbgClassMember> *class_member) {
+  if (!static_members_) {
+    static_members_ =
+        static_member_cache_.GetClassMembers(module_name_, class_name_);
+    if (!static_members_) {
+      return shared_ptr<IDbgClassMember>();
+    }
   }
 
-  static_class_members_[key][member_name] = object;
+  string member_name = (*class_member)->GetMemberName();
+  shared_ptr<IDbgClassMember> static_member_value =
+      static_members_->Find(member_name);
+  if (static_member_value) {
+    return static_member_value;
+  }
+
+  return static_members_->Add(
+      member_name, shared_ptr<IDbgClassMember>(class_member->release()));
 }
 
 void DbgClass::AddStaticClassMemberToVector(
@@ -478,18 +437,15 @@ void DbgClass::AddStaticClassMemberToVector(
   if (class_member->IsStatic()) {
     // Checks whether we already have a shared pointer of this field
     // in the cache. If not, moves the unique_ptr there.
-    shared_ptr<IDbgClassMember> static_member_value = GetStaticClassMember(
-        module_name_, class_name_, class_member->GetMemberName());
-    if (!static_member_value) {
-      std::string field_name = class_member->GetMemberName();
-      static_member_value = shared_ptr<IDbgClassMember>(class_member.release());
-      StoreStaticClassMember(module_name_, class_name_, field_name,
-                             static_member_value);
+    shared_ptr<IDbgClassMember> static_member_value =
+        GetOrAddStaticClassMember(&class_member);
+    if (static_member_value) {
+      class_fields_.emplace_back(static_member_value);
+      return;
     }
-    class_fields_.emplace_back(static_member_value);
-  } else {
-    class_fields_.push_back(std::move(class_member));
   }
+
+  class_fields_.push_back(std::move(class_member));
 }
 
 void DbgClass::PopulateClassMembers(
@@ -514,19 +470,6 @@ void DbgClass::PopulateClassMembers(
   }
 }
 
-shared_ptr<IDbgClassMember> DbgClass::GetStaticClassMember(
-    const string &module_name, const string &class_name,
-    const string &member_name) {
-  string key = GetStaticCacheKey(module_name, class_name);
-  if (static_class_members_.find(key) == static_class_members_.end() ||
-      static_class_members_[key].find(member_name) ==
-          static_class_members_[key].end()) {
-    return shared_ptr<IDbgClassMember>();
-  }
-
-  return static_class_members_[key][member_name];
-}
-
 HRESULT DbgClass::PopulateMembers(Variable *variable_proto,
                                   std::vector<VariableWrapper> *members,
                                   IEvalCoordinator *eval_coordinator) {
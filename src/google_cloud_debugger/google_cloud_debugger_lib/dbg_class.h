@@ -17,13 +17,14 @@
 
 #include <memory>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 #include "dbg_class_field.h"
 #include "dbg_class_property.h"
 #include "dbg_primitive.h"
 #include "dbg_reference_object.h"
+#include "static_member_cache.h"
+#include "type_layout_cache.h"
 
 namespace google_cloud_debugger {
 
@@ -36,8 +37,8 @@ namespace google_cloud_debugger {
 class DbgClass : public DbgReferenceObject {
  public:
   DbgClass(ICorDebugType *debug_type, int depth,
-           std::shared_ptr<ICorDebugHelper> debug_helper,
-           std::shared_ptr<IDbgObjectFactory> obj_factory)
+           const std::shared_ptr<ICorDebugHelper> &debug_helper,
+           const std::shared_ptr<IDbgObjectFactory> &obj_factory)
       : DbgReferenceObject(debug_type, depth, debug_helper, obj_factory) {}
 
   // This function populates parameterized type of the class if needed.
@@ -105,7 +106,18 @@ class DbgClass : public DbgReferenceObject {
   };
 
   // Clear cache of static field and properties.
-  static void ClearStaticCache() { static_class_members_.clear(); }
+  static void ClearStaticCache() { static_member_cache_.Clear(); }
+
+  // Returns the cache of the static fields and properties of all
+  // DbgClass objects.
+  static StaticMemberCache *GetStaticMemberCache() {
+    return &static_member_cache_;
+  }
+
+  // Returns the cache of the fields and properties of the types
+  // of all DbgClass objects. Unlike the static cache, this is only
+  // invalidated when a module is unloaded.
+  static TypeLayoutCache *GetTypeLayoutCache() { return &type_layout_cache_; }
 
   // Sets the name of the module this class is in.
   void SetModuleName(const std::string &module_name) {
@@ -145,19 +157,6 @@ class DbgClass : public DbgReferenceObject {
   std::unique_ptr<DbgObject> primitive_type_value_;
 
  protected:
-  // Creates a key to the static cache from the module name and the class name.
-  static std::string GetStaticCacheKey(const std::string &module_name,
-                                       const std::string &class_name) {
-    return module_name + "!" + class_name;
-  }
-
-  // Stores the static member member_name of class class_name in module
-  // module_name with value object in the static cache.
-  static void StoreStaticClassMember(const std::string &module_name,
-                                     const std::string &class_name,
-                                     const std::string &member_name,
-                                     std::shared_ptr<IDbgClassMember> object);
-
   // Given a class_member with name member_name in this class,
   // we check whether this class_member is in the cache.
   // If it is in the cache, then we place a copy of the shared pointer
@@ -177,11 +176,15 @@ class DbgClass : public DbgReferenceObject {
       std::vector<VariableWrapper> *members, IEvalCoordinator *eval_coordinator,
       std::vector<std::shared_ptr<IDbgClassMember>> *class_members);
 
-  // Extracts the static field member_name of class class_name in module
-  // module_name in the static cache.
-  std::shared_ptr<IDbgClassMember> GetStaticClassMember(
-      const std::string &module_name, const std::string &class_name,
-      const std::string &member_name);
+  // Returns the member in the static cache that has the same name as
+  // class_member. If there is none, moves class_member to the cache.
+  // Returns null if the cache cannot be used.
+  std::shared_ptr<IDbgClassMember> GetOrAddStaticClassMember(
+      std::unique_ptr<IDbgClassMember> *class_member);
+
+  // Sets type_layout_ to the layout of this class from type_layout_cache_
+  // if it is not set yet.
+  HRESULT GetTypeLayout(IMetaDataImport *metadata_import);
 
   // Processes the class fields and stores the fields in class_fields_.
   HRESULT ProcessFields(IMetaDataImport *metadata_import,
@@ -226,8 +229,8 @@ class DbgClass : public DbgReferenceObject {
   std::vector<std::shared_ptr<IDbgClassMember>> class_fields_;
   std::vector<std::shared_ptr<IDbgClassMember>> class_properties_;
 
-  // Sets of all the fields' names.
-  std::unordered_set<std::string> class_backing_fields_names_;
+  // Fields and properties of the type of this class.
+  std::shared_ptr<const TypeLayout> type_layout_;
 
   // Vector of objects representing all generic types of the class.
   // This is used for printing out the class name.
@@ -243,13 +246,15 @@ class DbgClass : public DbgReferenceObject {
   // ProcessClassMembers multiple times.
   bool processed_ = false;
 
-  // Cache of static class members.
-  // First key is the module name and class name.
-  // Second key is the member name.
-  static std::unordered_map<
-      std::string,
-      std::unordered_map<std::string, std::shared_ptr<IDbgClassMember>>>
-      static_class_members_;
+  // The static members of this class in static_member_cache_.
+  // Looked up once per object rather than once per member.
+  std::shared_ptr<StaticMemberCache::ClassMembers> static_members_;
+
+  // Cache of static class members of all classes.
+  static StaticMemberCache static_member_cache_;
+
+  // Cache of the fields and properties of types by module and type token.
+  static TypeLayoutCache type_layout_cache_;
 };
 
 }  //  namespace google_cloud_debugger
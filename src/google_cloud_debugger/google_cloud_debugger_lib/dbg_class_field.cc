@@ -56,50 +56,35 @@ void DbgClassField::Initialize(ICorDebugModule *debug_module,
     return;
   }
 
-  CComPtr<ICorDebugValue> field_value;
-  ULONG len_field_name;
+  FieldLayout layout;
+  TypeLayoutCache::ReadFieldLayout(metadata_import, field_def_, &layout);
+  Initialize(layout, debug_module, metadata_import, debug_obj_value,
+             debug_class);
+}
 
-  // First call to get length of array.
-  initialized_hr_ = metadata_import->GetFieldProps(
-      field_def_, &parent_token_, nullptr, 0, &len_field_name,
-      &member_attributes_, &signature_metadata_, &sig_metadata_length_,
-      &default_value_type_flags_, &default_value_, &default_value_len_);
+void DbgClassField::Initialize(const FieldLayout &layout,
+                               ICorDebugModule *debug_module,
+                               IMetaDataImport *metadata_import,
+                               ICorDebugObjectValue *debug_obj_value,
+                               ICorDebugClass *debug_class) {
+  initialized_hr_ = layout.hr;
   if (FAILED(initialized_hr_)) {
     WriteError("Failed to populate field metadata.");
     return;
   }
 
-  std::vector<WCHAR> wchar_field_name(len_field_name, 0);
+  field_def_ = layout.field_def;
+  parent_token_ = layout.parent_token;
+  member_attributes_ = layout.attributes;
+  signature_metadata_ = layout.signature;
+  sig_metadata_length_ = layout.signature_length;
+  default_value_type_flags_ = layout.default_value_type_flags;
+  default_value_ = layout.default_value;
+  default_value_len_ = layout.default_value_length;
+  member_name_ = layout.name;
+  is_backing_field_ = layout.is_backing_field;
 
-  // Second call to get the actual name.
-  initialized_hr_ = metadata_import->GetFieldProps(
-      field_def_, &parent_token_, wchar_field_name.data(), len_field_name,
-      &len_field_name, &member_attributes_, &signature_metadata_,
-      &sig_metadata_length_, &default_value_type_flags_, &default_value_,
-      &default_value_len_);
-  if (FAILED(initialized_hr_)) {
-    WriteError("Failed to populate field metadata.");
-    return;
-  }
-
-  member_name_ = ConvertWCharPtrToString(wchar_field_name);
-
-  // If field name is <MyProperty>k__BackingField, change it to
-  // MyProperty because it is the backing field of a property.
-  if (member_name_.size() > kBackingField.size() + 1) {
-    // Checks that field name is of the form <Property>k__BackingField.
-    if (member_name_[0] == '<') {
-      string::size_type position;
-      // Checks that field_name_ ends with k_BackingField.
-      position = member_name_.find(kBackingField,
-                                   member_name_.size() - kBackingField.size());
-      // Extracts out the field name.
-      if (position != string::npos) {
-        is_backing_field_ = true;
-        member_name_ = member_name_.substr(1, position - 1);
-      }
-    }
-  }
+  CComPtr<ICorDebugValue> field_value;
 
   // This will point to the value of the field if the field is const.
   if (default_value_ && IsFdLiteral(member_attributes_)) {
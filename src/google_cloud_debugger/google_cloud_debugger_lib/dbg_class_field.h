@@ -20,6 +20,7 @@
 
 #include "dbg_object.h"
 #include "i_dbg_class_member.h"
+#include "type_layout_cache.h"
 
 namespace google_cloud_debugger {
 
@@ -45,6 +46,15 @@ class DbgClassField : public IDbgClassMember {
                   ICorDebugObjectValue *debug_obj_value,
                   ICorDebugClass *debug_class);
 
+  // Same as Initialize above, but the names, metadata signature, flags
+  // and default value of the field are taken from layout instead of
+  // being read from metadata_import, which is then only needed for
+  // const enum fields.
+  void Initialize(const FieldLayout &layout, ICorDebugModule *debug_module,
+                  IMetaDataImport *metadata_import,
+                  ICorDebugObjectValue *debug_obj_value,
+                  ICorDebugClass *debug_class);
+
   // Evaluates and sets member_value_ to the value of the field
   // that is represented by this class.
   // Reference_value and generic_types are ignored.
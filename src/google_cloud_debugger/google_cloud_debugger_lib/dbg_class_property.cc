@@ -40,39 +40,31 @@ void DbgClassProperty::Initialize(mdProperty property_def,
     return;
   }
 
-  ULONG property_name_length;
-  ULONG other_methods_length;
-
-  property_def_ = property_def;
-  // First call to get length of array and length of other methods.
-  initialized_hr_ = metadata_import->GetPropertyProps(
-      property_def_, &parent_token_, nullptr, 0, &property_name_length,
-      &member_attributes_, &signature_metadata_, &sig_metadata_length_,
-      &default_value_type_flags_, &default_value_, &default_value_len_,
-      &property_setter_function, &property_getter_function, nullptr, 0,
-      &other_methods_length);
-
-  if (FAILED(initialized_hr_)) {
-    WriteError("Failed to get property metadata.");
-    return;
-  }
-
-  std::vector<WCHAR> wchar_property_name(property_name_length, 0);
-  other_methods_.resize(other_methods_length);
-
-  initialized_hr_ = metadata_import->GetPropertyProps(
-      property_def_, &parent_token_, wchar_property_name.data(),
-      wchar_property_name.size(), &property_name_length, &member_attributes_,
-      &signature_metadata_, &sig_metadata_length_, &default_value_type_flags_,
-      &default_value_, &default_value_len_, &property_setter_function,
-      &property_getter_function, other_methods_.data(), other_methods_.size(),
-      &other_methods_length);
+  PropertyLayout layout;
+  TypeLayoutCache::ReadPropertyLayout(metadata_import, property_def, &layout);
+  Initialize(layout, debug_module, creation_depth);
+}
 
+void DbgClassProperty::Initialize(const PropertyLayout &layout,
+                                  ICorDebugModule *debug_module,
+                                  int creation_depth) {
+  initialized_hr_ = layout.hr;
   if (FAILED(initialized_hr_)) {
     WriteError("Failed to get property metadata.");
   }
 
-  member_name_ = ConvertWCharPtrToString(wchar_property_name);
+  property_def_ = layout.property_def;
+  parent_token_ = layout.parent_token;
+  member_attributes_ = layout.attributes;
+  signature_metadata_ = layout.signature;
+  sig_metadata_length_ = layout.signature_length;
+  default_value_type_flags_ = layout.default_value_type_flags;
+  default_value_ = layout.default_value;
+  default_value_len_ = layout.default_value_length;
+  property_setter_function = layout.setter;
+  property_getter_function = layout.getter;
+  other_methods_ = layout.other_methods;
+  member_name_ = layout.name;
   creation_depth_ = creation_depth;
   debug_module_ = debug_module;
 }
@@ -20,6 +20,7 @@
 
 #include "dbg_object.h"
 #include "i_dbg_class_member.h"
+#include "type_layout_cache.h"
 #include "type_signature.h"
 
 namespace google_cloud_debugger {
@@ -43,6 +44,11 @@ class DbgClassProperty : public IDbgClassMember {
   void Initialize(mdProperty property_def, IMetaDataImport *metadata_import,
                   ICorDebugModule *debug_module, int creation_depth);
 
+  // Same as Initialize above, but the name, metadata signature, attributes
+  // and getter and setter tokens are taken from layout.
+  void Initialize(const PropertyLayout &layout, ICorDebugModule *debug_module,
+                  int creation_depth);
+
   // Evaluates the property and stores the value in member_value_.
   // reference_value is a reference to the class object that this property
   // belongs to. eval_coordinator is needed to perform the function
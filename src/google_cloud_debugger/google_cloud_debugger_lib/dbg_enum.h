@@ -31,8 +31,9 @@ class DbgEnum : public DbgClass {
   // This constructor should be used we have an ICorDebugType
   // that represents the type of the enum.
   DbgEnum(ICorDebugType *debug_type, int depth, const std::string &enum_name,
-          mdTypeDef enum_token, std::shared_ptr<ICorDebugHelper> debug_helper,
-          std::shared_ptr<IDbgObjectFactory> obj_factory)
+          mdTypeDef enum_token,
+          const std::shared_ptr<ICorDebugHelper> &debug_helper,
+          const std::shared_ptr<IDbgObjectFactory> &obj_factory)
       : DbgClass(debug_type, depth, debug_helper, obj_factory) {
     class_name_ = enum_name;
     class_type_ = ClassType::ENUM;
@@ -47,8 +48,8 @@ class DbgEnum : public DbgClass {
   // as we don't have an ICorDebugType generated for those.
   DbgEnum(int depth, const std::string &enum_name, mdTypeDef enum_token,
           ULONG64 enum_value, const CorElementType &enum_type,
-          std::shared_ptr<ICorDebugHelper> debug_helper,
-          std::shared_ptr<IDbgObjectFactory> obj_factory)
+          const std::shared_ptr<ICorDebugHelper> &debug_helper,
+          const std::shared_ptr<IDbgObjectFactory> &obj_factory)
       : DbgClass(nullptr, depth, debug_helper, obj_factory) {
     class_name_ = enum_name;
     class_type_ = ClassType::ENUM;
@@ -12,6 +12,7 @@
 #include "dbg_primitive.h"
 #include "dbg_string.h"
 #include "cor_debug_helper.h"
+#include "dbg_object_pool.h"
 #include "i_eval_coordinator.h"
 #include "type_signature.h"
 
@@ -23,8 +24,32 @@ using std::vector;
 
 namespace google_cloud_debugger {
 
+void *DbgObject::operator new(std::size_t size) {
+  void *block = GetObjectPool()->Allocate(size);
+  if (block == nullptr) {
+    throw std::bad_alloc();
+  }
+  return block;
+}
+
+void *DbgObject::operator new(std::size_t size,
+                              const std::nothrow_t &) noexcept {
+  return GetObjectPool()->Allocate(size);
+}
+
+void DbgObject::operator delete(void *block, std::size_t size) {
+  GetObjectPool()->Free(block, size);
+}
+
+DbgObjectPool *DbgObject::GetObjectPool() {
+  // The pool is never destroyed because DbgObjects held by other
+  // static objects may be freed during exit.
+  static DbgObjectPool *object_pool = new DbgObjectPool();
+  return object_pool;
+}
+
 DbgObject::DbgObject(ICorDebugType *debug_type, int depth,
-    std::shared_ptr<ICorDebugHelper> debug_helper) {
+    const std::shared_ptr<ICorDebugHelper> &debug_helper) {
   debug_type_ = debug_type;
   depth_ = depth;
   debug_helper_ = debug_helper;
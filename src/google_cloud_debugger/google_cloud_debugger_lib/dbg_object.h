@@ -15,6 +15,9 @@
 #ifndef DBG_OBJECT_H_
 #define DBG_OBJECT_H_
 
+#include <cstddef>
+#include <memory>
+#include <new>
 #include <string>
 #include <vector>
 
@@ -29,6 +32,7 @@ namespace google_cloud_debugger {
 class IEvalCoordinator;
 class VariableWrapper;
 class ICorDebugHelper;
+class DbgObjectPool;
 struct TypeSignature;
 
 // This class represents a .NET object.
@@ -41,10 +45,19 @@ class DbgObject : public StringStreamWrapper {
   // Create a DbgObject with ICorDebugType debug_type.
   // The object will only be created to a depth of depth.
   DbgObject(ICorDebugType *debug_type, int depth,
-            std::shared_ptr<ICorDebugHelper> debug_helper);
+            const std::shared_ptr<ICorDebugHelper> &debug_helper);
 
   virtual ~DbgObject() {}
 
+  // DbgObjects are allocated from the pool returned by GetObjectPool
+  // so that the objects of a capture do not each go to the heap.
+  static void *operator new(std::size_t size);
+  static void *operator new(std::size_t size, const std::nothrow_t &) noexcept;
+  static void operator delete(void *block, std::size_t size);
+
+  // Returns the pool DbgObjects are allocated from.
+  static DbgObjectPool *GetObjectPool();
+
   // Initialize the DbgObject based on an ICorDebugValue object
   // and a boolean that indicates whether the object is null or not.
   // This function will set initialize_hr_ if there is any error.
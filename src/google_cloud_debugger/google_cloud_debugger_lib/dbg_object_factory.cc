@@ -42,6 +42,21 @@ DbgObjectFactory::DbgObjectFactory(
     std::shared_ptr<ICorDebugHelper> debug_helper)
     : debug_helper_(debug_helper) {}
 
+std::shared_ptr<IDbgObjectFactory> DbgObjectFactory::GetSharedFactory() {
+  std::shared_ptr<DbgObjectFactory> self = self_.lock();
+  if (self) {
+    return self;
+  }
+
+  // This factory is not owned by a shared_ptr that we can hand out,
+  // so the objects it creates share another factory instead.
+  std::call_once(shared_factory_once_, [this]() {
+    shared_factory_ = std::make_shared<DbgObjectFactory>(debug_helper_);
+    shared_factory_->self_ = shared_factory_;
+  });
+  return shared_factory_;
+}
+
 HRESULT DbgObjectFactory::CreateDbgObjectHelper(
     ICorDebugValue *debug_value, ICorDebugType *debug_type,
     CorElementType cor_element_type, BOOL is_null, int depth,
@@ -119,8 +134,7 @@ HRESULT DbgObjectFactory::CreateDbgObjectHelper(
     case CorElementType::ELEMENT_TYPE_SZARRAY:
     case CorElementType::ELEMENT_TYPE_ARRAY:
       temp_object = unique_ptr<DbgObject>(new (std::nothrow) DbgArray(
-          debug_type, depth, debug_helper_,
-          std::shared_ptr<DbgObjectFactory>(new DbgObjectFactory)));
+          debug_type, depth, debug_helper_, GetSharedFactory()));
       break;
     case CorElementType::ELEMENT_TYPE_CLASS:
     case CorElementType::ELEMENT_TYPE_VALUETYPE:
@@ -277,8 +291,7 @@ HRESULT DbgObjectFactory::CreateDbgClassObject(
 
   if (is_null) {
     unique_ptr<DbgClass> null_obj(new (std::nothrow) DbgClass(
-        debug_type, depth, debug_helper_,
-        std::shared_ptr<DbgObjectFactory>(new DbgObjectFactory())));
+        debug_type, depth, debug_helper_, GetSharedFactory()));
     if (!null_obj) {
       *err_stream << "Ran out of memory to create null class object.";
       return E_OUTOFMEMORY;
@@ -310,7 +323,7 @@ HRESULT DbgObjectFactory::CreateDbgClassObject(
       unique_ptr<DbgEnum> enum_obj =
           unique_ptr<DbgEnum>(new (std::nothrow) DbgEnum(
               debug_type, depth, class_name, class_token, debug_helper_,
-              std::shared_ptr<DbgObjectFactory>(new DbgObjectFactory())));
+              GetSharedFactory()));
       // Only process class type for enum (since it is ValueType and we don't
       // store reference to the class object). Delay processing fields and
       // properties of non-ValueType class until we need them.
@@ -325,12 +338,10 @@ HRESULT DbgObjectFactory::CreateDbgClassObject(
                kDictionaryClassName.compare(class_name) == 0) {
       class_obj = unique_ptr<DbgBuiltinCollection>(
           new (std::nothrow) DbgBuiltinCollection(
-              debug_type, depth, debug_helper_,
-              std::shared_ptr<DbgObjectFactory>(new DbgObjectFactory())));
+              debug_type, depth, debug_helper_, GetSharedFactory()));
     } else {
       class_obj = unique_ptr<DbgClass>(new (std::nothrow) DbgClass(
-          debug_type, depth, debug_helper_,
-          std::shared_ptr<DbgObjectFactory>(new DbgObjectFactory())));
+          debug_type, depth, debug_helper_, GetSharedFactory()));
     }
 
     if (!class_obj) {
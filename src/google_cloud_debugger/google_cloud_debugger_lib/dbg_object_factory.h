@@ -15,6 +15,9 @@
 #ifndef DBG_OBJECT_FACTORY_H__
 #define DBG_OBJECT_FACTORY_H__
 
+#include <memory>
+#include <mutex>
+
 #include "dbg_primitive.h"
 #include "i_dbg_object_factory.h"
 
@@ -74,6 +77,22 @@ class DbgObjectFactory : public IDbgObjectFactory {
   // This will be injected into the DbgObject created by this factory.
   std::shared_ptr<ICorDebugHelper> debug_helper_;
 
+  // Returns the factory that is injected into the DbgObjects created
+  // by this factory. All of them share the same factory, which uses
+  // the same debug_helper_ as this one, instead of each getting a new
+  // factory and a new ICorDebugHelper.
+  std::shared_ptr<IDbgObjectFactory> GetSharedFactory();
+
+  // The factory returned by GetSharedFactory if self_ is not set.
+  std::shared_ptr<DbgObjectFactory> shared_factory_;
+
+  // Makes sure shared_factory_ is only created once.
+  std::once_flag shared_factory_once_;
+
+  // Set if this factory is the shared_factory_ of another factory,
+  // in which case it hands out itself.
+  std::weak_ptr<DbgObjectFactory> self_;
+
   // Helper function to create a DbgObject.
   HRESULT CreateDbgObjectHelper(ICorDebugValue *debug_value,
                                 ICorDebugType *debug_type,
@@ -0,0 +1,115 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "dbg_object_pool.h"
+
+#include <new>
+
+using std::lock_guard;
+using std::mutex;
+
+namespace google_cloud_debugger {
+
+const std::size_t DbgObjectPool::kBlockAlignment;
+const std::size_t DbgObjectPool::kMaxBlockSize;
+const std::size_t DbgObjectPool::kChunkSize;
+const std::size_t DbgObjectPool::kSizeClasses;
+
+void *DbgObjectPool::Allocate(std::size_t size) {
+  if (size == 0 || size > kMaxBlockSize) {
+    return ::operator new(size, std::nothrow);
+  }
+
+  std::size_t size_class = GetSizeClass(size);
+  lock_guard<mutex> lock(mutex_);
+  void *block = free_lists_[size_class];
+  if (block != nullptr) {
+    free_lists_[size_class] = free_lists_[size_class]->next;
+  } else {
+    block = AllocateFromChunks((size_class + 1) * kBlockAlignment);
+    if (block == nullptr) {
+      return nullptr;
+    }
+  }
+
+  ++live_blocks_;
+  return block;
+}
+
+void DbgObjectPool::Free(void *block, std::size_t size) {
+  if (block == nullptr) {
+    return;
+  }
+
+  if (size == 0 || size > kMaxBlockSize) {
+    ::operator delete(block);
+    return;
+  }
+
+  std::size_t size_class = GetSizeClass(size);
+  lock_guard<mutex> lock(mutex_);
+  FreeBlock *free_block = static_cast<FreeBlock *>(block);
+  free_block->next = free_lists_[size_class];
+  free_lists_[size_class] = free_block;
+
+  --live_blocks_;
+  if (live_blocks_ == 0) {
+    Rewind();
+  }
+}
+
+DbgObjectPool::Stats DbgObjectPool::GetStats() {
+  lock_guard<mutex> lock(mutex_);
+  Stats stats;
+  stats.live_blocks = live_blocks_;
+  stats.chunks = chunks_.size();
+  stats.rewinds = rewinds_;
+  return stats;
+}
+
+void *DbgObjectPool::AllocateFromChunks(std::size_t block_size) {
+  if (current_chunk_ < chunks_.size() &&
+      chunk_offset_ + block_size > kChunkSize) {
+    ++current_chunk_;
+    chunk_offset_ = 0;
+  }
+
+  if (current_chunk_ == chunks_.size()) {
+    std::unique_ptr<char[]> chunk(new (std::nothrow) char[kChunkSize]);
+    if (!chunk) {
+      return nullptr;
+    }
+    chunks_.push_back(std::move(chunk));
+    chunk_offset_ = 0;
+  }
+
+  void *block = chunks_[current_chunk_].get() + chunk_offset_;
+  chunk_offset_ += block_size;
+  return block;
+}
+
+void DbgObjectPool::Rewind() {
+  for (std::size_t i = 0; i < kSizeClasses; ++i) {
+    free_lists_[i] = nullptr;
+  }
+  if (chunks_.size() > 1) {
+    chunks_.resize(1);
+  }
+  current_chunk_ = 0;
+  chunk_offset_ = 0;
+  ++rewinds_;
+}
+
+}  //  namespace google_cloud_debugger
@@ -0,0 +1,124 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef DBG_OBJECT_POOL_H_
+#define DBG_OBJECT_POOL_H_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace google_cloud_debugger {
+
+// Pool the memory of DbgObjects is allocated from.
+//
+// Capturing a snapshot creates a DbgObject for every variable, field,
+// property and array item that is visited, and frees all of them once
+// the snapshot is written. Instead of going to the heap for each of
+// them, blocks are bump allocated from large chunks and a freed block
+// is kept on a free list for the next object of the same size.
+//
+// When the last live block is freed, which is the case once every
+// object of a capture is gone, the pool is rewound as a whole: all
+// chunks but the first are freed and the first one is reused for the
+// next capture.
+//
+// Blocks larger than kMaxBlockSize are allocated on the heap.
+// This class is thread-safe.
+class DbgObjectPool {
+ public:
+  // Blocks are a multiple of kBlockAlignment bytes.
+  static const std::size_t kBlockAlignment = 16;
+
+  // Largest block that is allocated from the pool.
+  static const std::size_t kMaxBlockSize = 512;
+
+  // Size of the chunks blocks are bump allocated from.
+  static const std::size_t kChunkSize = 64 * 1024;
+
+  // Statistics of the pool.
+  struct Stats {
+    // Number of blocks that are allocated and not freed yet.
+    std::size_t live_blocks = 0;
+
+    // Number of chunks the pool holds.
+    std::size_t chunks = 0;
+
+    // Number of times the pool was rewound.
+    std::size_t rewinds = 0;
+  };
+
+  DbgObjectPool() = default;
+
+  DbgObjectPool(const DbgObjectPool &) = delete;
+  DbgObjectPool &operator=(const DbgObjectPool &) = delete;
+
+  // Returns a block of at least size bytes or nullptr if we run out
+  // of memory.
+  void *Allocate(std::size_t size);
+
+  // Frees block, which was returned by Allocate(size).
+  void Free(void *block, std::size_t size);
+
+  // Returns the statistics of the pool.
+  Stats GetStats();
+
+ private:
+  // A freed block. The next pointer is stored in the block itself.
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  // Number of size classes, one for each multiple of kBlockAlignment.
+  static const std::size_t kSizeClasses = kMaxBlockSize / kBlockAlignment;
+
+  // Returns the size class of blocks of size bytes.
+  static std::size_t GetSizeClass(std::size_t size) {
+    return (size + kBlockAlignment - 1) / kBlockAlignment - 1;
+  }
+
+  // Bump allocates block_size bytes from the chunks.
+  void *AllocateFromChunks(std::size_t block_size);
+
+  // Frees every chunk but the first and makes all of the pool
+  // available again.
+  void Rewind();
+
+  // Free lists of the size classes.
+  FreeBlock *free_lists_[kSizeClasses] = {};
+
+  // Chunks the blocks are allocated from.
+  std::vector<std::unique_ptr<char[]>> chunks_;
+
+  // Index of the chunk blocks are currently bump allocated from.
+  std::size_t current_chunk_ = 0;
+
+  // Offset of the first unused byte in the current chunk.
+  std::size_t chunk_offset_ = 0;
+
+  // Number of blocks that are allocated from the pool and not freed.
+  std::size_t live_blocks_ = 0;
+
+  // Number of times the pool was rewound.
+  std::size_t rewinds_ = 0;
+
+  // Protects the members above.
+  std::mutex mutex_;
+};
+
+}  //  namespace google_cloud_debugger
+
+#endif  //  DBG_OBJECT_POOL_H_
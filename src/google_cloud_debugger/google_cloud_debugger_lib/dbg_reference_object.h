@@ -26,8 +26,8 @@ class DbgReferenceObject : public DbgObject {
  public:
   // obj_factory is needed to create members of reference object.
   DbgReferenceObject(ICorDebugType *debug_type, int depth,
-                     std::shared_ptr<ICorDebugHelper> debug_helper,
-                     std::shared_ptr<IDbgObjectFactory> obj_factory)
+                     const std::shared_ptr<ICorDebugHelper> &debug_helper,
+                     const std::shared_ptr<IDbgObjectFactory> &obj_factory)
       : DbgObject(debug_type, depth, debug_helper),
         object_factory_(obj_factory) {
   }
@@ -14,6 +14,7 @@
 
 #include "dbg_stack_frame.h"
 
+#include <algorithm>
 #include <iostream>
 #include <queue>
 #include <vector>
@@ -29,6 +30,7 @@
 #include "i_dbg_object_factory.h"
 #include "i_eval_coordinator.h"
 #include "method_info.h"
+#include "snapshot_size_budget.h"
 #include "type_signature.h"
 #include "variable_wrapper.h"
 
@@ -39,7 +41,6 @@ using google_cloud_debugger_portable_pdb::LocalConstantInfo;
 using google_cloud_debugger_portable_pdb::LocalVariableInfo;
 using std::cerr;
 using std::cout;
-using std::ostringstream;
 using std::queue;
 using std::shared_ptr;
 using std::string;
@@ -94,16 +95,82 @@ HRESULT DbgStackFrame::Initialize(
   }
 
   is_static_method_ = IsMdStatic(method_flag);
+  method_token_ = method_token;
 
+  // The locals and arguments of an async method are fields of its state
+  // machine, so they cannot be retrieved by slot.
+  bool lazy_variables = lazy_debug_thread_ != nullptr;
+  if (lazy_variables && !is_static_method_) {
+    lazy_variables =
+        debug_helper_->CheckAsyncStateObj(class_token_, metadata_import) ==
+        S_FALSE;
+  }
+
+  if (lazy_variables) {
+    variable_infos_ = variable_infos;
+    constant_infos_ = constant_infos;
+    is_processed_il_frame_ = true;
+    return S_OK;
+  }
+
+  hr = ProcessVariables(il_frame, variable_infos, constant_infos,
+                        metadata_import);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = InitializeClassGenericTypeParameters(metadata_import, il_frame);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  is_processed_il_frame_ = true;
+  return S_OK;
+}
+
+HRESULT DbgStackFrame::PopulateVariables() {
+  if (variables_populated_) {
+    return S_OK;
+  }
+
+  CComPtr<ICorDebugILFrame> il_frame;
+  HRESULT hr = GetActiveILFrame(&il_frame);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  CComPtr<IMetaDataImport> metadata_import;
+  hr = GetMetaDataImport(&metadata_import);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  variables_.clear();
+  method_arguments_.clear();
+  hr = ProcessVariables(il_frame, variable_infos_, constant_infos_,
+                        metadata_import);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  variable_infos_.clear();
+  constant_infos_.clear();
+  return PopulateClassGenericTypeParameters();
+}
+
+HRESULT DbgStackFrame::ProcessVariables(
+    ICorDebugILFrame *il_frame, const vector<LocalVariableInfo> &variable_infos,
+    const vector<LocalConstantInfo> &constant_infos,
+    IMetaDataImport *metadata_import) {
   CComPtr<ICorDebugValueEnum> method_arg_enum;
   // Even if we are not in a method (no arguments), this will return S_OK.
-  hr = il_frame->EnumerateArguments(&method_arg_enum);
+  HRESULT hr = il_frame->EnumerateArguments(&method_arg_enum);
   if (FAILED(hr)) {
     cerr << "Failed to get method arguments.";
     return hr;
   }
 
-  hr = ProcessMethodArguments(method_arg_enum, method_token, metadata_import);
+  hr = ProcessMethodArguments(method_arg_enum, method_token_, metadata_import);
   if (FAILED(hr)) {
     return hr;
   }
@@ -128,12 +195,127 @@ HRESULT DbgStackFrame::Initialize(
     return hr;
   }
 
-  hr = InitializeClassGenericTypeParameters(metadata_import, il_frame);
+  variables_populated_ = true;
+  return S_OK;
+}
+
+HRESULT DbgStackFrame::GetActiveILFrame(ICorDebugILFrame **il_frame) {
+  if (!lazy_debug_thread_) {
+    cerr << "No thread to retrieve the frame from.";
+    return E_FAIL;
+  }
+
+  CComPtr<ICorDebugFrame> debug_frame;
+  HRESULT hr = lazy_debug_thread_->GetActiveFrame(&debug_frame);
   if (FAILED(hr)) {
+    cerr << "Failed to get active frame.";
     return hr;
   }
 
-  is_processed_il_frame_ = true;
+  hr = debug_frame->QueryInterface(__uuidof(ICorDebugILFrame),
+                                   reinterpret_cast<void **>(il_frame));
+  if (FAILED(hr)) {
+    cerr << "Failed to get ILFrame";
+  }
+  return hr;
+}
+
+HRESULT DbgStackFrame::ResolveVariable(const std::string &variable_name,
+                                       std::shared_ptr<DbgObject> *dbg_object,
+                                       std::ostream *err_stream) {
+  static const std::string this_var = "this";
+  CComPtr<ICorDebugILFrame> il_frame;
+  HRESULT hr = GetActiveILFrame(&il_frame);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  CComPtr<ICorDebugValue> debug_value;
+  if (variable_name.compare(this_var) != 0) {
+    auto variable_info = std::find_if(
+        variable_infos_.begin(), variable_infos_.end(),
+        [&variable_name](const LocalVariableInfo &info) {
+          return !info.debugger_hidden && variable_name.compare(info.name) == 0;
+        });
+    if (variable_info != variable_infos_.end()) {
+      hr = il_frame->GetLocalVariable(variable_info->slot, &debug_value);
+      if (FAILED(hr)) {
+        *err_stream << "Failed to get local variable " << variable_name;
+        return hr;
+      }
+
+      unique_ptr<DbgObject> variable_value;
+      hr = obj_factory_->CreateDbgObject(debug_value, object_depth_,
+                                         &variable_value, err_stream);
+      if (FAILED(hr)) {
+        return hr;
+      }
+
+      variables_.push_back(
+          std::make_tuple(variable_name, std::move(variable_value)));
+      *dbg_object = std::get<1>(variables_.back());
+      return S_OK;
+    }
+
+    auto constant_info = std::find_if(
+        constant_infos_.begin(), constant_infos_.end(),
+        [&variable_name](const LocalConstantInfo &info) {
+          return variable_name.compare(info.name) == 0;
+        });
+    if (constant_info != constant_infos_.end()) {
+      size_t variables_count = variables_.size();
+      hr = ProcessLocalConstant(*constant_info);
+      if (FAILED(hr)) {
+        return hr;
+      }
+
+      if (variables_.size() == variables_count) {
+        *err_stream << "Failed to process constant " << variable_name;
+        return E_FAIL;
+      }
+
+      *dbg_object = std::get<1>(variables_.back());
+      return S_OK;
+    }
+  }
+
+  if (method_argument_names_.empty()) {
+    CComPtr<IMetaDataImport> metadata_import;
+    hr = GetMetaDataImport(&metadata_import);
+    if (FAILED(hr)) {
+      return hr;
+    }
+
+    hr = PopulateMethodArgumentNames(method_token_, metadata_import);
+    if (FAILED(hr)) {
+      return hr;
+    }
+  }
+
+  auto method_arg_name =
+      std::find(method_argument_names_.begin(), method_argument_names_.end(),
+                variable_name);
+  if (method_arg_name == method_argument_names_.end()) {
+    return S_FALSE;
+  }
+
+  DWORD method_arg_index = method_arg_name - method_argument_names_.begin();
+  hr = il_frame->GetArgument(method_arg_index, &debug_value);
+  if (FAILED(hr)) {
+    *err_stream << "Failed to get method argument " << variable_name;
+    return hr;
+  }
+
+  unique_ptr<DbgObject> method_arg_value;
+  hr = obj_factory_->CreateDbgObject(debug_value, object_depth_,
+                                     &method_arg_value, err_stream);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  method_arguments_.push_back(
+      std::make_tuple(variable_name, std::move(method_arg_value)));
+  *dbg_object = std::get<1>(method_arguments_.back());
   return S_OK;
 }
 
@@ -163,7 +345,6 @@ HRESULT DbgStackFrame::ProcessLocalVariables(
   for (size_t i = 0; i < debug_values.size(); ++i) {
     unique_ptr<DbgObject> variable_value;
     string variable_name;
-    unique_ptr<ostringstream> err_stream(new (std::nothrow) ostringstream);
     bool variable_hidden = false;
 
     // Default name if we can't get the name.
@@ -205,49 +386,53 @@ HRESULT DbgStackFrame::ProcessLocalVariables(
 HRESULT DbgStackFrame::ProcessLocalConstants(
     const std::vector<google_cloud_debugger_portable_pdb::LocalConstantInfo>
         &constant_infos) {
-  HRESULT hr;
   for (auto &constant_info : constant_infos) {
-    UVCP_CONSTANT const_value;
-    ULONG value_len = 0;
-    CorElementType const_type;
-    vector<uint8_t> remaining_buffer;
-
-    hr = debug_helper_->ProcessConstantSigBlob(
-        constant_info.signature_data, &const_type,
-        &const_value, &value_len, &remaining_buffer);
-    if (FAILED(hr)) {
-      cerr << "Cannot process constant " << constant_info.name;
-      continue;
-    }
+    ProcessLocalConstant(constant_info);
+  }
+  return S_OK;
+}
 
-    ULONG64 const_numerical_value = 0;
-    std::unique_ptr<DbgObject> const_obj;
-    hr = obj_factory_->CreateDbgObjectFromLiteralConst(
-        const_type, const_value, value_len, &const_numerical_value, &const_obj);
-    if (FAILED(hr)) {
-      cerr << "Failed to create constant " << constant_info.name;
-      continue;
-    }
+HRESULT DbgStackFrame::ProcessLocalConstant(
+    const LocalConstantInfo &constant_info) {
+  UVCP_CONSTANT const_value;
+  ULONG value_len = 0;
+  CorElementType const_type;
+  vector<uint8_t> remaining_buffer;
 
-    // If there are no bytes left or cor type is ELEMENT_TYPE_STRING,
-    // then this constant is not an enum.
-    if (remaining_buffer.size() == 0
-      || const_type == CorElementType::ELEMENT_TYPE_STRING) {
-      variables_.push_back(
-          std::make_tuple(constant_info.name, std::move(const_obj)));
-      continue;
-    }
+  HRESULT hr = debug_helper_->ProcessConstantSigBlob(
+      constant_info.signature_data, &const_type,
+      &const_value, &value_len, &remaining_buffer);
+  if (FAILED(hr)) {
+    cerr << "Cannot process constant " << constant_info.name;
+    return hr;
+  }
 
+  ULONG64 const_numerical_value = 0;
+  std::unique_ptr<DbgObject> const_obj;
+  hr = obj_factory_->CreateDbgObjectFromLiteralConst(
+      const_type, const_value, value_len, &const_numerical_value, &const_obj);
+  if (FAILED(hr)) {
+    cerr << "Failed to create constant " << constant_info.name;
+    return hr;
+  }
 
-    hr = ProcessLocalEnumConstant(
-        constant_info.name, const_type,
-        const_numerical_value, remaining_buffer);
-    if (FAILED(hr)) {
-      cerr << "Failed to process enum value for constant "
-            << constant_info.name;
-    }
+  // If there are no bytes left or cor type is ELEMENT_TYPE_STRING,
+  // then this constant is not an enum.
+  if (remaining_buffer.size() == 0
+    || const_type == CorElementType::ELEMENT_TYPE_STRING) {
+    variables_.push_back(
+        std::make_tuple(constant_info.name, std::move(const_obj)));
+    return S_OK;
   }
-  return S_OK;
+
+  hr = ProcessLocalEnumConstant(
+      constant_info.name, const_type,
+      const_numerical_value, remaining_buffer);
+  if (FAILED(hr)) {
+    cerr << "Failed to process enum value for constant "
+          << constant_info.name;
+  }
+  return hr;
 }
 
 HRESULT DbgStackFrame::ProcessLocalEnumConstant(
@@ -331,13 +516,7 @@ HRESULT DbgStackFrame::ProcessMethodArguments(
     return hr;
   }
 
-  vector<string> method_argument_names;
-  HCORENUM cor_enum = nullptr;
-
-  // Add "this" if method is not static.
   if (!is_static_method_) {
-    method_argument_names.push_back("this");
-
     // If we are in an async method, ProcessAsyncMethod will populate
     // local variables and method arguments for us. Otherwise, S_FALSE
     // wlil be returned and we proceed to process method arguments as normal.
@@ -347,7 +526,47 @@ HRESULT DbgStackFrame::ProcessMethodArguments(
     }
   }
 
-  hr = S_OK;
+  hr = PopulateMethodArgumentNames(method_token, metadata_import);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  for (size_t i = 0; i < method_arg_values.size(); ++i) {
+    unique_ptr<DbgObject> method_arg_value;
+    string method_arg_name;
+
+    if (i >= method_argument_names_.size()) {
+      // Default name if we can't get the name.
+      method_arg_name = kMethodArg + std::to_string(i);
+    } else {
+      method_arg_name = method_argument_names_[i];
+    }
+
+    hr = obj_factory_->CreateDbgObject(method_arg_values[i], object_depth_,
+                                       &method_arg_value, &std::cerr);
+
+    if (FAILED(hr)) {
+      method_arg_value = nullptr;
+    }
+
+    method_arguments_.push_back(std::make_tuple(std::move(method_arg_name),
+                                                std::move(method_arg_value)));
+  }
+
+  return S_OK;
+}
+
+HRESULT DbgStackFrame::PopulateMethodArgumentNames(
+    mdMethodDef method_token, IMetaDataImport *metadata_import) {
+  method_argument_names_.clear();
+  HCORENUM cor_enum = nullptr;
+
+  // Add "this" if method is not static.
+  if (!is_static_method_) {
+    method_argument_names_.push_back("this");
+  }
+
+  HRESULT hr = S_OK;
   vector<mdParamDef> method_args(100, 0);
   while (hr == S_OK) {
     ULONG method_args_returned = 0;
@@ -376,7 +595,7 @@ HRESULT DbgStackFrame::ProcessMethodArguments(
         continue;
       }
 
-      method_argument_names.push_back(param_name);
+      method_argument_names_.push_back(param_name);
     }
   }
 
@@ -386,28 +605,6 @@ HRESULT DbgStackFrame::ProcessMethodArguments(
     return hr;
   }
 
-  for (size_t i = 0; i < method_arg_values.size(); ++i) {
-    unique_ptr<DbgObject> method_arg_value;
-    string method_arg_name;
-
-    if (i >= method_argument_names.size()) {
-      // Default name if we can't get the name.
-      method_arg_name = kMethodArg + std::to_string(i);
-    } else {
-      method_arg_name = method_argument_names[i];
-    }
-
-    hr = obj_factory_->CreateDbgObject(method_arg_values[i], object_depth_,
-                                       &method_arg_value, &std::cerr);
-
-    if (FAILED(hr)) {
-      method_arg_value = nullptr;
-    }
-
-    method_arguments_.push_back(std::make_tuple(std::move(method_arg_name),
-                                                std::move(method_arg_value)));
-  }
-
   return S_OK;
 }
 
@@ -529,17 +726,50 @@ HRESULT DbgStackFrame::GetCurrentClassTypeParameters(
     return E_INVALIDARG;
   }
 
+  HRESULT hr = PopulateClassGenericTypeParameters();
+  if (FAILED(hr)) {
+    return hr;
+  }
+
   *debug_types = class_generic_types_;
   return S_OK;
 }
 
+const std::vector<TypeSignature>
+    &DbgStackFrame::GetClassGenericTypeSignatureParameters() {
+  // Failures are logged and the frame is treated as non-generic.
+  PopulateClassGenericTypeParameters();
+  return generic_type_signatures_;
+}
+
 HRESULT DbgStackFrame::GetMetaDataImport(IMetaDataImport **metadata_import) {
   return debug_helper_->GetMetadataImportFromICorDebugModule(
       debug_module_, metadata_import, &std::cerr);
 }
 
+HRESULT DbgStackFrame::PopulateClassGenericTypeParameters() {
+  if (class_generic_types_populated_ || !lazy_debug_thread_) {
+    return S_OK;
+  }
+
+  CComPtr<ICorDebugILFrame> il_frame;
+  HRESULT hr = GetActiveILFrame(&il_frame);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  CComPtr<IMetaDataImport> metadata_import;
+  hr = GetMetaDataImport(&metadata_import);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  return InitializeClassGenericTypeParameters(metadata_import, il_frame);
+}
+
 HRESULT DbgStackFrame::InitializeClassGenericTypeParameters(
     IMetaDataImport *metadata_import, ICorDebugILFrame *debug_frame) {
+  class_generic_types_populated_ = true;
   uint32_t class_generic_params = 0;
   HRESULT hr = debug_helper_->CountGenericParams(metadata_import, class_token_,
                                                  &class_generic_params);
@@ -599,7 +829,7 @@ HRESULT DbgStackFrame::InitializeClassGenericTypeParameters(
 }
 
 HRESULT DbgStackFrame::PopulateTypeDict() {
-  if (type_dict_populated_) {
+  if (type_name_table_ && type_name_table_->IsPopulated()) {
     return S_OK;
   }
 
@@ -609,68 +839,19 @@ HRESULT DbgStackFrame::PopulateTypeDict() {
     return hr;
   }
 
-  HCORENUM cor_enum = nullptr;
-
-  vector<mdTypeDef> type_defs(100, 0);
-  while (hr == S_OK) {
-    ULONG type_defs_returned = 0;
-    hr = metadata_import->EnumTypeDefs(&cor_enum, type_defs.data(),
-                                       type_defs.size(), &type_defs_returned);
-    if (FAILED(hr)) {
-      cerr << "Failed to get enumerate types with hr: " << std::hex << hr;
-      metadata_import->CloseEnum(cor_enum);
-      return hr;
-    }
-
-    // No type defs.
-    if (type_defs_returned == 0) {
-      break;
-    }
-    type_defs.resize(type_defs_returned);
-
-    for (auto const &type_def_token : type_defs) {
-      std::string type_name;
-      mdToken base_token;
-      hr = debug_helper_->GetTypeNameFromMdTypeDef(
-          type_def_token, metadata_import, &type_name, &base_token, &std::cerr);
-      if (FAILED(hr)) {
-        continue;
-      }
-      type_def_dict_[type_name] = type_def_token;
-    }
-  }
-
-  metadata_import->CloseEnum(cor_enum);
-  cor_enum = nullptr;
-
-  hr = S_OK;
-  vector<mdTypeRef> type_refs(100, 0);
-  while (hr == S_OK) {
-    ULONG type_refs_returned = 0;
-    hr = metadata_import->EnumTypeRefs(&cor_enum, type_refs.data(),
-                                       type_refs.size(), &type_refs_returned);
-    if (FAILED(hr)) {
-      cerr << "Failed to get enumerate types with hr: " << std::hex << hr;
-      return hr;
-    }
-
-    // No type defs.
-    if (type_refs_returned == 0) {
-      break;
-    }
-    type_refs.resize(type_refs_returned);
-
-    for (auto const &type_ref_token : type_refs) {
-      std::string type_name;
-      hr = debug_helper_->GetTypeNameFromMdTypeRef(
-          type_ref_token, metadata_import, &type_name, &std::cerr);
-      type_ref_dict_[type_name] = type_ref_token;
+  // Frames in modules without a PDB do not get the table of their
+  // module, so they use a table of their own.
+  if (!type_name_table_) {
+    type_name_table_ =
+        shared_ptr<TypeNameTable>(new (std::nothrow) TypeNameTable());
+    if (!type_name_table_) {
+      cerr << "Failed to create TypeNameTable.";
+      return E_OUTOFMEMORY;
     }
   }
 
-  metadata_import->CloseEnum(cor_enum);
-  type_dict_populated_ = true;
-  return S_OK;
+  return type_name_table_->Populate(metadata_import, debug_helper_.get(),
+                                    &cerr);
 }
 
 HRESULT DbgStackFrame::PopulateDebugAssemblies() {
@@ -717,13 +898,13 @@ HRESULT DbgStackFrame::GetClassTokenAndModule(
   }
 
   // First, we search the dictionary of mdTypeDef.
-  auto type_def_info = type_def_dict_.find(class_name);
-  if (type_def_info != type_def_dict_.end()) {
+  mdTypeDef type_def;
+  if (type_name_table_->FindTypeDef(class_name, &type_def)) {
     *debug_module = debug_module_;
     debug_module_->AddRef();
     *metadata_import = frame_metadata_import;
     frame_metadata_import->AddRef();
-    *class_token = type_def_info->second;
+    *class_token = type_def;
     return S_OK;
   }
 
@@ -733,10 +914,10 @@ HRESULT DbgStackFrame::GetClassTokenAndModule(
   }
 
   // If we didn't find the class, we search the dictionary of mdTypeRef.
-  auto type_ref_info = type_ref_dict_.find(class_name);
-  if (type_ref_info != type_ref_dict_.end()) {
+  mdTypeRef type_ref;
+  if (type_name_table_->FindTypeRef(class_name, &type_ref)) {
     hr = debug_helper_->GetMdTypeDefAndMetaDataFromTypeRef(
-        type_ref_info->second, debug_assemblies_, frame_metadata_import,
+        type_ref, debug_assemblies_, frame_metadata_import,
         class_token, metadata_import, &cerr);
     if (FAILED(hr)) {
       return hr;
@@ -858,14 +1039,9 @@ HRESULT DbgStackFrame::PopulateStackFrame(
   }
 
   if (bfs_queue.size() != 0) {
-    return VariableWrapper::PerformBFS(&bfs_queue,
-                                       [stack_frame, stack_frame_size]() {
-                                         // Terminates the BFS if stack frame
-                                         // reaches the maximum size.
-                                         return stack_frame->ByteSize() >
-                                                stack_frame_size;
-                                       },
-                                       eval_coordinator);
+    // Terminates the BFS if stack frame reaches the maximum size.
+    SnapshotSizeBudget budget(stack_frame_size, stack_frame->ByteSize());
+    return VariableWrapper::PerformBFS(&bfs_queue, &budget, eval_coordinator);
   }
 
   return S_OK;
@@ -907,6 +1083,10 @@ HRESULT DbgStackFrame::GetLocalVariable(const std::string &variable_name,
     return S_OK;
   }
 
+  if (!variables_populated_ && lazy_debug_thread_) {
+    return ResolveVariable(variable_name, dbg_object, err_stream);
+  }
+
   return S_FALSE;
 }
 
@@ -953,6 +1133,11 @@ HRESULT DbgStackFrame::GetFieldAndAutoPropFromFrame(
       // get us the static field value. This is because it only represents
       // an uninstantiated class. So we have to construct an ICorDebugType
       // for the instantiated type using class_generic_types_.
+      hr = PopulateClassGenericTypeParameters();
+      if (FAILED(hr)) {
+        return hr;
+      }
+
       CComPtr<ICorDebugType> class_type;
       hr = debug_helper_->GetInstantiatedClassType(
           debug_class, &class_generic_types_, &class_type, err_stream);
@@ -1020,10 +1205,17 @@ HRESULT DbgStackFrame::GetPropertyFromFrame(
   }
 
   return (*property_object)
-      ->SetTypeSignature(metadata_import, generic_type_signatures_);
+      ->SetTypeSignature(metadata_import,
+                         GetClassGenericTypeSignatureParameters());
 }
 
 std::shared_ptr<DbgObject> DbgStackFrame::GetThisObject() {
+  if (!variables_populated_ && lazy_debug_thread_) {
+    std::shared_ptr<DbgObject> this_obj;
+    GetLocalVariable("this", &this_obj, &cerr);
+    return this_obj;
+  }
+
   auto this_obj =
       std::find_if(method_arguments_.begin(), method_arguments_.end(),
                    [](const VariableTuple &variable_tuple) {
@@ -23,6 +23,7 @@
 
 #include "document_index.h"
 #include "i_dbg_stack_frame.h"
+#include "type_name_table.h"
 #include "type_signature.h"
 
 namespace google_cloud_debugger {
@@ -52,6 +53,24 @@ class DbgStackFrame : public IDbgStackFrame {
           &constant_infos,
       mdMethodDef method_token, IMetaDataImport *metadata_import);
 
+  // Makes Initialize skip enumerating the local variables and method
+  // arguments of the frame. Until PopulateVariables is called, they are
+  // resolved one at a time by GetLocalVariable from the active frame of
+  // debug_thread. Frames of async methods are always populated.
+  // Must be called before Initialize.
+  void SetLazyVariables(ICorDebugThread *debug_thread) {
+    lazy_debug_thread_ = debug_thread;
+  }
+
+  // Populates all the local variables and method arguments of a frame
+  // that was initialized with SetLazyVariables. Variables resolved
+  // on demand before this call are retrieved again.
+  HRESULT PopulateVariables();
+
+  // Returns true if all the local variables and method arguments
+  // of this frame have been populated.
+  bool IsVariablesPopulated() const { return variables_populated_; }
+
   // Populates the StackFrame object with local variables, method arguments,
   // method name, class name, file name and line number.
   // This method may perform function evaluation using eval_coordinator.
@@ -62,7 +81,9 @@ class DbgStackFrame : public IDbgStackFrame {
       int stack_frame_size, IEvalCoordinator *eval_coordinator) const;
 
   // Gets a local variable or method arguments with name
-  // variable_name.
+  // variable_name. If the variables of the frame are not populated,
+  // the variable is looked up by name in the PDB and only its slot
+  // is retrieved.
   HRESULT GetLocalVariable(const std::string &variable_name,
                            std::shared_ptr<DbgObject> *dbg_object,
                            std::ostream *err_stream);
@@ -130,6 +151,12 @@ class DbgStackFrame : public IDbgStackFrame {
   // Sets the name of the file this stack frame is in.
   void SetFile(const std::string &file_name) { file_name_ = file_name; }
 
+  // Sets the table of the type names of the module this stack frame is in.
+  // The table is shared by the frames of the module and populated once.
+  void SetTypeNameTable(std::shared_ptr<TypeNameTable> type_name_table) {
+    type_name_table_ = type_name_table;
+  }
+
   // Sets the name of the module this stack frame is in.
   void SetModuleName(const std::vector<WCHAR> &module_name) {
     module_name_ = ConvertWCharPtrToString(module_name);
@@ -235,9 +262,7 @@ class DbgStackFrame : public IDbgStackFrame {
       std::vector<CComPtr<ICorDebugType>> *debug_types);
 
   // Returns generic type signatures parameter for the class the frame is in.
-  const std::vector<TypeSignature> &GetClassGenericTypeSignatureParameters() {
-    return generic_type_signatures_;
-  }
+  const std::vector<TypeSignature> &GetClassGenericTypeSignatureParameters();
 
  private:
   // Helper for ICorDebug method.
@@ -262,6 +287,39 @@ class DbgStackFrame : public IDbgStackFrame {
   HRESULT InitializeClassGenericTypeParameters(IMetaDataImport *metadata_import,
                                                ICorDebugILFrame *debug_frame);
 
+  // Calls InitializeClassGenericTypeParameters with the active frame
+  // of lazy_debug_thread_ if the frame was initialized with
+  // SetLazyVariables and the generic types are not populated yet.
+  HRESULT PopulateClassGenericTypeParameters();
+
+  // Gets the ICorDebugILFrame of the active frame of lazy_debug_thread_.
+  // The frame is retrieved every time because function evaluation
+  // invalidates the frames of the thread.
+  HRESULT GetActiveILFrame(ICorDebugILFrame **il_frame);
+
+  // Enumerates the method arguments, local variables and local constants
+  // of il_frame into method_arguments_ and variables_.
+  HRESULT ProcessVariables(
+      ICorDebugILFrame *il_frame,
+      const std::vector<google_cloud_debugger_portable_pdb::LocalVariableInfo>
+          &variable_infos,
+      const std::vector<google_cloud_debugger_portable_pdb::LocalConstantInfo>
+          &constant_infos,
+      IMetaDataImport *metadata_import);
+
+  // Retrieves the local variable, local constant or method argument
+  // variable_name of a frame whose variables are not populated and
+  // caches it in variables_ or method_arguments_.
+  // Returns S_FALSE if there is no such variable.
+  HRESULT ResolveVariable(const std::string &variable_name,
+                          std::shared_ptr<DbgObject> *dbg_object,
+                          std::ostream *err_stream);
+
+  // Populates method_argument_names_ with "this" (if the method is not
+  // static) followed by the names of the parameters of method_token.
+  HRESULT PopulateMethodArgumentNames(mdMethodDef method_token,
+                                      IMetaDataImport *metadata_import);
+
   // Extract local variables from local_enum.
   // DbgBreakpoint object is used to get the variables' names.
   HRESULT ProcessLocalVariables(
@@ -274,6 +332,11 @@ class DbgStackFrame : public IDbgStackFrame {
       const std::vector<google_cloud_debugger_portable_pdb::LocalConstantInfo>
           &constant_infos);
 
+  // Parses a single local constant and adds it to variables_.
+  HRESULT ProcessLocalConstant(
+      const google_cloud_debugger_portable_pdb::LocalConstantInfo
+          &constant_info);
+
   // Parses local constant that is an enum.
   HRESULT ProcessLocalEnumConstant(
       const std::string &constant_name, const CorElementType &enum_type,
@@ -305,8 +368,8 @@ class DbgStackFrame : public IDbgStackFrame {
   void ProcessAsyncVariablesAndMethodArgs(
       const std::vector<std::shared_ptr<IDbgClassMember>> &async_fields);
 
-  // Populates the type_def_dict_ and type_ref_dict_ with all
-  // the types loaded in this frame.
+  // Populates type_name_table_ with all the types loaded in this frame.
+  // Creates a table for this frame if SetTypeNameTable was not called.
   HRESULT PopulateTypeDict();
 
   // Populate debug_assemblies_ with all loaded assemblies
@@ -336,6 +399,31 @@ class DbgStackFrame : public IDbgStackFrame {
   // Tuple that contains method argument's name, value and the error stream.
   std::vector<VariableTuple> method_arguments_;
 
+  // Thread whose active frame is this frame if the variables of the
+  // frame are resolved on demand.
+  CComPtr<ICorDebugThread> lazy_debug_thread_;
+
+  // Local variables and constants in scope, kept until the variables
+  // of the frame are populated.
+  std::vector<google_cloud_debugger_portable_pdb::LocalVariableInfo>
+      variable_infos_;
+  std::vector<google_cloud_debugger_portable_pdb::LocalConstantInfo>
+      constant_infos_;
+
+  // Names of the method arguments, in the order of their positions.
+  std::vector<std::string> method_argument_names_;
+
+  // Token of the method this frame is in.
+  mdMethodDef method_token_ = 0;
+
+  // True if variables_ and method_arguments_ contain all the local
+  // variables and method arguments of the frame.
+  bool variables_populated_ = false;
+
+  // True if class_generic_types_ and generic_type_signatures_ have
+  // been populated.
+  bool class_generic_types_populated_ = false;
+
   // Determines how deep to inspect the object.
   int object_depth_ = kDefaultObjectEvalDepth;
 
@@ -379,21 +467,9 @@ class DbgStackFrame : public IDbgStackFrame {
   // The module this stack frame is in.
   CComPtr<ICorDebugModule> debug_module_;
 
-  // Dictionary whose key is class name and whose value
-  // is the metadata token mdTypeDef of that class.
-  std::map<std::string, mdTypeDef> type_def_dict_;
-
-  // Dictionary whose key is class name and whose value
-  // is the metadata token mdTypeRef of that class.
-  // The difference between mdTypeDef and mdTypeRef
-  // is that mdTypeDef type is found in the current module
-  // whereas mdTypeRef is found in other modules.
-  // Hence, mdTypeRef may needs to be resolved to mdTypeDef
-  // when needed.
-  std::map<std::string, mdTypeRef> type_ref_dict_;
-
-  // True if type_def_dict_ and type_ref_dict_ have been populated.
-  bool type_dict_populated_ = false;
+  // Names of the types defined in and referenced by debug_module_.
+  // Shared with the other frames in the module if it has a PDB.
+  std::shared_ptr<TypeNameTable> type_name_table_;
 
   // Cache of loaded debug assemblies.
   std::vector<CComPtr<ICorDebugAssembly>> debug_assemblies_;
@@ -20,11 +20,17 @@
 #include "i_cor_debug_helper.h"
 #include "i_eval_coordinator.h"
 
+using google::cloud::diagnostics::debug::Status;
 using google::cloud::diagnostics::debug::Variable;
 using std::string;
 
 namespace google_cloud_debugger {
 
+const std::uint32_t DbgString::kDefaultMaxCapturedLength;
+
+std::uint32_t DbgString::max_captured_length_ =
+    DbgString::kDefaultMaxCapturedLength;
+
 void DbgString::Initialize(ICorDebugValue *debug_value, BOOL is_null) {
   SetIsNull(is_null);
 
@@ -53,12 +59,38 @@ HRESULT DbgString::PopulateValue(Variable *variable) {
     return S_OK;
   }
 
-  HRESULT hr = ExtractStringFromReference();
+  // Strings that are not backed by an object in the debuggee, for
+  // example the ones created for tests, are already extracted.
+  if (string_obj_set_ && !object_handle_) {
+    variable->set_value(string_obj_);
+    return S_OK;
+  }
+
+  CComPtr<ICorDebugStringValue> debug_string;
+  HRESULT hr = GetICorDebugStringValue(&debug_string);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  // The prefix is converted straight into the value of the variable.
+  std::uint32_t string_length = 0;
+  std::uint32_t captured_length = 0;
+  hr = debug_helper_->ExtractStringPrefixFromICorDebugStringValue(
+      debug_string, max_captured_length_, variable->mutable_value(),
+      &string_length, &captured_length, GetErrorStream());
   if (FAILED(hr)) {
+    variable->clear_value();
     return hr;
   }
 
-  variable->set_value(string_obj_);
+  if (captured_length < string_length) {
+    Status *status = variable->mutable_status();
+    status->set_iserror(false);
+    status->set_message("Only the first " +
+                        std::to_string(captured_length) + " of " +
+                        std::to_string(string_length) +
+                        " characters of the string were captured.");
+  }
   return S_OK;
 }
 
@@ -95,13 +127,30 @@ HRESULT DbgString::ExtractStringFromReference() {
     return S_OK;
   }
 
+  CComPtr<ICorDebugStringValue> debug_string;
+  HRESULT hr = GetICorDebugStringValue(&debug_string);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  hr = debug_helper_->ExtractStringFromICorDebugStringValue(
+      debug_string, &string_obj_, GetErrorStream());
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  string_obj_set_ = true;
+  return S_OK;
+}
+
+HRESULT DbgString::GetICorDebugStringValue(
+    ICorDebugStringValue **debug_string) {
   if (!object_handle_) {
     return E_INVALIDARG;
   }
 
   HRESULT hr;
   CComPtr<ICorDebugValue> debug_value;
-  CComPtr<ICorDebugStringValue> debug_string;
 
   hr = object_handle_->Dereference(&debug_value);
 
@@ -111,20 +160,13 @@ HRESULT DbgString::ExtractStringFromReference() {
   }
 
   hr = debug_value->QueryInterface(__uuidof(ICorDebugStringValue),
-                                   reinterpret_cast<void **>(&debug_string));
+                                   reinterpret_cast<void **>(debug_string));
 
   if (FAILED(hr)) {
     WriteError("Failed to convert to ICorDebugStringValue.");
     return hr;
   }
 
-  hr = debug_helper_->ExtractStringFromICorDebugStringValue(
-      debug_string, &string_obj_, GetErrorStream());
-  if (FAILED(hr)) {
-    return hr;
-  }
-
-  string_obj_set_ = true;
   return S_OK;
 }
 
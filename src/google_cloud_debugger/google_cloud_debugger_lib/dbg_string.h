@@ -15,6 +15,8 @@
 #ifndef DBG_STRING_H_
 #define DBG_STRING_H_
 
+#include <cstdint>
+
 #include "dbg_reference_object.h"
 
 namespace google_cloud_debugger {
@@ -34,7 +36,8 @@ class DbgString : public DbgReferenceObject {
     cor_element_type_ = CorElementType::ELEMENT_TYPE_STRING;
   }
 
-  DbgString(ICorDebugType *pType, std::shared_ptr<ICorDebugHelper> debug_helper)
+  DbgString(ICorDebugType *pType,
+            const std::shared_ptr<ICorDebugHelper> &debug_helper)
       : DbgReferenceObject(pType, 0, debug_helper,
                            std::shared_ptr<IDbgObjectFactory>()) {}
 
@@ -43,6 +46,9 @@ class DbgString : public DbgReferenceObject {
 
   // Dereferences string_handle_ to get the underlying object
   // and sets the value of variable to that object.
+  // At most GetMaxCapturedLength() characters are captured. If the
+  // string is longer, a non-error status with the length of the whole
+  // string is set on variable.
   HRESULT PopulateValue(
       google::cloud::diagnostics::debug::Variable *variable) override;
 
@@ -51,9 +57,27 @@ class DbgString : public DbgReferenceObject {
 
   // Extracts string from DbgObject.
   // Fails if DbgObject is not a DbgString.
+  // Unlike PopulateValue, this extracts the whole string.
   static HRESULT GetString(DbgObject *object, std::string *returned_string);
 
+  // Default maximum number of characters of a string that are captured.
+  static const std::uint32_t kDefaultMaxCapturedLength = 4096;
+
+  // Sets the maximum number of characters of a string that PopulateValue
+  // captures.
+  static void SetMaxCapturedLength(std::uint32_t max_length) {
+    max_captured_length_ = max_length;
+  }
+
+  // Returns the maximum number of characters of a string that
+  // PopulateValue captures.
+  static std::uint32_t GetMaxCapturedLength() { return max_captured_length_; }
+
  private:
+  // Dereferences the string handle and returns the underlying string
+  // in debug_string.
+  HRESULT GetICorDebugStringValue(ICorDebugStringValue **debug_string);
+
   // Dereferences the string handle and extracts out the string
   // into string_obj_. Will not do anything if string_obj_set_ is true.
   HRESULT ExtractStringFromReference();
@@ -63,6 +87,10 @@ class DbgString : public DbgReferenceObject {
 
   // True if string_obj_ is set.
   bool string_obj_set_ = false;
+
+  // The maximum number of characters of a string that PopulateValue
+  // captures.
+  static std::uint32_t max_captured_length_;
 };
 
 }  //  namespace google_cloud_debugger
@@ -20,6 +20,7 @@
 
 #include "cor.h"
 #include "cordebug.h"
+#include "dbg_string.h"
 #include "dbgshim.h"
 #include "debugger_callback.h"
 #include "i_cor_debug_helper.h"
@@ -97,6 +98,10 @@ HRESULT Debugger::CancelSyncBreakpoints() {
   return debugger_callback_->CancelSyncBreakpoints();
 }
 
+void Debugger::SetMaxStringLength(std::uint32_t max_length) {
+  DbgString::SetMaxCapturedLength(max_length);
+}
+
 HRESULT Debugger::StartDebugging(DWORD process_id, bool kill_proc) {
   HRESULT hr;
 
@@ -115,6 +120,11 @@ HRESULT Debugger::StartDebugging(DWORD process_id, bool kill_proc) {
     return hr;
   }
 
+  debugger_callback_->SetPdbParsingThreads(pdb_parsing_threads_);
+  debugger_callback_->SetSymbolCacheDirectory(symbol_cache_directory_);
+  debugger_callback_->SetPipeFramingVersion(pipe_framing_version_);
+  debugger_callback_->SetSnapshotQueueSize(snapshot_queue_size_);
+
   // Using the processId, we register for debugging. If the process is ready,
   // it will call the CallbackFunction that we passed to
   // RegisterForRuntimeStartup.
@@ -15,6 +15,7 @@
 #ifndef DEBUGGER_H_
 #define DEBUGGER_H_
 
+#include <cstdint>
 #include <string>
 
 #include "ccomptr.h"
@@ -66,10 +67,55 @@ class Debugger final {
     debugger_callback_->SetMethodEvaluation(eval);
   }
 
+  // Sets the maximum number of threads used to parse the PDB files of
+  // loaded modules in the background. 0 disables background parsing.
+  // This has to be called before StartDebugging.
+  void SetPdbParsingThreads(std::uint32_t max_threads) {
+    pdb_parsing_threads_ = max_threads;
+  }
+
+  // Sets the directory of the on-disk symbol cache. The parsed content of
+  // PDB files is cached there so that later runs can skip parsing them.
+  // This has to be called before StartDebugging.
+  void SetSymbolCacheDirectory(const std::string &directory) {
+    symbol_cache_directory_ = directory;
+  }
+
+  // Sets the maximum number of characters of a string that are captured.
+  // Longer strings are truncated.
+  void SetMaxStringLength(std::uint32_t max_length);
+
+  // Sets the version of the pipe protocol used to frame breakpoint
+  // messages. Must be kSentinelFramingVersion (the default) or
+  // kLengthPrefixedFramingVersion and must match the agent.
+  // This has to be called before StartDebugging.
+  void SetPipeFramingVersion(std::uint8_t framing_version) {
+    pipe_framing_version_ = framing_version;
+  }
+
+  // Sets the maximum number of snapshots that can wait to be written to
+  // the agent after the debuggee resumes. 0 writes snapshots before the
+  // debuggee resumes. This has to be called before StartDebugging.
+  void SetSnapshotQueueSize(std::uint32_t queue_size) {
+    snapshot_queue_size_ = queue_size;
+  }
+
  private:
   // The name of the pipe the debugger will use to communicate with the agent.
   std::string pipe_name_;
 
+  // Maximum number of threads used to parse PDB files in the background.
+  std::uint32_t pdb_parsing_threads_ = 0;
+
+  // Directory of the on-disk symbol cache. Empty if the cache is disabled.
+  std::string symbol_cache_directory_;
+
+  // Version of the pipe protocol used to frame breakpoint messages.
+  std::uint8_t pipe_framing_version_ = kSentinelFramingVersion;
+
+  // Maximum number of snapshots that can wait to be written to the agent.
+  std::uint32_t snapshot_queue_size_ = SnapshotWriter::kDefaultMaxPending;
+
   // The unregister token that is used in the callback function to
   // unregister for runtime startup.
   void *unregister_token_;
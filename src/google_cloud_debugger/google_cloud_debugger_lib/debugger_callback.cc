@@ -23,11 +23,13 @@
 #include "breakpoint_collection.h"
 #include "ccomptr.h"
 #include "constants.h"
+#include "dbg_class.h"
 #include "dbg_stack_frame.h"
 #include "cor_debug_helper.h"
 #include "portable_pdb_file.h"
 #include "eval_coordinator.h"
 
+using google_cloud_debugger_portable_pdb::BackgroundPdbParser;
 using google_cloud_debugger_portable_pdb::IPortablePdbFile;
 using google_cloud_debugger_portable_pdb::PortablePdbFile;
 using std::cerr;
@@ -184,8 +186,8 @@ HRESULT STDMETHODCALLTYPE DebuggerCallback::EvalException(
 
 HRESULT DebuggerCallback::LoadModule(ICorDebugAppDomain *appdomain,
                                      ICorDebugModule *debug_module) {
-  std::unique_ptr<IPortablePdbFile> portable_pdb(new (std::nothrow)
-                                                     PortablePdbFile());
+  std::unique_ptr<PortablePdbFile> portable_pdb(new (std::nothrow)
+                                                    PortablePdbFile());
   if (!portable_pdb) {
     cerr << "Cannot create PortablePdbFile object.";
     appdomain->Continue(FALSE);
@@ -198,11 +200,45 @@ HRESULT DebuggerCallback::LoadModule(ICorDebugAppDomain *appdomain,
     return appdomain->Continue(FALSE);
   }
 
+  if (!symbol_cache_directory_.empty()) {
+    portable_pdb->SetSymbolCacheDirectory(symbol_cache_directory_);
+  }
+
   portable_pdbs_.push_back(std::move(portable_pdb));
+  if (pdb_parser_) {
+    pdb_parser_->Enqueue(portable_pdbs_.back());
+  }
 
   return appdomain->Continue(FALSE);
 }
 
+HRESULT DebuggerCallback::UnloadModule(ICorDebugAppDomain *appdomain,
+                                       ICorDebugModule *debug_module) {
+  for (auto &&portable_pdb : portable_pdbs_) {
+    CComPtr<ICorDebugModule> pdb_module;
+    HRESULT hr = portable_pdb->GetDebugModule(&pdb_module);
+    if (SUCCEEDED(hr) && pdb_module == debug_module) {
+      portable_pdb->GetMethodTokenCache()->Clear();
+    }
+  }
+
+  DbgClass::GetTypeLayoutCache()->ClearModule(debug_module);
+  return appdomain->Continue(FALSE);
+}
+
+void DebuggerCallback::SetPdbParsingThreads(std::uint32_t max_threads) {
+  if (max_threads == 0) {
+    pdb_parser_.reset();
+    return;
+  }
+
+  pdb_parser_ = std::unique_ptr<BackgroundPdbParser>(
+      new (std::nothrow) BackgroundPdbParser(max_threads, debug_helper_));
+  if (!pdb_parser_) {
+    cerr << "Failed to create BackgroundPdbParser.";
+  }
+}
+
 HRESULT STDMETHODCALLTYPE DebuggerCallback::CustomNotification(
     ICorDebugThread *debug_thread, ICorDebugAppDomain *appdomain) {
   return appdomain->Continue(FALSE);
@@ -16,13 +16,17 @@
 #define DEBUGGERCALLBACK_H_
 
 #include <atomic>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 
+#include "background_pdb_parser.h"
 #include "i_breakpoint_collection.h"
 #include "cor.h"
+#include "constants.h"
 #include "cordebug.h"
 #include "corsym.h"
+#include "snapshot_writer.h"
 #include "i_eval_coordinator.h"
 
 namespace google_cloud_debugger {
@@ -67,6 +71,13 @@ class DebuggerCallback final : public ICorDebugManagedCallback,
   HRESULT STDMETHODCALLTYPE LoadModule(ICorDebugAppDomain *appdomain,
                                        ICorDebugModule *debug_module) override;
 
+  // This method is called when a module is unloaded. The method tokens
+  // and functions cached for the PDB of the module and the cached type
+  // layouts of the module are dropped since they are only valid while
+  // the module is loaded.
+  HRESULT STDMETHODCALLTYPE UnloadModule(
+      ICorDebugAppDomain *appdomain, ICorDebugModule *debug_module) override;
+
   // This method is called when the process the debugger is watching exits.
   HRESULT STDMETHODCALLTYPE ExitProcess(ICorDebugProcess *process) override;
 
@@ -96,8 +107,6 @@ class DebuggerCallback final : public ICorDebugManagedCallback,
                         ICorDebugThread *debug_thread);
   DEBUGGERCALLBACK_STUB(ExitThread, ICorDebugAppDomain,
                         ICorDebugThread *debug_thread);
-  DEBUGGERCALLBACK_STUB(UnloadModule, ICorDebugAppDomain,
-                        ICorDebugModule *debug_module);
   DEBUGGERCALLBACK_STUB(LoadClass, ICorDebugAppDomain,
                         ICorDebugClass *debug_class);
   DEBUGGERCALLBACK_STUB(UnloadClass, ICorDebugAppDomain,
@@ -195,9 +204,42 @@ class DebuggerCallback final : public ICorDebugManagedCallback,
     eval_coordinator_->SetMethodEvaluation(eval);
   }
 
+  // Sets the maximum number of threads used to parse the PDB files of
+  // loaded modules in the background. If max_threads is 0 (the default),
+  // PDB files are only parsed when a breakpoint needs them.
+  // This should be called before the debuggee starts loading modules.
+  void SetPdbParsingThreads(std::uint32_t max_threads);
+
+  // Sets the directory of the on-disk symbol cache that the PDB files
+  // of loaded modules use. An empty directory disables the cache.
+  // This should be called before the debuggee starts loading modules.
+  void SetSymbolCacheDirectory(const std::string &directory) {
+    symbol_cache_directory_ = directory;
+  }
+
   // Gets the name of the pipe the debugger will use to communicate with
   // the agent.
   std::string GetPipeName() { return pipe_name_; }
+
+  // Sets the version of the pipe protocol used to frame breakpoint
+  // messages sent to and received from the agent.
+  void SetPipeFramingVersion(std::uint8_t framing_version) {
+    pipe_framing_version_ = framing_version;
+  }
+
+  // Gets the version of the pipe protocol used to frame breakpoint
+  // messages sent to and received from the agent.
+  std::uint8_t GetPipeFramingVersion() { return pipe_framing_version_; }
+
+  // Sets the maximum number of snapshots that can wait to be written
+  // to the agent. 0 writes snapshots before the debuggee resumes.
+  void SetSnapshotQueueSize(std::uint32_t queue_size) {
+    snapshot_queue_size_ = queue_size;
+  }
+
+  // Gets the maximum number of snapshots that can wait to be written
+  // to the agent.
+  std::uint32_t GetSnapshotQueueSize() { return snapshot_queue_size_; }
   
  private:
   // Given an ICorDebugBreakpoint, gets the function token, IL offset
@@ -220,6 +262,14 @@ class DebuggerCallback final : public ICorDebugManagedCallback,
       std::shared_ptr<google_cloud_debugger_portable_pdb::IPortablePdbFile>>
       portable_pdbs_;
 
+  // Directory of the on-disk symbol cache. Empty if the cache is disabled.
+  std::string symbol_cache_directory_;
+
+  // Parses the PDB files in portable_pdbs_ in the background.
+  // Null if background parsing is disabled.
+  std::unique_ptr<google_cloud_debugger_portable_pdb::BackgroundPdbParser>
+      pdb_parser_;
+
   // The ICorDebugProcess of the debugged process.
   CComPtr<ICorDebugProcess> debug_process_;
 
@@ -234,6 +284,12 @@ class DebuggerCallback final : public ICorDebugManagedCallback,
 
   // The name of the pipe the debugger will use to communicate with the agent.
   std::string pipe_name_;
+
+  // Version of the pipe protocol used to frame breakpoint messages.
+  std::uint8_t pipe_framing_version_ = kSentinelFramingVersion;
+
+  // Maximum number of snapshots that can wait to be written to the agent.
+  std::uint32_t snapshot_queue_size_ = SnapshotWriter::kDefaultMaxPending;
 };
 
 }  //  namespace google_cloud_debugger
@@ -25,11 +25,84 @@ using std::cerr;
 using std::max;
 using std::min;
 using std::string;
+using std::unique_ptr;
 using std::vector;
 
 namespace google_cloud_debugger_portable_pdb {
 
+bool DocumentIndex::CreateDocumentIndices(
+    const IPortablePdbFile &pdb,
+    vector<unique_ptr<IDocumentIndex>> *document_indices) {
+  assert(document_indices != nullptr);
+
+  const vector<DocumentRow> &document_table = pdb.GetDocumentTable();
+  if (document_table.size() <= 1) {
+    return true;
+  }
+
+  // We rely on the 1:1 mapping between the Method and MethodDebugInfo tables.
+  const vector<MethodDebugInformationRow> &method_debug_info_rows =
+      pdb.GetMethodDebugInfoTable();
+  vector<vector<uint32_t>> document_methods(document_table.size());
+  for (size_t method_def = 1; method_def < method_debug_info_rows.size();
+       ++method_def) {
+    // Pedantically we are ignoring methods that span multiple files.
+    uint32_t document = method_debug_info_rows[method_def].document;
+    if (document < document_methods.size()) {
+      document_methods[document].push_back(method_def);
+    }
+  }
+
+  vector<vector<uint32_t>> method_scopes = BucketScopesByMethod(pdb);
+
+  document_indices->reserve(document_indices->size() + document_table.size() -
+                            1);
+  for (size_t i = 1; i < document_table.size(); ++i) {
+    unique_ptr<DocumentIndex> document_index(new (std::nothrow)
+                                                 DocumentIndex());
+    if (!document_index ||
+        !document_index->Initialize(pdb, i, document_methods[i],
+                                    method_scopes)) {
+      return false;
+    }
+    document_indices->push_back(std::move(document_index));
+  }
+
+  return true;
+}
+
+vector<vector<uint32_t>> DocumentIndex::BucketScopesByMethod(
+    const IPortablePdbFile &pdb) {
+  const vector<LocalScopeRow> &local_scope_table = pdb.GetLocalScopeTable();
+  vector<vector<uint32_t>> method_scopes(
+      pdb.GetMethodDebugInfoTable().size());
+  for (size_t index = 1; index < local_scope_table.size(); ++index) {
+    uint32_t method_def = local_scope_table[index].method_def;
+    if (method_def < method_scopes.size()) {
+      method_scopes[method_def].push_back(index);
+    }
+  }
+
+  return method_scopes;
+}
+
 bool DocumentIndex::Initialize(const IPortablePdbFile &pdb, int doc_index) {
+  vector<uint32_t> method_defs;
+  const vector<MethodDebugInformationRow> &method_debug_info_rows =
+      pdb.GetMethodDebugInfoTable();
+  for (size_t method_def = 1; method_def < method_debug_info_rows.size();
+       ++method_def) {
+    if (method_debug_info_rows[method_def].document == doc_index) {
+      method_defs.push_back(method_def);
+    }
+  }
+
+  return Initialize(pdb, doc_index, method_defs, BucketScopesByMethod(pdb));
+}
+
+bool DocumentIndex::Initialize(const IPortablePdbFile &pdb, int doc_index,
+                               const vector<uint32_t> &method_defs,
+                               const vector<vector<uint32_t>> &method_scopes) {
   if (doc_index == 0) {
     cerr << "Document index has to be larger than 0.";
     return false;
@@ -73,22 +146,23 @@ bool DocumentIndex::Initialize(const IPortablePdbFile &pdb, int doc_index) {
     return false;
   }
 
-  // We rely on the 1:1 mapping between the Method and MethodDebugInfo tables.
-  vector<MethodDebugInformationRow> method_debug_info_rows =
+  const vector<MethodDebugInformationRow> &method_debug_info_rows =
       pdb.GetMethodDebugInfoTable();
-  size_t num_of_methods = method_debug_info_rows.size();
-  methods_.reserve(num_of_methods);
+  methods_.reserve(method_defs.size());
 
-  for (size_t method_def = 1; method_def < num_of_methods; ++method_def) {
-    MethodDebugInformationRow debug_info_row =
-        method_debug_info_rows[method_def];
-    // Pedantically we are ignoring methods that span multiple files.
-    if (debug_info_row.document != doc_index) {
-      continue;
+  for (uint32_t method_def : method_defs) {
+    if (method_def >= method_debug_info_rows.size() ||
+        method_def >= method_scopes.size()) {
+      cerr << "Method " << std::to_string(method_def)
+           << " is out of range for MethodDebugInformation table.";
+      return false;
     }
 
+    const MethodDebugInformationRow &debug_info_row =
+        method_debug_info_rows[method_def];
     MethodInfo method;
-    if (!ParseMethod(&method, pdb, debug_info_row, method_def, doc_index)) {
+    if (!ParseMethod(&method, pdb, debug_info_row, method_def, doc_index,
+                     method_scopes[method_def])) {
       cerr << "Failed to parse the method " << std::to_string(method_def)
            << " in document " << std::to_string(doc_index);
       return false;
@@ -100,9 +174,22 @@ bool DocumentIndex::Initialize(const IPortablePdbFile &pdb, int doc_index) {
   return true;
 }
 
+void DocumentIndex::InitializeFromParsedContent(string file_path,
+                                                string source_language,
+                                                string hash_algorithm,
+                                                vector<uint8_t> hash,
+                                                vector<MethodInfo> methods) {
+  file_path_ = std::move(file_path);
+  source_language_ = std::move(source_language);
+  hash_algorithm_ = std::move(hash_algorithm);
+  hash_ = std::move(hash);
+  methods_ = std::move(methods);
+}
+
 bool DocumentIndex::ParseMethod(MethodInfo *method, const IPortablePdbFile &pdb,
                                 const MethodDebugInformationRow &debug_info_row,
-                                uint32_t method_def, uint32_t doc_index) {
+                                uint32_t method_def, uint32_t doc_index,
+                                const vector<uint32_t> &scope_indices) {
   assert(method != nullptr);
 
   method->method_def = method_def;
@@ -149,12 +236,8 @@ bool DocumentIndex::ParseMethod(MethodInfo *method, const IPortablePdbFile &pdb,
       pdb.GetLocalVariableTable();
   const vector<LocalConstantRow> &local_constant_table =
       pdb.GetLocalConstantTable();
-  for (size_t index = 1; index < local_scope_table.size(); ++index) {
+  for (uint32_t index : scope_indices) {
     const LocalScopeRow &local_scope_row = local_scope_table[index];
-    if (local_scope_row.method_def != method_def) {
-      continue;
-    }
-
     Scope local_scope;
     if (!ParseScope(&local_scope, pdb, local_scope_row, local_scope_table,
                     local_variable_table, local_constant_table, method_def,
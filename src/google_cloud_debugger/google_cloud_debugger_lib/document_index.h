@@ -16,6 +16,7 @@
 #define DOCUMENT_INDEX_H_
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -135,6 +136,15 @@ class IDocumentIndex {
   // Returns the file path of this document.
   virtual const std::string &GetFilePath() const = 0;
 
+  // Returns the source language of this document.
+  virtual const std::string &GetSourceLanguage() const = 0;
+
+  // Returns the name of the hash algorithm of this document.
+  virtual const std::string &GetHashAlgorithm() const = 0;
+
+  // Returns the hash of this document.
+  virtual const std::vector<uint8_t> &GetHash() const = 0;
+
   // Returns all the methods in this document.
   virtual const std::vector<MethodInfo> &GetMethods() const = 0;
 };
@@ -142,23 +152,65 @@ class IDocumentIndex {
 // Implementation of IDocumentIndex interface.
 class DocumentIndex : public IDocumentIndex {
  public:
+  // Creates and initializes a document index for every document in the
+  // DocumentTable of the Portable PDB file pdb and appends them to
+  // document_indices. Methods are bucketed by document and local scopes
+  // by method with a single pass over each table, so the cost is linear
+  // in the size of the PDB instead of documents * methods * scopes.
+  static bool CreateDocumentIndices(
+      const IPortablePdbFile &pdb,
+      std::vector<std::unique_ptr<IDocumentIndex>> *document_indices);
+
   // Initialize this document index to the document at index doc_index
   // in the DocumentTable of the Portable PDB file pdb.
   bool Initialize(const IPortablePdbFile &pdb, int doc_index);
 
+  // Similar to Initialize but uses precomputed buckets.
+  // method_defs are the rows of the MethodDebugInformation table that
+  // belong to the document at doc_index, in increasing order.
+  // method_scopes[method_def] are the rows of the LocalScope table that
+  // belong to the method method_def, in increasing order.
+  bool Initialize(const IPortablePdbFile &pdb, int doc_index,
+                  const std::vector<std::uint32_t> &method_defs,
+                  const std::vector<std::vector<std::uint32_t>> &method_scopes);
+
   // Returns the file path of this document.
   const std::string &GetFilePath() const { return file_path_; }
 
+  // Returns the source language of this document.
+  const std::string &GetSourceLanguage() const { return source_language_; }
+
+  // Returns the name of the hash algorithm of this document.
+  const std::string &GetHashAlgorithm() const { return hash_algorithm_; }
+
+  // Returns the hash of this document.
+  const std::vector<uint8_t> &GetHash() const { return hash_; }
+
   // Returns all the methods in this document.
   const std::vector<MethodInfo> &GetMethods() const { return methods_; }
 
+  // Initializes this document index with content that was parsed
+  // before, for example content loaded from the symbol cache.
+  void InitializeFromParsedContent(std::string file_path,
+                                   std::string source_language,
+                                   std::string hash_algorithm,
+                                   std::vector<uint8_t> hash,
+                                   std::vector<MethodInfo> methods);
+
  private:
+  // Returns the rows of the LocalScope table of pdb bucketed by the
+  // method that owns them. The outer vector is indexed by method def.
+  static std::vector<std::vector<std::uint32_t>> BucketScopesByMethod(
+      const IPortablePdbFile &pdb);
+
   // Populate a method object that corresponds to MethodDebugInformationRow
   // debug_info_row. This function assumes that the method only spans
-  // 1 document.
+  // 1 document. scope_indices are the rows of the LocalScope table
+  // that belong to the method.
   bool ParseMethod(MethodInfo *method, const IPortablePdbFile &pdb,
                    const MethodDebugInformationRow &debug_info_row,
-                   std::uint32_t method_def, std::uint32_t doc_index);
+                   std::uint32_t method_def, std::uint32_t doc_index,
+                   const std::vector<std::uint32_t> &scope_indices);
 
   // Returns a Scope object that corresponds with LocalScopeRow
   // local_scope_row. The Scope object will have its variable
@@ -15,13 +15,13 @@
 #include "eval_coordinator.h"
 
 #include <chrono>
-#include <future>
 #include <iostream>
 #include <memory>
 #include <thread>
 
 #include "breakpoint.pb.h"
 #include "breakpoint_collection.h"
+#include "breakpoint_rate_limiter.h"
 #include "cor_debug_helper.h"
 #include "dbg_breakpoint.h"
 #include "dbg_class.h"
@@ -34,13 +34,40 @@ using std::lock_guard;
 using std::mutex;
 using std::unique_lock;
 using std::unique_ptr;
+using std::chrono::duration_cast;
 using std::chrono::high_resolution_clock;
+using std::chrono::microseconds;
 using std::chrono::minutes;
+using std::chrono::steady_clock;
 
 namespace google_cloud_debugger {
 
 minutes EvalCoordinator::one_minute = minutes(1);
 
+EvalCoordinator::EvalCoordinator()
+    : debug_helper_(new CorDebugHelper()),
+      obj_factory_(new DbgObjectFactory()) {}
+
+EvalCoordinator::~EvalCoordinator() {
+  {
+    lock_guard<mutex> lk(mutex_);
+    stopping_ = true;
+  }
+  capture_cv_.notify_all();
+
+  if (capture_thread_.joinable()) {
+    capture_thread_.join();
+  }
+
+  CaptureStats stats = GetCaptureStats();
+  if (stats.hits > 0) {
+    cerr << "Capture worker: " << stats.hits << " breakpoint hits, "
+         << (stats.total_latency / stats.hits).count()
+         << " us average and " << stats.max_latency.count()
+         << " us longest wait before capture." << std::endl;
+  }
+}
+
 HRESULT EvalCoordinator::CreateEval(ICorDebugEval **eval) {
   lock_guard<mutex> lk(mutex_);
 
@@ -148,10 +175,17 @@ HRESULT EvalCoordinator::ProcessBreakpoints(
 
   unique_lock<mutex> lk(mutex_);
 
-  std::future<HRESULT> print_breakpoint_task = std::async(
-      std::launch::async, &EvalCoordinator::ProcessBreakpointsTask, this,
-      breakpoint_collection, std::move(breakpoints), pdb_files);
-  print_breakpoint_tasks_.push_back(std::move(print_breakpoint_task));
+  if (!capture_thread_.joinable()) {
+    capture_thread_ = std::thread(&EvalCoordinator::CaptureLoop, this);
+  }
+
+  CaptureJob job;
+  job.breakpoint_collection = breakpoint_collection;
+  job.breakpoints = std::move(breakpoints);
+  job.pdb_files = pdb_files;
+  job.hit_time = steady_clock::now();
+  capture_jobs_.push_back(std::move(job));
+  capture_cv_.notify_one();
 
   ready_to_print_variables_ = TRUE;
   debuggercallback_can_continue_ = FALSE;
@@ -185,7 +219,9 @@ void EvalCoordinator::WaitForReadySignal() {
 void EvalCoordinator::SignalFinishedPrintingVariable() {
   {
     lock_guard<mutex> lk(mutex_);
-    DbgClass::ClearStaticCache();
+    // The debuggee resumes after this, which neuters the cached values
+    // of static members.
+    DbgClass::GetStaticMemberCache()->AdvanceGeneration();
     debuggercallback_can_continue_ = TRUE;
   }
   debugger_callback_cv_.notify_one();
@@ -231,6 +267,45 @@ BOOL EvalCoordinator::WaitingForEval() {
   return waiting_for_eval_;
 }
 
+EvalCoordinator::CaptureStats EvalCoordinator::GetCaptureStats() {
+  lock_guard<mutex> lk(mutex_);
+  return capture_stats_;
+}
+
+void EvalCoordinator::CaptureLoop() {
+  unique_lock<mutex> lk(mutex_);
+  while (true) {
+    capture_cv_.wait(lk,
+                     [this] { return stopping_ || !capture_jobs_.empty(); });
+    if (stopping_) {
+      return;
+    }
+
+    CaptureJob job = std::move(capture_jobs_.front());
+    capture_jobs_.pop_front();
+
+    microseconds latency =
+        duration_cast<microseconds>(steady_clock::now() - job.hit_time);
+    capture_stats_.hits += 1;
+    capture_stats_.total_latency += latency;
+    if (latency > capture_stats_.max_latency) {
+      capture_stats_.max_latency = latency;
+    }
+
+    // The breakpoints and PDB files of the job are released once the
+    // job is done.
+    lk.unlock();
+    HRESULT hr = ProcessBreakpointsTask(job.breakpoint_collection,
+                                        std::move(job.breakpoints),
+                                        job.pdb_files);
+    if (FAILED(hr)) {
+      cerr << "Failed to process breakpoints with HRESULT: " << std::hex
+           << hr;
+    }
+    lk.lock();
+  }
+}
+
 HRESULT EvalCoordinator::ProcessBreakpointsTask(
     IBreakpointCollection *breakpoint_collection,
     std::vector<std::shared_ptr<DbgBreakpoint>> breakpoints,
@@ -254,57 +329,137 @@ HRESULT EvalCoordinator::ProcessBreakpointsTask(
   // Creates and initializes stack frame collection based on the
   // ICorDebugStackWalk object.
   unique_ptr<IStackFrameCollection> stack_frames(
-      new (std::nothrow) StackFrameCollection(
-          std::shared_ptr<ICorDebugHelper>(new CorDebugHelper()),
-          std::shared_ptr<IDbgObjectFactory>(new DbgObjectFactory())));
+      new (std::nothrow) StackFrameCollection(debug_helper_, obj_factory_));
   if (!stack_frames) {
     cerr << "Failed to create DbgStack.";
     return E_OUTOFMEMORY;
   }
 
+  BreakpointRateLimiter *rate_limiter =
+      breakpoint_collection->GetRateLimiter();
+
   HRESULT hr = S_OK;
   for (auto &&breakpoint : breakpoints) {
-    hr = stack_frames->ProcessBreakpoint(parsed_pdb_files, breakpoint.get(),
-                                         this);
-    if (FAILED(hr)) {
-      std::cerr << "Failed to process breakpoint \"" << breakpoint->GetId()
-                << "\" with HRESULT: " << std::hex << hr;
-      Breakpoint error_breakpoint;
-      error_breakpoint.set_id(breakpoint->GetId());
-      SetErrorStatusMessage(&error_breakpoint, breakpoint->GetErrorString());
-
-      hr = breakpoint_collection->WriteBreakpoint(error_breakpoint);
-      if (FAILED(hr)) {
-        cerr << "Failed to write error breakpoint: " << std::hex << hr;
-        break;
+    // The debuggee is stopped while the breakpoint is processed.
+    steady_clock::time_point start = steady_clock::now();
+    hr = ProcessBreakpointWithinLimits(breakpoint, breakpoint_collection,
+                                       stack_frames.get(), rate_limiter,
+                                       parsed_pdb_files);
+    if (rate_limiter) {
+      std::string reason;
+      microseconds stopped_time =
+          duration_cast<microseconds>(steady_clock::now() - start);
+      if (rate_limiter->ChargeStoppedTime(breakpoint->GetId(), stopped_time,
+                                          &reason) ==
+          BreakpointRateLimiter::Decision::kDisable) {
+        breakpoint_collection->DisableBreakpoint(*breakpoint, reason);
       }
-      continue;
     }
 
-    if (!breakpoint->GetEvaluatedCondition()) {
-      std::cerr << "Breakpoint condition \"" << breakpoint->GetCondition()
-                << "\" for breakpoint \"" << breakpoint->GetId()
-                << "\" is not met.";
-      continue;
+    if (FAILED(hr)) {
+      break;
     }
+  }
 
-    Breakpoint proto_breakpoint;
-    hr = breakpoint->PopulateBreakpoint(&proto_breakpoint, stack_frames.get(),
-                                        this);
+  stack_frames.reset();
+  SignalFinishedPrintingVariable();
+  return hr;
+}
+
+HRESULT EvalCoordinator::ProcessBreakpointWithinLimits(
+    const std::shared_ptr<DbgBreakpoint> &breakpoint,
+    IBreakpointCollection *breakpoint_collection,
+    IStackFrameCollection *stack_frames, BreakpointRateLimiter *rate_limiter,
+    const std::vector<
+        std::shared_ptr<google_cloud_debugger_portable_pdb::IPortablePdbFile>>
+        &parsed_pdb_files) {
+  HRESULT hr = stack_frames->ProcessBreakpoint(parsed_pdb_files,
+                                               breakpoint.get(), this);
+  if (FAILED(hr)) {
+    std::cerr << "Failed to process breakpoint \"" << breakpoint->GetId()
+              << "\" with HRESULT: " << std::hex << hr;
+    // Status-only messages are small, so they are not built in the
+    // snapshot arena.
+    std::shared_ptr<Breakpoint> error_breakpoint =
+        std::make_shared<Breakpoint>();
+    error_breakpoint->set_id(breakpoint->GetId());
+    SetErrorStatusMessage(error_breakpoint.get(),
+                          breakpoint->GetErrorString());
+
+    hr = breakpoint_collection->QueueBreakpoint(std::move(error_breakpoint));
     if (FAILED(hr)) {
-      // We should still write the breakpoint to report the error to the user.
-      cerr << "Failed to print out variables: " << std::hex << hr;
+      cerr << "Failed to queue error breakpoint: " << std::hex << hr;
     }
+    return hr;
+  }
 
-    hr = breakpoint_collection->WriteBreakpoint(proto_breakpoint);
-    if (FAILED(hr)) {
-      cerr << "Failed to write breakpoint: " << std::hex << hr;
-      break;
+  if (!breakpoint->GetEvaluatedCondition()) {
+    std::cerr << "Breakpoint condition \"" << breakpoint->GetCondition()
+              << "\" for breakpoint \"" << breakpoint->GetId()
+              << "\" is not met.";
+    return S_FALSE;
+  }
+
+  if (breakpoint->IsLogPoint()) {
+    return QueueLogMessage(breakpoint.get(), breakpoint_collection);
+  }
+
+  // Capturing the variables is the expensive part of a snapshot, so the
+  // snapshot quota is checked before it.
+  if (rate_limiter) {
+    std::string reason;
+    BreakpointRateLimiter::Decision decision =
+        rate_limiter->AcquireSnapshot(breakpoint->GetId(), &reason);
+    if (decision == BreakpointRateLimiter::Decision::kDisable) {
+      breakpoint_collection->DisableBreakpoint(*breakpoint, reason);
+      return S_FALSE;
+    }
+
+    if (decision == BreakpointRateLimiter::Decision::kSkip) {
+      std::cerr << "Skipping snapshot of breakpoint \"" << breakpoint->GetId()
+                << "\": " << reason;
+      return S_FALSE;
     }
   }
 
-  stack_frames.reset();
-  SignalFinishedPrintingVariable();
+  std::shared_ptr<Breakpoint> proto_breakpoint = snapshot_arena_.NewSnapshot();
+  hr = breakpoint->PopulateBreakpoint(proto_breakpoint.get(), stack_frames,
+                                      this);
+  if (FAILED(hr)) {
+    // We should still write the breakpoint to report the error to the user.
+    cerr << "Failed to print out variables: " << std::hex << hr;
+  }
+
+  // The breakpoint is written by the writer thread of the breakpoint
+  // collection so the debuggee can resume without waiting for the pipe.
+  hr = breakpoint_collection->QueueBreakpoint(std::move(proto_breakpoint));
+  if (FAILED(hr)) {
+    cerr << "Failed to queue breakpoint: " << std::hex << hr;
+  }
+  return hr;
+}
+
+HRESULT EvalCoordinator::QueueLogMessage(
+    DbgBreakpoint *breakpoint, IBreakpointCollection *breakpoint_collection) {
+  std::string message;
+  HRESULT hr = breakpoint->PopulateLogMessage(&message);
+  if (FAILED(hr)) {
+    cerr << "Failed to format the message of logpoint \""
+         << breakpoint->GetId() << "\": " << std::hex << hr;
+    return S_FALSE;
+  }
+
+  // Pending messages of the same logpoint are merged into a single
+  // write by the snapshot writer. Log entries are small, so they are
+  // not built in the snapshot arena.
+  std::shared_ptr<Breakpoint> log_entry = std::make_shared<Breakpoint>();
+  log_entry->set_id(breakpoint->GetId());
+  log_entry->set_log_point(true);
+  log_entry->add_log_messages(std::move(message));
+  hr = breakpoint_collection->QueueBreakpoint(std::move(log_entry));
+  if (FAILED(hr)) {
+    cerr << "Failed to queue log message: " << std::hex << hr;
+  }
   return hr;
 }
 
@@ -16,12 +16,20 @@
 #define EVAL_COORDINATOR_H_
 
 #include <chrono>
-#include <future>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 #include "i_eval_coordinator.h"
+#include "snapshot_arena.h"
 
 namespace google_cloud_debugger {
 
+class BreakpointRateLimiter;
+class ICorDebugHelper;
+class IDbgObjectFactory;
 class IStackFrameCollection;
 
 // An EvalCoordinator object is used by DebuggerCallback object to evaluate
@@ -46,8 +54,29 @@ class IStackFrameCollection;
 // inspection on a different thread than the thread that the DebuggerCallback
 // is on. Otherwise, the DebuggerCallback thread will be blocked and
 // cannot perform evaluation.
+//
+// That thread is a single long-lived capture worker. Breakpoint hits are
+// queued to it, and it reuses the same ICorDebugHelper and
+// IDbgObjectFactory for every hit.
 class EvalCoordinator : public IEvalCoordinator {
  public:
+  // Counters of the capture worker.
+  struct CaptureStats {
+    // Number of breakpoint hits processed by the capture worker.
+    std::uint64_t hits = 0;
+
+    // Total time between a breakpoint hit and the start of its capture.
+    std::chrono::microseconds total_latency = std::chrono::microseconds(0);
+
+    // Longest time between a breakpoint hit and the start of its capture.
+    std::chrono::microseconds max_latency = std::chrono::microseconds(0);
+  };
+
+  EvalCoordinator();
+
+  // Stops the capture worker and reports its counters.
+  ~EvalCoordinator();
+
   // This method is used to create an ICorDebugEval object
   // from the active thread.
   HRESULT CreateEval(ICorDebugEval **eval) override;
@@ -72,6 +101,8 @@ class EvalCoordinator : public IEvalCoordinator {
   // can have different conditions and expressions).
   // Each breakpoint's condition will first be tested. If this is true,
   // stack frame information and expressions will be evaluated and reported.
+  // The breakpoints are processed by the capture worker, which is started
+  // on the first call.
   HRESULT ProcessBreakpoints(
       ICorDebugThread *debug_thread,
       IBreakpointCollection *breakpoint_collection,
@@ -114,7 +145,30 @@ class EvalCoordinator : public IEvalCoordinator {
   // Returns whether method call should be performed when evaluating condition.
   BOOL MethodEvaluation() override { return condition_evaluation_; }
 
+  // Returns the counters of the capture worker.
+  CaptureStats GetCaptureStats();
+
  private:
+  // A breakpoint hit waiting for the capture worker.
+  struct CaptureJob {
+    // Collection the results of the breakpoints are queued to.
+    IBreakpointCollection *breakpoint_collection;
+
+    // Breakpoints set at the location that was hit.
+    std::vector<std::shared_ptr<DbgBreakpoint>> breakpoints;
+
+    // PDB files of the loaded modules.
+    std::vector<
+        std::shared_ptr<google_cloud_debugger_portable_pdb::IPortablePdbFile>>
+        pdb_files;
+
+    // When the breakpoint was hit.
+    std::chrono::steady_clock::time_point hit_time;
+  };
+
+  // Runs the jobs in capture_jobs_ until the coordinator is destroyed.
+  void CaptureLoop();
+
   // Helper function to process a vector of multiple breakpoints at the same location
   // using the stack frame collection. The stack frame collection
   // will first be used to evaluate the breakpoint condition. If this succeeds,
@@ -126,6 +180,31 @@ class EvalCoordinator : public IEvalCoordinator {
           std::shared_ptr<google_cloud_debugger_portable_pdb::IPortablePdbFile>>
           &pdb_files);
 
+  // Processes a single breakpoint of ProcessBreakpointsTask: evaluates
+  // its condition, then captures and queues a snapshot if the condition
+  // is met and rate_limiter (which may be null) allows it. A logpoint
+  // queues its formatted message instead of a snapshot. A breakpoint
+  // that exceeds its snapshot quota is disabled through
+  // breakpoint_collection. Returns a failure only if the breakpoint
+  // could not be queued.
+  HRESULT ProcessBreakpointWithinLimits(
+      const std::shared_ptr<DbgBreakpoint> &breakpoint,
+      IBreakpointCollection *breakpoint_collection,
+      IStackFrameCollection *stack_frames, BreakpointRateLimiter *rate_limiter,
+      const std::vector<
+          std::shared_ptr<google_cloud_debugger_portable_pdb::IPortablePdbFile>>
+          &parsed_pdb_files);
+
+  // Formats the message of logpoint breakpoint and queues it to
+  // breakpoint_collection. Returns a failure only if the message could
+  // not be queued.
+  HRESULT QueueLogMessage(DbgBreakpoint *breakpoint,
+                          IBreakpointCollection *breakpoint_collection);
+
+  // The arena that snapshots are built in. It is reset between snapshots
+  // so capturing a snapshot is bump allocation and freeing it is O(1).
+  SnapshotArena snapshot_arena_;
+
   // If sets to true, object evaluation will be performed when evaluating property.
   BOOL property_evaluation_ = FALSE;
 
@@ -133,8 +212,27 @@ class EvalCoordinator : public IEvalCoordinator {
   // when evaluating condition.
   BOOL condition_evaluation_ = FALSE;
 
-  // The tasks that help us enumerate and print out variables.
-  std::vector<std::future<HRESULT>> print_breakpoint_tasks_;
+  // Helper for ICorDebug methods, shared by every capture.
+  std::shared_ptr<ICorDebugHelper> debug_helper_;
+
+  // Factory for creating DbgObject, shared by every capture.
+  std::shared_ptr<IDbgObjectFactory> obj_factory_;
+
+  // Breakpoint hits waiting for the capture worker.
+  std::deque<CaptureJob> capture_jobs_;
+
+  // Counters of the capture worker.
+  CaptureStats capture_stats_;
+
+  // True once the coordinator is being destroyed.
+  bool stopping_ = false;
+
+  // The thread that processes breakpoint hits. Started by the first
+  // call to ProcessBreakpoints.
+  std::thread capture_thread_;
+
+  // Signaled when a job is queued or the coordinator is destroyed.
+  std::condition_variable capture_cv_;
 
   // The ICorDebugThread that the active StackFrame is on.
   CComPtr<ICorDebugThread> active_debug_thread_;
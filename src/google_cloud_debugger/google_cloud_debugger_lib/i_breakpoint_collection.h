@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <mutex>
+#include <string>
 #include <vector>
 
 #include "breakpoint.pb.h"
@@ -29,6 +30,7 @@ namespace google_cloud_debugger_portable_pdb {
 
 namespace google_cloud_debugger {
 
+class BreakpointRateLimiter;
 class DbgBreakpoint;
 class DebuggerCallback;
 class IEvalCoordinator;
@@ -68,6 +70,14 @@ class IBreakpointCollection {
   virtual HRESULT WriteBreakpoint(
       const google::cloud::diagnostics::debug::Breakpoint &breakpoint) = 0;
 
+  // Queues a breakpoint to be written to the named pipe server by a
+  // dedicated writer thread, so the caller does not wait for the pipe.
+  // Returns S_FALSE if the breakpoint is dropped because too many
+  // breakpoints are waiting to be written.
+  virtual HRESULT QueueBreakpoint(
+      std::shared_ptr<google::cloud::diagnostics::debug::Breakpoint>
+          breakpoint) = 0;
+
   // Reads a breakpoint from the named pipe server.
   virtual HRESULT ReadBreakpoint(
       google::cloud::diagnostics::debug::Breakpoint *breakpoint) = 0;
@@ -81,6 +91,15 @@ class IBreakpointCollection {
       const std::vector<
           std::shared_ptr<google_cloud_debugger_portable_pdb::IPortablePdbFile>>
           &pdb_files) = 0;
+
+  // Returns the rate limiter that limits the cost of the hits of the
+  // breakpoints in this collection, or null if hits are not limited.
+  virtual BreakpointRateLimiter *GetRateLimiter() = 0;
+
+  // Deactivates breakpoint and reports reason as its error status to
+  // the named pipe server.
+  virtual HRESULT DisableBreakpoint(const DbgBreakpoint &breakpoint,
+                                    const std::string &reason) = 0;
 };
 
 }  // namespace google_cloud_debugger
@@ -15,6 +15,7 @@
 #ifndef I_CORDEBUG_HELPER_H_
 #define I_CORDEBUG_HELPER_H_
 
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <ostream>
@@ -101,6 +102,17 @@ class ICorDebugHelper {
       ICorDebugStringValue *debug_string, std::string *returned_string,
       std::ostream *err_stream) = 0;
 
+  // Extracts out at most the first max_length characters of the string
+  // from ICorDebugStringValue. string_length is set to the length of the
+  // whole string, so the string is truncated if it is larger than
+  // max_length. captured_length is set to the number of characters
+  // extracted, which is less than max_length if the last one would
+  // have split a surrogate pair.
+  virtual HRESULT ExtractStringPrefixFromICorDebugStringValue(
+      ICorDebugStringValue *debug_string, std::uint32_t max_length,
+      std::string *returned_string, std::uint32_t *string_length,
+      std::uint32_t *captured_length, std::ostream *err_stream) = 0;
+
   // Given a metadata token for the parameter param_token,
   // extracts out the parameter name.
   // metadata_import is the MetaDataImport of the module
@@ -15,12 +15,23 @@
 #ifndef I_NAMED_PIPE_H_
 #define I_NAMED_PIPE_H_
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 #include "cor.h"
 
 namespace google_cloud_debugger {
 
+// A sequence of bytes to write to a pipe.
+struct PipeBuffer {
+  // The first byte of the sequence.
+  const char *data;
+
+  // The number of bytes in the sequence.
+  std::size_t size;
+};
+
 // Functionality of a named pipe.
 class INamedPipe {
  public:
@@ -45,6 +56,17 @@ class INamedPipe {
   // Note: strings are used only as containers.
   virtual HRESULT Write(const std::string &message) = 0;
 
+  // Reads up to buffer_size bytes from the pipe into buffer and
+  // sets bytes_read to the number of bytes read. This function will
+  // block until there is a message to read. bytes_read is 0 if the
+  // other end of the pipe is closed.
+  virtual HRESULT ReadBytes(char *buffer, std::size_t buffer_size,
+                            std::size_t *bytes_read) = 0;
+
+  // Writes buffers to the pipe in order, as if they were a single
+  // message, without copying them into one buffer first.
+  virtual HRESULT WriteBuffers(const std::vector<PipeBuffer> &buffers) = 0;
+
   // Cancels any pending operations and shuts down the pipe.
   virtual HRESULT ShutDown() = 0;
 };
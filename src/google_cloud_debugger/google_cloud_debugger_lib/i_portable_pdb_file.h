@@ -25,6 +25,9 @@
 #include "cordebug.h"
 #include "document_index.h"
 #include "metadata_tables.h"
+#include "method_token_cache.h"
+#include "source_index.h"
+#include "type_name_table.h"
 
 namespace google_cloud_debugger {
   class ICorDebugHelper;
@@ -113,6 +116,24 @@ class IPortablePdbFile {
   virtual const std::vector<std::unique_ptr<IDocumentIndex>>
       &GetDocumentIndexTable() const = 0;
 
+  // Returns the index from source lines to the methods and sequence
+  // points of this PDB. Empty until the PDB is parsed.
+  virtual const SourceIndex &GetSourceIndex() const = 0;
+
+  // Finds the method whose method definition is method_def.
+  // Sets document_index to the document the method is in and
+  // method to the method. Returns false if the method is not found.
+  virtual bool FindMethodByDef(std::uint32_t method_def,
+                               const IDocumentIndex **document_index,
+                               const MethodInfo **method) const = 0;
+
+  // Finds the method whose relative virtual address in the module
+  // is virtual_addr. Sets document_index and method similar to
+  // FindMethodByDef. Returns false if the method is not found.
+  virtual bool FindMethodByVirtualAddr(std::uint32_t virtual_addr,
+                                       const IDocumentIndex **document_index,
+                                       const MethodInfo **method) const = 0;
+
   // Gets the name of the module of this PDB.
   virtual const std::string &GetModuleName() const = 0;
 
@@ -122,6 +143,15 @@ class IPortablePdbFile {
   // Gets the MetadataImport of the module of this PDB.
   virtual HRESULT GetMetaDataImport(
       IMetaDataImport **metadata_import) const = 0;
+
+  // Returns the cache of the runtime methods that the methods of this
+  // PDB resolve to in the module of this PDB.
+  virtual google_cloud_debugger::MethodTokenCache *GetMethodTokenCache() = 0;
+
+  // Returns the table of the type names of the module of this PDB.
+  // The table is shared by every stack frame in the module.
+  virtual std::shared_ptr<google_cloud_debugger::TypeNameTable>
+  GetTypeNameTable() = 0;
 };
 
 }  // namespace google_cloud_debugger_portable_pdb
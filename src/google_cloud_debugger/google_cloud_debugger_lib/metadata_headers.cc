@@ -53,18 +53,15 @@ bool ParseFrom(CustomBinaryStream *binary_reader,
     return false;
   }
 
-  vector<uint8_t> version_string_bytes(root_header->version_string_length, 0);
-
-  uint32_t bytes_read = 0;
-  if (!binary_reader->ReadBytes(version_string_bytes.data(),
-                                root_header->version_string_length,
-                                &bytes_read)) {
+  const uint8_t *version_string_bytes;
+  if (!binary_reader->ReadBytesView(root_header->version_string_length,
+                                    &version_string_bytes)) {
     return false;
   }
 
-  string temp_vers_string(version_string_bytes.begin(),
-                          version_string_bytes.end());
-  root_header->version_string = temp_vers_string;
+  root_header->version_string.assign(
+      reinterpret_cast<const char *>(version_string_bytes),
+      root_header->version_string_length);
 
   // We have to advance to the next 4 byte boundary.
   uint32_t bytes_to_skipped = 4 - (root_header->version_string_length % 4);
@@ -96,31 +93,30 @@ bool ParseFrom(CustomBinaryStream *binary_reader, StreamHeader *stream_header) {
     return false;
   }
 
-  vector<uint8_t> header_name;
-  uint8_t bytes_read = 0;
-  uint8_t character;
-  while (binary_reader->ReadByte(&character)) {
-    ++bytes_read;
-    if (character == 0) {
-      break;
-    }
+  // The name is a null-terminated string that is read in place.
+  const char *header_name;
+  uint32_t name_length = 0;
+  if (!binary_reader->GetStringView(binary_reader->Current(), &header_name,
+                                    &name_length)) {
+    return false;
+  }
 
-    header_name.push_back(character);
-    // Name cannot be longer than 32 characters.
-    if (bytes_read > 32) {
-      return false;
-    }
+  // Name cannot be longer than 32 characters.
+  if (name_length > 32) {
+    return false;
   }
 
-  // Pad until 4 boundary.
+  // Skips the name and the null character, then pads until 4 boundary.
+  uint32_t bytes_read = name_length + 1;
   uint32_t bytes_to_skipped = 4 - (bytes_read % 4);
-  if (bytes_to_skipped % 4 != 0 &&
-      !binary_reader->SeekFromCurrent(bytes_to_skipped)) {
+  if (bytes_to_skipped % 4 == 0) {
+    bytes_to_skipped = 0;
+  }
+  if (!binary_reader->SeekFromCurrent(bytes_read + bytes_to_skipped)) {
     return false;
   }
 
-  string name_string(header_name.begin(), header_name.end());
-  stream_header->name = name_string;
+  stream_header->name.assign(header_name, name_length);
 
   return true;
 }
@@ -0,0 +1,53 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "method_token_cache.h"
+
+#include <assert.h>
+
+using std::lock_guard;
+using std::mutex;
+
+namespace google_cloud_debugger {
+
+bool MethodTokenCache::Find(std::uint32_t method_def, Entry *entry) const {
+  assert(entry != nullptr);
+
+  lock_guard<mutex> lock(mutex_);
+  const auto &cached_entry = entries_.find(method_def);
+  if (cached_entry == entries_.end()) {
+    return false;
+  }
+
+  // CComPtr is copied rather than moved so the reference count is kept.
+  *entry = cached_entry->second;
+  return true;
+}
+
+void MethodTokenCache::Add(std::uint32_t method_def, const Entry &entry) {
+  lock_guard<mutex> lock(mutex_);
+  entries_[method_def] = entry;
+}
+
+void MethodTokenCache::Clear() {
+  lock_guard<mutex> lock(mutex_);
+  entries_.clear();
+}
+
+std::size_t MethodTokenCache::Size() const {
+  lock_guard<mutex> lock(mutex_);
+  return entries_.size();
+}
+
+}  // namespace google_cloud_debugger
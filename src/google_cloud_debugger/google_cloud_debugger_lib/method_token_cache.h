@@ -0,0 +1,74 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef METHOD_TOKEN_CACHE_H_
+#define METHOD_TOKEN_CACHE_H_
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "ccomptr.h"
+#include "cor.h"
+#include "cordebug.h"
+
+namespace google_cloud_debugger {
+
+// Cache of the runtime methods that the methods of a PDB resolve to.
+//
+// Resolving a method definition from a PDB to a method token means
+// enumerating every method with the same name in its type and comparing
+// their signatures and virtual addresses. This cache remembers the result
+// per module so breakpoints set later in the same method skip that.
+// This class is thread-safe.
+class MethodTokenCache {
+ public:
+  // A method that a PDB method definition resolves to.
+  struct Entry {
+    // Token of the method in the module's metadata.
+    mdMethodDef method_token = 0;
+
+    // The ICorDebugFunction of the method.
+    CComPtr<ICorDebugFunction> debug_function;
+
+    // Name of the method.
+    std::vector<WCHAR> method_name;
+  };
+
+  // Sets entry to the method that method_def resolves to.
+  // Returns false if method_def is not in the cache.
+  bool Find(std::uint32_t method_def, Entry *entry) const;
+
+  // Remembers that method_def resolves to entry.
+  void Add(std::uint32_t method_def, const Entry &entry);
+
+  // Removes all the methods from the cache. This should be called when
+  // the module is unloaded since its ICorDebugFunctions are no longer valid.
+  void Clear();
+
+  // Returns the number of methods in the cache.
+  std::size_t Size() const;
+
+ private:
+  // Map of method definition to the method it resolves to.
+  std::unordered_map<std::uint32_t, Entry> entries_;
+
+  // Protects entries_.
+  mutable std::mutex mutex_;
+};
+
+}  // namespace google_cloud_debugger
+
+#endif  // METHOD_TOKEN_CACHE_H_
@@ -17,6 +17,7 @@
 #include <errno.h>
 #include <sys/un.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include <iostream>
 
@@ -119,6 +120,62 @@ HRESULT NamedPipeClient::Write(const string &message) {
   return S_OK;
 }
 
+HRESULT NamedPipeClient::ReadBytes(char *buffer, std::size_t buffer_size,
+                                   std::size_t *bytes_read) {
+  if (buffer == nullptr || bytes_read == nullptr) {
+    return E_POINTER;
+  }
+
+  ssize_t read = recv(pipe_, buffer, buffer_size, 0);
+  if (read == -1) {
+    cerr << "recv error: " << strerror(errno) << std::endl;
+    return E_FAIL;
+  }
+
+  *bytes_read = read;
+  return S_OK;
+}
+
+HRESULT NamedPipeClient::WriteBuffers(const std::vector<PipeBuffer> &buffers) {
+  std::vector<struct iovec> iovecs;
+  iovecs.reserve(buffers.size());
+  for (const PipeBuffer &buffer : buffers) {
+    if (buffer.size == 0) {
+      continue;
+    }
+    struct iovec iov;
+    iov.iov_base = const_cast<char *>(buffer.data);
+    iov.iov_len = buffer.size;
+    iovecs.push_back(iov);
+  }
+
+  // sendmsg may write only part of the buffers, in which case the
+  // remaining bytes are sent starting from the first unwritten one.
+  std::size_t first = 0;
+  while (first < iovecs.size()) {
+    struct msghdr msg = {};
+    msg.msg_iov = &iovecs[first];
+    msg.msg_iovlen = iovecs.size() - first;
+
+    ssize_t written = sendmsg(pipe_, &msg, 0);
+    if (written == -1) {
+      cerr << "sendmsg error: " << strerror(errno) << std::endl;
+      return E_FAIL;
+    }
+
+    while (first < iovecs.size() &&
+           static_cast<std::size_t>(written) >= iovecs[first].iov_len) {
+      written -= iovecs[first].iov_len;
+      ++first;
+    }
+    if (first < iovecs.size()) {
+      iovecs[first].iov_base = static_cast<char *>(iovecs[first].iov_base) + written;
+      iovecs[first].iov_len -= written;
+    }
+  }
+  return S_OK;
+}
+
 HRESULT NamedPipeClient::ShutDown() {
   if (pipe_ == -1) {
     return S_OK;
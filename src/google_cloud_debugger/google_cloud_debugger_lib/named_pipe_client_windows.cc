@@ -120,6 +120,50 @@ HRESULT NamedPipeClient::Write(const string &message) {
   return S_OK;
 }
 
+HRESULT NamedPipeClient::ReadBytes(char *buffer, std::size_t buffer_size,
+                                   std::size_t *bytes_read) {
+  if (buffer == nullptr || bytes_read == nullptr) {
+    return E_POINTER;
+  }
+
+  DWORD read = 0;
+  DWORD to_read = buffer_size > MAXDWORD ? MAXDWORD : buffer_size;
+  BOOL success = ReadFile(pipe_, buffer, to_read, &read, NULL);
+  if (!success) {
+    std::cerr << "ReadFile error: " << HRESULT_FROM_WIN32(GetLastError())
+              << std::endl;
+    return HRESULT_FROM_WIN32(GetLastError());
+  }
+
+  *bytes_read = read;
+  return S_OK;
+}
+
+HRESULT NamedPipeClient::WriteBuffers(const std::vector<PipeBuffer> &buffers) {
+  // Windows pipes do not support gather writes so the buffers are
+  // written one after another. They are still not copied.
+  for (const PipeBuffer &buffer : buffers) {
+    const CHAR *buf = buffer.data;
+    std::size_t bytes_left = buffer.size;
+
+    while (bytes_left > 0) {
+      DWORD written = 0;
+      DWORD write = bytes_left > MAXDWORD ? MAXDWORD : bytes_left;
+
+      BOOL success = WriteFile(pipe_, buf, write, &written, NULL);
+      if (!success) {
+        std::cerr << "WriteFile error: " << HRESULT_FROM_WIN32(GetLastError())
+                  << std::endl;
+        return HRESULT_FROM_WIN32(GetLastError());
+      }
+
+      bytes_left -= written;
+      buf += written;
+    }
+  }
+  return S_OK;
+}
+
 HRESULT NamedPipeClient::ShutDown() {
   if (!pipe_) {
     return S_OK;
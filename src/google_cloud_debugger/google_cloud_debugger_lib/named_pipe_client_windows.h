@@ -36,6 +36,9 @@ class NamedPipeClient : public INamedPipe {
   HRESULT WaitForConnection() override;
   HRESULT Read(std::string *message) override;
   HRESULT Write(const std::string &message) override;
+  HRESULT ReadBytes(char *buffer, std::size_t buffer_size,
+                    std::size_t *bytes_read) override;
+  HRESULT WriteBuffers(const std::vector<PipeBuffer> &buffers) override;
   HRESULT ShutDown() override;
 
  private:
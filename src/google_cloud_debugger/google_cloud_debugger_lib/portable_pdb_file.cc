@@ -26,6 +26,7 @@
 #include "i_cor_debug_helper.h"
 #include "metadata_headers.h"
 #include "metadata_tables.h"
+#include "symbol_cache.h"
 
 using google_cloud_debugger::CComPtr;
 using google_cloud_debugger::kDllExtension;
@@ -74,10 +75,11 @@ bool PortablePdbFile::GetBlobBytes(
 }
 
 bool PortablePdbFile::ParsePdbFile() {
-  if (parsed) {
-    return true;
-  }
+  std::call_once(parse_once_, [this]() { parsed = ParsePdbFileOnce(); });
+  return parsed;
+}
 
+bool PortablePdbFile::ParsePdbFileOnce() {
   string module_name = GetModuleName();
   size_t last_dll_extension_pos = module_name.rfind(kDllExtension);
   if (last_dll_extension_pos != module_name.size() - kDllExtension.size()) {
@@ -110,23 +112,100 @@ bool PortablePdbFile::ParsePdbFile() {
     return false;
   }
 
-  if (!ParseCompressedMetadataTableStream() || !ParsePortablePdbStream()) {
+  if (!ParsePortablePdbStream()) {
     return false;
   }
 
-  if (document_table_.size() > 1) {
-    document_indices_.reserve(document_table_.size() - 1);
-    for (size_t i = 1; i < document_table_.size(); ++i) {
-      unique_ptr<DocumentIndex> document_index(new (std::nothrow)
-                                                   DocumentIndex());
-      if (!document_index || !document_index->Initialize(*this, i)) {
+  if (symbol_cache_directory_.empty()) {
+    if (!ParseCompressedMetadataTableStream() ||
+        !DocumentIndex::CreateDocumentIndices(*this, &document_indices_)) {
+      return false;
+    }
+  } else {
+    // The PDB id identifies the content of the PDB, the file size is
+    // an extra check against a cache file written for another PDB.
+    SymbolCache symbol_cache(symbol_cache_directory_);
+    const PdbId &pdb_id = pdb_metadata_header_.pdb_id;
+    std::uint32_t pdb_file_size = pdb_file_binary_stream_.GetLength();
+    if (!symbol_cache.Load(pdb_id, pdb_file_size, &document_table_,
+                           &method_debug_info_table_, &local_scope_table_,
+                           &local_variable_table_, &local_constant_table_,
+                           &document_indices_)) {
+      if (!ParseCompressedMetadataTableStream() ||
+          !DocumentIndex::CreateDocumentIndices(*this, &document_indices_)) {
         return false;
       }
-      document_indices_.push_back(std::move(document_index));
+
+      // Failing to write the cache only costs time on the next run.
+      symbol_cache.Store(pdb_id, pdb_file_size, *this);
     }
   }
 
-  parsed = true;
+  IndexMethods();
+  source_index_.AddDocuments(document_indices_);
+  return true;
+}
+
+void PortablePdbFile::IndexMethods() {
+  for (auto &&document_index : document_indices_) {
+    for (auto &&method : document_index->GetMethods()) {
+      MethodLocation location = {document_index.get(), &method};
+      // If a method appears more than once, the first document wins.
+      method_def_index_.emplace(method.method_def, location);
+
+      if (!metadata_import_) {
+        continue;
+      }
+
+      mdTypeDef type_def = 0;
+      ULONG method_name_length = 0;
+      DWORD flags1 = 0;
+      PCCOR_SIGNATURE signature = 0;
+      ULONG signature_blob = 0;
+      ULONG virtual_addr = 0;
+      DWORD flags2 = 0;
+      HRESULT hr = metadata_import_->GetMethodProps(
+          method.method_def, &type_def, nullptr, 0, &method_name_length,
+          &flags1, &signature, &signature_blob, &virtual_addr, &flags2);
+      if (FAILED(hr)) {
+        std::cerr << "Failed to extract method info from method "
+                  << method.method_def;
+        continue;
+      }
+
+      virtual_addr_index_.emplace(virtual_addr, location);
+    }
+  }
+}
+
+bool PortablePdbFile::FindMethodByDef(uint32_t method_def,
+                                      const IDocumentIndex **document_index,
+                                      const MethodInfo **method) const {
+  return FindMethodInIndex(method_def_index_, method_def, document_index,
+                           method);
+}
+
+bool PortablePdbFile::FindMethodByVirtualAddr(
+    uint32_t virtual_addr, const IDocumentIndex **document_index,
+    const MethodInfo **method) const {
+  return FindMethodInIndex(virtual_addr_index_, virtual_addr, document_index,
+                           method);
+}
+
+bool PortablePdbFile::FindMethodInIndex(
+    const std::unordered_map<uint32_t, MethodLocation> &index, uint32_t key,
+    const IDocumentIndex **document_index, const MethodInfo **method) {
+  if (!document_index || !method) {
+    return false;
+  }
+
+  const auto &location = index.find(key);
+  if (location == index.end()) {
+    return false;
+  }
+
+  *document_index = location->second.document_index;
+  *method = location->second.method;
   return true;
 }
 
@@ -183,25 +262,16 @@ bool PortablePdbFile::GetDocumentName(uint32_t index, string *doc_name) const {
   for (uint32_t part_index : part_indices) {
     // 0 means empty string.
     if (part_index != 0) {
-      if (!pdb_file_binary_stream_.SeekFromOrigin(blob_heap_header_.offset +
-                                                  part_index)) {
-        return false;
-      }
-
+      const uint8_t *component_string;
       uint32_t component_string_length;
-      if (!pdb_file_binary_stream_.ReadCompressedUInt32(
+      if (!pdb_file_binary_stream_.GetBlobView(
+              blob_heap_header_.offset + part_index, &component_string,
               &component_string_length)) {
         return false;
       }
 
-      uint32_t bytes_read;
-      vector<uint8_t> component_string(component_string_length, 0);
-      if (!pdb_file_binary_stream_.ReadBytes(
-              component_string.data(), component_string_length, &bytes_read)) {
-        return false;
-      }
-
-      result.append(component_string.begin(), component_string.end());
+      result.append(reinterpret_cast<const char *>(component_string),
+                    component_string_length);
     }
 
     result += separator;
@@ -222,39 +292,26 @@ bool PortablePdbFile::GetHeapGuid(uint32_t index, string *guid) const {
     return false;
   }
 
-  guid->clear();
-  vector<uint8_t> bytes_read(16, 0);
-  uint32_t num_bytes_read;
-
-  if (!pdb_file_binary_stream_.ReadBytes(bytes_read.data(), bytes_read.size(),
-                                         &num_bytes_read)) {
+  const uint8_t *guid_bytes;
+  if (!pdb_file_binary_stream_.ReadBytesView(16, &guid_bytes)) {
     std::cerr << "Failed to read from GUID heap.";
     return false;
   }
 
-  guid->append(bytes_read.begin(), bytes_read.end());
+  guid->assign(reinterpret_cast<const char *>(guid_bytes), 16);
   return true;
 }
 
 bool PortablePdbFile::GetHash(uint32_t index, vector<uint8_t> *hash) const {
-  if (!pdb_file_binary_stream_.SeekFromOrigin(blob_heap_header_.offset +
-                                              index)) {
-    return false;
-  }
-
-  uint32_t data_length;
-  if (!pdb_file_binary_stream_.ReadCompressedUInt32(&data_length)) {
-    return false;
-  }
-
-  hash->resize(data_length);
-  uint32_t bytes_read = 0;
-  if (!pdb_file_binary_stream_.ReadBytes(hash->data(), hash->size(),
-                                         &bytes_read)) {
+  const uint8_t *hash_bytes;
+  uint32_t hash_length;
+  if (!pdb_file_binary_stream_.GetBlobView(blob_heap_header_.offset + index,
+                                           &hash_bytes, &hash_length)) {
     std::cerr << "Failed to read the hash from the heap blob stream.";
     return false;
   }
 
+  hash->assign(hash_bytes, hash_bytes + hash_length);
   return true;
 }
 
@@ -16,7 +16,9 @@
 #define PORTABLE_PDB_H_
 
 #include <cstdint>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "custom_binary_reader.h"
@@ -47,8 +49,19 @@ class PortablePdbFile : public IPortablePdbFile {
 
   // Parses the pdb file. The name of the file will come from the
   // ICorDebugModule object that is used to initialize this object.
+  // This function is thread-safe. The file is only parsed once; if
+  // another thread is parsing it, this call waits for that parse to
+  // finish and returns its result.
   bool ParsePdbFile();
 
+  // Sets the directory of the on-disk symbol cache. If set, ParsePdbFile
+  // loads the parsed tables and document indices from the cache when they
+  // are there and stores them in the cache when they are not.
+  // Has to be called before ParsePdbFile.
+  void SetSymbolCacheDirectory(std::string directory) {
+    symbol_cache_directory_ = std::move(directory);
+  }
+
   // Finds the stream header with a given name. Returns false if not found.
   // name is the name of the stream header.
   // stream_header is the stream header that has name name.
@@ -108,6 +121,19 @@ class PortablePdbFile : public IPortablePdbFile {
     return document_indices_;
   }
 
+  // Returns the index from source lines to the methods of this PDB.
+  const SourceIndex &GetSourceIndex() const { return source_index_; }
+
+  // Finds the method whose method definition is method_def.
+  bool FindMethodByDef(std::uint32_t method_def,
+                       const IDocumentIndex **document_index,
+                       const MethodInfo **method) const;
+
+  // Finds the method whose relative virtual address is virtual_addr.
+  bool FindMethodByVirtualAddr(std::uint32_t virtual_addr,
+                               const IDocumentIndex **document_index,
+                               const MethodInfo **method) const;
+
   // Gets the name of the module of this PDB.
   const std::string &GetModuleName() const { return module_name_; }
 
@@ -117,6 +143,16 @@ class PortablePdbFile : public IPortablePdbFile {
   // Gets the MetadataImport of the module of this PDB.
   HRESULT GetMetaDataImport(IMetaDataImport **metadata_import) const;
 
+  // Returns the cache of the runtime methods of the module of this PDB.
+  google_cloud_debugger::MethodTokenCache *GetMethodTokenCache() {
+    return &method_token_cache_;
+  }
+
+  // Returns the table of the type names of the module of this PDB.
+  std::shared_ptr<google_cloud_debugger::TypeNameTable> GetTypeNameTable() {
+    return type_name_table_;
+  }
+
  private:
   // Name of the module that corresponds to this PDB.
   std::string module_name_;
@@ -155,15 +191,41 @@ class PortablePdbFile : public IPortablePdbFile {
   // This vector is used to cache the strings.
   mutable std::vector<std::string> heap_strings_;
 
+  // Directory of the on-disk symbol cache. Empty if the cache is disabled.
+  std::string symbol_cache_directory_;
+
   // Vector of all document indices inside this pdb.
   std::vector<std::unique_ptr<IDocumentIndex>> document_indices_;
 
+  // Index from source lines to the methods in document_indices_.
+  SourceIndex source_index_;
+
+  // A method in document_indices_ and the document it is in.
+  struct MethodLocation {
+    const IDocumentIndex *document_index;
+    const MethodInfo *method;
+  };
+
+  // Map of method definition to the method in document_indices_.
+  std::unordered_map<std::uint32_t, MethodLocation> method_def_index_;
+
+  // Map of relative virtual address to the method in document_indices_.
+  // Only populated if the metadata import of the module is available.
+  std::unordered_map<std::uint32_t, MethodLocation> virtual_addr_index_;
+
   // The ICorDebugModule of the module of this PDB.
   google_cloud_debugger::CComPtr<ICorDebugModule> debug_module_;
 
   // The IMetaDataImport of the module of this PDB.
   google_cloud_debugger::CComPtr<IMetaDataImport> metadata_import_;
 
+  // Runtime methods that the methods of this PDB resolve to.
+  google_cloud_debugger::MethodTokenCache method_token_cache_;
+
+  // Names of the types defined in and referenced by the module of this PDB.
+  std::shared_ptr<google_cloud_debugger::TypeNameTable> type_name_table_ =
+      std::make_shared<google_cloud_debugger::TypeNameTable>();
+
   // Template function to parse row for a specific metadata table.
   template <typename TableRow>
   bool ParseMetadataTableRow(uint32_t rows_in_table,
@@ -202,7 +264,23 @@ class PortablePdbFile : public IPortablePdbFile {
   // Parses the compressed metadata tables stream.
   bool ParseCompressedMetadataTableStream();
 
-  // True if ParsePdbFile method is already called.
+  // Does the actual parsing of the pdb file for ParsePdbFile.
+  bool ParsePdbFileOnce();
+
+  // Populates method_def_index_ and virtual_addr_index_ from the
+  // methods in document_indices_.
+  void IndexMethods();
+
+  // Helper to look up key in index and set document_index and method.
+  static bool FindMethodInIndex(
+      const std::unordered_map<std::uint32_t, MethodLocation> &index,
+      std::uint32_t key, const IDocumentIndex **document_index,
+      const MethodInfo **method);
+
+  // Makes sure ParsePdbFileOnce is only called once.
+  std::once_flag parse_once_;
+
+  // True if the pdb file was parsed successfully.
   bool parsed = false;
 };
 
@@ -0,0 +1,78 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "snapshot_arena.h"
+
+using google::cloud::diagnostics::debug::Breakpoint;
+using google::protobuf::Arena;
+using google::protobuf::ArenaOptions;
+using std::lock_guard;
+using std::mutex;
+
+namespace google_cloud_debugger {
+
+const std::size_t SnapshotArena::kDefaultInitialBlockSize;
+const std::size_t SnapshotArena::kMaxBlockSize;
+const std::size_t SnapshotArena::kMaxGenerations;
+
+SnapshotArena::Generation::Generation(std::size_t initial_block_size)
+    : initial_block(new char[initial_block_size]) {
+  ArenaOptions options;
+  options.initial_block = initial_block.get();
+  options.initial_block_size = initial_block_size;
+  options.max_block_size = kMaxBlockSize;
+  arena = std::unique_ptr<Arena>(new Arena(options));
+}
+
+SnapshotArena::SnapshotArena(std::size_t initial_block_size)
+    : initial_block_size_(initial_block_size) {}
+
+std::shared_ptr<Breakpoint> SnapshotArena::NewSnapshot() {
+  lock_guard<mutex> lock(mutex_);
+  std::shared_ptr<Generation> generation;
+  for (const auto &kept_generation : generations_) {
+    if (kept_generation.use_count() == 1) {
+      // Nothing points into the arena anymore. Resetting it frees the
+      // earlier snapshots and keeps the initial block for the next one.
+      kept_generation->arena->Reset();
+      generation = kept_generation;
+      break;
+    }
+  }
+
+  if (!generation) {
+    generation = std::make_shared<Generation>(initial_block_size_);
+    if (generations_.size() < kMaxGenerations) {
+      generations_.push_back(generation);
+    }
+  }
+  current_ = generation;
+
+  Breakpoint *snapshot =
+      Arena::CreateMessage<Breakpoint>(generation->arena.get());
+  // The returned pointer owns a reference to the generation, so the
+  // arena outlives the snapshot.
+  return std::shared_ptr<Breakpoint>(std::move(generation), snapshot);
+}
+
+std::size_t SnapshotArena::SpaceAllocated() {
+  lock_guard<mutex> lock(mutex_);
+  std::shared_ptr<Generation> current = current_.lock();
+  if (!current) {
+    return 0;
+  }
+  return current->arena->SpaceAllocated();
+}
+
+}  //  namespace google_cloud_debugger
@@ -0,0 +1,100 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SNAPSHOT_ARENA_H_
+#define SNAPSHOT_ARENA_H_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "breakpoint.pb.h"
+
+namespace google_cloud_debugger {
+
+// Allocates snapshots on a google::protobuf::Arena so that every
+// Variable, StackFrame and Status of a snapshot is bump allocated and
+// the whole snapshot is freed at once instead of message by message.
+//
+// The first block of the arena is owned by the SnapshotArena and is
+// kept when the arena is reset, so snapshots that fit in it are built
+// without touching the heap once the block is warm.
+//
+// A snapshot is usually still waiting to be written by the
+// SnapshotWriter when the next one is captured. Each snapshot therefore
+// shares ownership of the arena it lives in, and up to kMaxGenerations
+// arenas are kept. A new snapshot reuses the first kept arena whose
+// snapshot has been written. If all of them are still in use, it gets
+// an arena of its own that is freed once that snapshot is written.
+//
+// Only snapshots should be built here. Log entries and status-only
+// messages are small and would tie up a whole initial block each.
+class SnapshotArena {
+ public:
+  // Default size of the block that is kept across resets.
+  static const std::size_t kDefaultInitialBlockSize = 256 * 1024;
+
+  // Largest block the arena allocates when a snapshot outgrows the
+  // initial block.
+  static const std::size_t kMaxBlockSize = 1024 * 1024;
+
+  // Maximum number of arenas kept for reuse.
+  static const std::size_t kMaxGenerations = 4;
+
+  // Creates a SnapshotArena that keeps initial_block_size bytes across
+  // resets.
+  explicit SnapshotArena(
+      std::size_t initial_block_size = kDefaultInitialBlockSize);
+
+  // Returns an empty snapshot allocated on an arena that no other
+  // snapshot is using. The snapshots that were built in that arena
+  // before are freed.
+  std::shared_ptr<google::cloud::diagnostics::debug::Breakpoint>
+  NewSnapshot();
+
+  // Returns the number of bytes allocated by the arena of the last
+  // snapshot, or 0 if that snapshot and its arena are freed.
+  std::size_t SpaceAllocated();
+
+ private:
+  // An arena together with its initial block.
+  struct Generation {
+    explicit Generation(std::size_t initial_block_size);
+
+    // The first block of arena. Declared before arena so that it
+    // outlives it.
+    std::unique_ptr<char[]> initial_block;
+
+    // The arena the snapshots are allocated on.
+    std::unique_ptr<google::protobuf::Arena> arena;
+  };
+
+  // Size of the initial block of each generation.
+  std::size_t initial_block_size_;
+
+  // The arenas kept for reuse. An arena is free once the reference
+  // held here is the only one left.
+  std::vector<std::shared_ptr<Generation>> generations_;
+
+  // The arena of the last snapshot.
+  std::weak_ptr<Generation> current_;
+
+  // Protects generations_ and current_.
+  std::mutex mutex_;
+};
+
+}  //  namespace google_cloud_debugger
+
+#endif  //  SNAPSHOT_ARENA_H_
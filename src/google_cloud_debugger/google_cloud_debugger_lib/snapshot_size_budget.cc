@@ -0,0 +1,32 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "snapshot_size_budget.h"
+
+namespace google_cloud_debugger {
+
+std::int64_t SnapshotSizeBudget::GetFieldSize(std::int64_t payload_size) {
+  // 1 byte for the tag and 1 byte per 7 bits of the varint length.
+  std::int64_t size = 1 + payload_size;
+  std::uint64_t length = static_cast<std::uint64_t>(payload_size);
+  do {
+    ++size;
+    length >>= 7;
+  } while (length != 0);
+
+  return size;
+}
+
+}  // namespace google_cloud_debugger
@@ -0,0 +1,76 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef SNAPSHOT_SIZE_BUDGET_H_
+#define SNAPSHOT_SIZE_BUDGET_H_
+
+#include <cstdint>
+
+namespace google_cloud_debugger {
+
+// Keeps track of the serialized size of a snapshot (or part of one)
+// while it is being populated, so the size limit of the snapshot can
+// be checked without calling ByteSize() on the whole message, which
+// walks every variable that has been captured so far.
+//
+// Callers measure the variable they just populated (which only contains
+// its own fields and the names of its members at that point) and report
+// the change with UpdateField. The growth of the length prefixes of the
+// ancestors of the variable is reported with Add (see
+// VariableWrapper::PerformBFS).
+class SnapshotSizeBudget {
+ public:
+  // Creates a budget of max_size bytes of which used_size bytes are
+  // already used.
+  SnapshotSizeBudget(std::int64_t max_size, std::int64_t used_size = 0)
+      : max_size_(max_size), used_size_(used_size) {}
+
+  // Adds size bytes to the used size.
+  void Add(std::int64_t size) { used_size_ += size; }
+
+  // Accounts for a length-delimited field (for example a Variable that is
+  // a member of another message) whose payload grew from old_size to
+  // new_size bytes. This includes the change in the size of its length
+  // prefix.
+  void UpdateField(std::int64_t old_size, std::int64_t new_size) {
+    used_size_ += GetFieldSize(new_size) - GetFieldSize(old_size);
+  }
+
+  // Returns true if more than the maximum size is used.
+  bool IsExhausted() const { return used_size_ > max_size_; }
+
+  // Returns the number of bytes used.
+  std::int64_t GetUsedSize() const { return used_size_; }
+
+  // Returns the number of bytes left. This is negative if the budget
+  // is exhausted.
+  std::int64_t GetRemainingSize() const { return max_size_ - used_size_; }
+
+  // Returns the serialized size of a length-delimited field with a payload
+  // of payload_size bytes. Every message field in breakpoint.proto has a
+  // field number below 16, so the tag is always 1 byte.
+  static std::int64_t GetFieldSize(std::int64_t payload_size);
+
+ private:
+  // The maximum number of bytes.
+  std::int64_t max_size_;
+
+  // The number of bytes used.
+  std::int64_t used_size_;
+};
+
+}  // namespace google_cloud_debugger
+
+#endif  // SNAPSHOT_SIZE_BUDGET_H_
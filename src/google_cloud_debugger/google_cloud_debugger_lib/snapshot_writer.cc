@@ -0,0 +1,182 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "snapshot_writer.h"
+
+#include <iostream>
+
+using google::cloud::diagnostics::debug::Breakpoint;
+using std::cerr;
+using std::lock_guard;
+using std::mutex;
+using std::unique_lock;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+namespace google_cloud_debugger {
+
+const milliseconds SnapshotWriter::kDefaultMaxWait = milliseconds(1000);
+
+SnapshotWriter::SnapshotWriter(WriteFunction write, std::size_t max_pending,
+                               milliseconds max_wait)
+    : write_(write),
+      max_pending_(max_pending == 0 ? 1 : max_pending),
+      max_wait_(max_wait) {}
+
+SnapshotWriter::~SnapshotWriter() { Stop(); }
+
+HRESULT SnapshotWriter::Enqueue(std::shared_ptr<Breakpoint> breakpoint) {
+  if (!breakpoint) {
+    return E_INVALIDARG;
+  }
+
+  unique_lock<mutex> lock(mutex_);
+  if (stopping_) {
+    cerr << "Snapshot writer is stopped." << std::endl;
+    return E_FAIL;
+  }
+
+  if (!writer_thread_.joinable()) {
+    writer_thread_ = std::thread(&SnapshotWriter::WriteLoop, this);
+  }
+
+  if (queue_.size() >= max_pending_) {
+    auto start = steady_clock::now();
+    bool has_space = space_cv_.wait_for(lock, max_wait_, [this] {
+      return stopping_ || queue_.size() < max_pending_;
+    });
+    stats_.wait_time += duration_cast<microseconds>(steady_clock::now() - start);
+    if (!has_space || stopping_) {
+      stats_.dropped += 1;
+      cerr << "Snapshot queue is full, dropping snapshot of breakpoint \""
+           << breakpoint->id() << "\"." << std::endl;
+      return S_FALSE;
+    }
+  }
+
+  queue_.push_back(std::move(breakpoint));
+  stats_.queued += 1;
+  if (queue_.size() > stats_.max_pending) {
+    stats_.max_pending = queue_.size();
+  }
+  pending_cv_.notify_one();
+  return S_OK;
+}
+
+void SnapshotWriter::Flush() {
+  unique_lock<mutex> lock(mutex_);
+  space_cv_.wait(lock, [this] { return queue_.empty() && !writing_; });
+}
+
+void SnapshotWriter::Stop() {
+  {
+    lock_guard<mutex> lock(mutex_);
+    if (stopping_) {
+      return;
+    }
+    stopping_ = true;
+  }
+  pending_cv_.notify_all();
+  space_cv_.notify_all();
+
+  if (writer_thread_.joinable()) {
+    writer_thread_.join();
+  }
+
+  Stats stats = GetStats();
+  if (stats.queued > 0 || stats.dropped > 0) {
+    cerr << "Snapshot writer: " << stats.written << " written, "
+         << stats.failed << " failed, " << stats.dropped << " dropped, "
+         << stats.merged << " log entries merged. "
+         << duration_cast<milliseconds>(stats.write_time).count()
+         << " ms of writes moved off stopped threads, "
+         << duration_cast<milliseconds>(stats.wait_time).count()
+         << " ms waiting for room in the queue." << std::endl;
+  }
+}
+
+SnapshotWriter::Stats SnapshotWriter::GetStats() {
+  lock_guard<mutex> lock(mutex_);
+  return stats_;
+}
+
+void SnapshotWriter::WriteLoop() {
+  unique_lock<mutex> lock(mutex_);
+  while (true) {
+    pending_cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+    // Pending snapshots are still written after Stop is called.
+    if (queue_.empty()) {
+      return;
+    }
+
+    std::shared_ptr<Breakpoint> breakpoint = std::move(queue_.front());
+    queue_.pop_front();
+    if (breakpoint->log_point()) {
+      MergePendingLogMessages(breakpoint.get());
+    }
+    writing_ = true;
+    space_cv_.notify_all();
+
+    lock.unlock();
+    auto start = steady_clock::now();
+    HRESULT hr = write_(*breakpoint);
+    microseconds elapsed =
+        duration_cast<microseconds>(steady_clock::now() - start);
+    if (FAILED(hr)) {
+      cerr << "Failed to write breakpoint \"" << breakpoint->id()
+           << "\": " << std::hex << hr << std::dec << std::endl;
+    }
+    breakpoint.reset();
+    lock.lock();
+
+    writing_ = false;
+    stats_.write_time += elapsed;
+    if (FAILED(hr)) {
+      stats_.failed += 1;
+    } else {
+      stats_.written += 1;
+    }
+    space_cv_.notify_all();
+  }
+}
+
+void SnapshotWriter::MergePendingLogMessages(Breakpoint *log_entry) {
+  if (log_entry->has_status()) {
+    return;
+  }
+
+  auto it = queue_.begin();
+  while (it != queue_.end() &&
+         log_entry->log_messages_size() < kMaxLogMessagesPerWrite) {
+    const Breakpoint &pending = **it;
+    if (pending.id() != log_entry->id()) {
+      ++it;
+      continue;
+    }
+
+    // Entries queued after a final status of the logpoint, for example
+    // an error or its expiry, must not be moved ahead of it.
+    if (!pending.log_point() || pending.has_status()) {
+      break;
+    }
+
+    log_entry->mutable_log_messages()->MergeFrom(pending.log_messages());
+    it = queue_.erase(it);
+    stats_.merged += 1;
+  }
+}
+
+}  // namespace google_cloud_debugger
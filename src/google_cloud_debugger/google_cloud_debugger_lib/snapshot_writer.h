@@ -0,0 +1,165 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SNAPSHOT_WRITER_H_
+#define SNAPSHOT_WRITER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "breakpoint.pb.h"
+#include "cor.h"
+
+namespace google_cloud_debugger {
+
+// Writes finished snapshots to the agent on a dedicated thread so the
+// thread that captured them (and the debuggee thread that is stopped
+// until the capture is done) does not wait for the pipe.
+//
+// The queue of pending snapshots is bounded. When it is full, Enqueue
+// waits for up to max_wait for the writer to catch up before it drops
+// the snapshot, so a slow agent only holds the debuggee up for a
+// bounded amount of time.
+//
+// Log messages of a logpoint that are waiting in the queue are merged
+// into a single write, so a busy logpoint is reported in batches
+// instead of one write per hit.
+class SnapshotWriter {
+ public:
+  // Function used to write a snapshot to the agent.
+  typedef std::function<HRESULT(
+      const google::cloud::diagnostics::debug::Breakpoint &)>
+      WriteFunction;
+
+  // Counters of the snapshot writer.
+  struct Stats {
+    // Number of snapshots that were queued.
+    std::uint64_t queued = 0;
+
+    // Number of snapshots that were written.
+    std::uint64_t written = 0;
+
+    // Number of snapshots that could not be written.
+    std::uint64_t failed = 0;
+
+    // Number of snapshots that were dropped because the queue was full.
+    std::uint64_t dropped = 0;
+
+    // Number of queued log entries that were merged into the write of
+    // an earlier entry of the same logpoint.
+    std::uint64_t merged = 0;
+
+    // Largest number of snapshots that were pending at the same time.
+    std::size_t max_pending = 0;
+
+    // Time spent writing snapshots on the writer thread. The debuggee
+    // would have been stopped for this long if the snapshots were
+    // written by the thread that captured them.
+    std::chrono::microseconds write_time = std::chrono::microseconds(0);
+
+    // Time Enqueue spent waiting for room in the queue.
+    std::chrono::microseconds wait_time = std::chrono::microseconds(0);
+  };
+
+  // Default maximum number of pending snapshots.
+  static const std::size_t kDefaultMaxPending = 64;
+
+  // Default time Enqueue waits for room in a full queue.
+  static const std::chrono::milliseconds kDefaultMaxWait;
+
+  // Maximum number of log messages merged into a single write.
+  static const int kMaxLogMessagesPerWrite = 100;
+
+  // Creates a writer that writes snapshots with write. At most
+  // max_pending snapshots can wait to be written.
+  SnapshotWriter(WriteFunction write,
+                 std::size_t max_pending = kDefaultMaxPending,
+                 std::chrono::milliseconds max_wait = kDefaultMaxWait);
+
+  // Writes the pending snapshots and stops the writer thread.
+  ~SnapshotWriter();
+
+  // Queues breakpoint to be written. The writer thread is started on
+  // the first call. Returns S_FALSE if the snapshot is dropped because
+  // the queue is still full after max_wait.
+  HRESULT Enqueue(
+      std::shared_ptr<google::cloud::diagnostics::debug::Breakpoint>
+          breakpoint);
+
+  // Blocks until every snapshot queued so far is written or dropped.
+  void Flush();
+
+  // Writes the pending snapshots, stops the writer thread and reports
+  // the counters if anything was queued. Snapshots queued after this
+  // are rejected.
+  void Stop();
+
+  // Returns the counters of the writer.
+  Stats GetStats();
+
+ private:
+  // Writes snapshots from queue_ until Stop is called.
+  void WriteLoop();
+
+  // Moves the log messages of the entries in queue_ that belong to the
+  // same logpoint as log_entry into log_entry. Stops at the first entry
+  // of the logpoint that has a status, so no message is moved ahead of
+  // it. mutex_ must be held.
+  void MergePendingLogMessages(
+      google::cloud::diagnostics::debug::Breakpoint *log_entry);
+
+  // Writes the snapshots.
+  WriteFunction write_;
+
+  // Maximum number of snapshots in queue_.
+  std::size_t max_pending_;
+
+  // Maximum time Enqueue waits for room in queue_.
+  std::chrono::milliseconds max_wait_;
+
+  // Snapshots waiting to be written.
+  std::deque<std::shared_ptr<google::cloud::diagnostics::debug::Breakpoint>>
+      queue_;
+
+  // True while the writer thread is writing a snapshot it took from queue_.
+  bool writing_ = false;
+
+  // True once Stop is called.
+  bool stopping_ = false;
+
+  // Counters of the writer.
+  Stats stats_;
+
+  // The thread that writes snapshots. Started by the first Enqueue.
+  std::thread writer_thread_;
+
+  // Protects every member above.
+  std::mutex mutex_;
+
+  // Signaled when a snapshot is queued or Stop is called.
+  std::condition_variable pending_cv_;
+
+  // Signaled when a snapshot is taken from queue_ or written.
+  std::condition_variable space_cv_;
+};
+
+}  // namespace google_cloud_debugger
+
+#endif  // SNAPSHOT_WRITER_H_
@@ -0,0 +1,207 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "source_index.h"
+
+#include <assert.h>
+#include <algorithm>
+#include <cctype>
+
+#include "document_index.h"
+
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace google_cloud_debugger_portable_pdb {
+
+string SourceIndex::NormalizePath(const string &path) {
+  string result = path;
+  std::replace(result.begin(), result.end(), '\\', '/');
+  std::transform(
+      result.begin(), result.end(), result.begin(),
+      [](unsigned char c) -> unsigned char { return std::tolower(c); });
+  return result;
+}
+
+void SourceIndex::AddDocuments(
+    const vector<unique_ptr<IDocumentIndex>> &document_indices) {
+  for (auto &&document_index : document_indices) {
+    if (!document_index) {
+      continue;
+    }
+
+    string path = NormalizePath(document_index->GetFilePath());
+
+    DocumentLines document;
+    document.document_index = document_index.get();
+    document.path_length = path.size();
+    document.order = documents_.size();
+
+    const vector<MethodInfo> &methods = document_index->GetMethods();
+    document.methods.reserve(methods.size());
+    for (const MethodInfo &method : methods) {
+      MethodLines method_lines;
+      method_lines.method = &method;
+      method_lines.max_last_line = method.last_line;
+      for (const SequencePoint &sequence_point : method.sequence_points) {
+        if (!sequence_point.is_hidden) {
+          method_lines.sequence_points.push_back(&sequence_point);
+        }
+      }
+      std::stable_sort(method_lines.sequence_points.begin(),
+                       method_lines.sequence_points.end(),
+                       [](const SequencePoint *first,
+                          const SequencePoint *second) {
+                         if (first->start_line != second->start_line) {
+                           return first->start_line < second->start_line;
+                         }
+                         return first->il_offset < second->il_offset;
+                       });
+      document.methods.push_back(std::move(method_lines));
+    }
+
+    std::stable_sort(document.methods.begin(), document.methods.end(),
+                     [](const MethodLines &first, const MethodLines &second) {
+                       return first.method->first_line <
+                              second.method->first_line;
+                     });
+    for (size_t i = 1; i < document.methods.size(); ++i) {
+      document.methods[i].max_last_line =
+          std::max(document.methods[i].max_last_line,
+                   document.methods[i - 1].max_last_line);
+    }
+
+    // Inserts the reversed path into the trie.
+    std::uint32_t node = 0;
+    for (auto it = path.rbegin(); it != path.rend(); ++it) {
+      auto child = trie_[node].children.find(*it);
+      if (child != trie_[node].children.end()) {
+        node = child->second;
+        continue;
+      }
+
+      std::uint32_t new_node = trie_.size();
+      trie_[node].children[*it] = new_node;
+      trie_.push_back(TrieNode());
+      node = new_node;
+    }
+    trie_[node].documents.push_back(documents_.size());
+
+    documents_.push_back(std::move(document));
+  }
+}
+
+bool SourceIndex::FindLocation(const string &file_name, std::uint32_t line,
+                               Location *location) const {
+  assert(location != nullptr);
+
+  // Walks down to the node of the reversed file name. Every document
+  // in the subtree of that node has a path that ends with file_name.
+  string normalized_file_name = NormalizePath(file_name);
+  std::uint32_t node = 0;
+  for (auto it = normalized_file_name.rbegin();
+       it != normalized_file_name.rend(); ++it) {
+    auto child = trie_[node].children.find(*it);
+    if (child == trie_[node].children.end()) {
+      return false;
+    }
+    node = child->second;
+  }
+
+  vector<const DocumentLines *> candidates;
+  vector<std::uint32_t> pending_nodes(1, node);
+  while (!pending_nodes.empty()) {
+    const TrieNode &trie_node = trie_[pending_nodes.back()];
+    pending_nodes.pop_back();
+    for (std::uint32_t document : trie_node.documents) {
+      candidates.push_back(&documents_[document]);
+    }
+    for (auto &&child : trie_node.children) {
+      pending_nodes.push_back(child.second);
+    }
+  }
+
+  // The document with the longest path is the best match. Documents
+  // with paths of the same length are tried in the order they were added.
+  std::sort(candidates.begin(), candidates.end(),
+            [](const DocumentLines *first, const DocumentLines *second) {
+              if (first->path_length != second->path_length) {
+                return first->path_length > second->path_length;
+              }
+              return first->order < second->order;
+            });
+
+  for (const DocumentLines *candidate : candidates) {
+    if (FindLocationInDocument(*candidate, line, location)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool SourceIndex::FindLocationInDocument(const DocumentLines &document,
+                                         std::uint32_t line,
+                                         Location *location) {
+  // Methods that start after line cannot contain it.
+  auto end = std::upper_bound(
+      document.methods.begin(), document.methods.end(), line,
+      [](std::uint32_t line, const MethodLines &method) {
+        return line < method.method->first_line;
+      });
+
+  // The innermost method that contains line is the one with the highest
+  // first line. An example is a delegate that is defined inside a method:
+  // its local variables are the ones the breakpoint should see. If several
+  // methods start on the same line, the first one in the document wins.
+  const MethodLines *best_method = nullptr;
+  const SequencePoint *best_sequence_point = nullptr;
+  for (auto it = end; it != document.methods.begin();) {
+    --it;
+    if (it->max_last_line < line) {
+      break;
+    }
+
+    const MethodInfo *method = it->method;
+    if (best_method && method->first_line < best_method->method->first_line) {
+      break;
+    }
+
+    if (method->last_line < line) {
+      continue;
+    }
+
+    auto sequence_point = std::lower_bound(
+        it->sequence_points.begin(), it->sequence_points.end(), line,
+        [](const SequencePoint *sequence_point, std::uint32_t line) {
+          return sequence_point->start_line < line;
+        });
+    if (sequence_point != it->sequence_points.end()) {
+      best_method = &*it;
+      best_sequence_point = *sequence_point;
+    }
+  }
+
+  if (!best_method) {
+    return false;
+  }
+
+  location->document_index = document.document_index;
+  location->method = best_method->method;
+  location->sequence_point = best_sequence_point;
+  return true;
+}
+
+}  // namespace google_cloud_debugger_portable_pdb
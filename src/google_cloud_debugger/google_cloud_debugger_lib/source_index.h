@@ -0,0 +1,132 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SOURCE_INDEX_H_
+#define SOURCE_INDEX_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace google_cloud_debugger_portable_pdb {
+
+class IDocumentIndex;
+struct MethodInfo;
+struct SequencePoint;
+
+// Index from source locations (file name and line) to the method and
+// sequence point a breakpoint at that location should be set on.
+//
+// Document paths are normalized (lower case, '/' separators) and stored
+// reversed in a trie, so the documents whose path ends with a breakpoint's
+// file name are found by walking the trie along the reversed file name.
+// The methods of every document are sorted by their first line and their
+// non-hidden sequence points by line, so the method and sequence point of
+// a line are found with binary searches instead of scanning the document.
+//
+// The index keeps pointers into the document indices it is built from,
+// so those have to outlive it and must not change after AddDocuments.
+class SourceIndex {
+ public:
+  // Where a breakpoint resolves to.
+  struct Location {
+    // Document that contains the breakpoint.
+    const IDocumentIndex *document_index = nullptr;
+
+    // Innermost method that contains the breakpoint.
+    const MethodInfo *method = nullptr;
+
+    // First non-hidden sequence point of method that starts
+    // at or after the line of the breakpoint.
+    const SequencePoint *sequence_point = nullptr;
+  };
+
+  // Adds document_indices to the index.
+  void AddDocuments(
+      const std::vector<std::unique_ptr<IDocumentIndex>> &document_indices);
+
+  // Finds where a breakpoint at line line of the file whose path ends
+  // with file_name should be set. If several documents match, the one
+  // with the longest path that has code at that line wins, which is
+  // the best match the Cloud Debugger can do with a relative path.
+  // Returns false if there is no such location.
+  bool FindLocation(const std::string &file_name, std::uint32_t line,
+                    Location *location) const;
+
+  // Returns the number of documents in the index.
+  std::size_t GetDocumentCount() const { return documents_.size(); }
+
+  // Lower cases path and replaces '\' with '/'. The PDB may use either
+  // Unix or Windows-style paths, but the Cloud Debugger only uses Unix.
+  static std::string NormalizePath(const std::string &path);
+
+ private:
+  // A method of a document with its sequence points sorted by line.
+  struct MethodLines {
+    // The method.
+    const MethodInfo *method;
+
+    // Highest last line of this method and all methods before it
+    // in DocumentLines::methods. Used to stop searching for methods
+    // that contain a line as soon as none of the remaining ones can.
+    std::uint32_t max_last_line;
+
+    // Non-hidden sequence points of the method sorted by start line
+    // and then by IL offset.
+    std::vector<const SequencePoint *> sequence_points;
+  };
+
+  // A document with its methods sorted by first line.
+  struct DocumentLines {
+    // The document.
+    const IDocumentIndex *document_index;
+
+    // Length of the normalized path of the document.
+    std::size_t path_length;
+
+    // Position of the document in the order it was added in.
+    std::size_t order;
+
+    // Methods of the document sorted by first line. Methods with the
+    // same first line keep the order they have in the document.
+    std::vector<MethodLines> methods;
+  };
+
+  // A node of the trie of reversed document paths.
+  struct TrieNode {
+    // Children of this node by the next character of the reversed path.
+    std::map<char, std::uint32_t> children;
+
+    // Documents in documents_ whose reversed path ends at this node.
+    std::vector<std::uint32_t> documents;
+  };
+
+  // Finds the innermost method of document that contains line and has
+  // a non-hidden sequence point at or after line. Returns false if
+  // there is no such method.
+  static bool FindLocationInDocument(const DocumentLines &document,
+                                     std::uint32_t line, Location *location);
+
+  // Documents in the index.
+  std::vector<DocumentLines> documents_;
+
+  // Trie of reversed document paths. The root is at index 0.
+  std::vector<TrieNode> trie_ = std::vector<TrieNode>(1);
+};
+
+}  // namespace google_cloud_debugger_portable_pdb
+
+#endif  // SOURCE_INDEX_H_
@@ -23,11 +23,13 @@
 #include "i_cor_debug_helper.h"
 #include "i_dbg_object_factory.h"
 #include "i_eval_coordinator.h"
+#include "snapshot_size_budget.h"
 
 using google::cloud::diagnostics::debug::Breakpoint;
 using google::cloud::diagnostics::debug::SourceLocation;
 using google::cloud::diagnostics::debug::StackFrame;
 using google::cloud::diagnostics::debug::Variable;
+using google_cloud_debugger_portable_pdb::IDocumentIndex;
 using google_cloud_debugger_portable_pdb::LocalConstantInfo;
 using google_cloud_debugger_portable_pdb::LocalVariableInfo;
 using google_cloud_debugger_portable_pdb::SequencePoint;
@@ -84,6 +86,12 @@ HRESULT StackFrameCollection::ProcessBreakpoint(
     }
   }
 
+  // A logpoint only needs the expressions evaluated against the top
+  // frame, so the rest of the stack is not walked.
+  if (breakpoint->IsLogPoint()) {
+    return S_OK;
+  }
+
   return WalkStackAndProcessStackFrame(eval_coordinator, pdb_files);
 }
 
@@ -101,23 +109,27 @@ HRESULT StackFrameCollection::PopulateStackFrames(
 
   HRESULT hr = S_OK;
 
+  // Size of the breakpoint so far. Every frame is measured once after
+  // it is populated instead of measuring the whole breakpoint again.
+  SnapshotSizeBudget budget(DbgBreakpoint::kMaximumBreakpointSize,
+                            breakpoint->ByteSize());
+
   // Gives the first frame half available kb in the breakpoint.
-  int frame_max_size =
-      (DbgBreakpoint::kMaximumBreakpointSize - breakpoint->ByteSize()) / 2;
+  int frame_max_size = budget.GetRemainingSize() / 2;
   int processed_il_frames_so_far = 0;
 
   for (auto &&dbg_stack_frame : stack_frames_) {
     // If this is the last processed IL frame, just gives it the rest
     // of the size available.
     if (processed_il_frames_so_far == number_of_processed_il_frames_ - 1) {
-      frame_max_size =
-          DbgBreakpoint::kMaximumBreakpointSize - breakpoint->ByteSize();
+      frame_max_size = budget.GetRemainingSize();
     }
 
     StackFrame *frame = breakpoint->add_stack_frames();
     // If dbg_stack_frame is an empty stack frame, just says it's undebuggable.
     if (dbg_stack_frame->IsEmpty()) {
       frame->set_method_name("Undebuggable code.");
+      budget.Add(SnapshotSizeBudget::GetFieldSize(frame->ByteSize()));
       continue;
     }
 
@@ -127,6 +139,7 @@ HRESULT StackFrameCollection::PopulateStackFrames(
     SourceLocation *frame_location = frame->mutable_location();
     if (!frame_location) {
       std::cerr << "Mutable location returns null.";
+      budget.Add(SnapshotSizeBudget::GetFieldSize(frame->ByteSize()));
       continue;
     }
 
@@ -143,13 +156,13 @@ HRESULT StackFrameCollection::PopulateStackFrames(
       ++processed_il_frames_so_far;
     }
 
-    if (breakpoint->ByteSize() > DbgBreakpoint::kMaximumBreakpointSize) {
+    budget.Add(SnapshotSizeBudget::GetFieldSize(frame->ByteSize()));
+    if (budget.IsExhausted()) {
       break;
     }
 
     // Updates frame_max_size to half of whatever is left.
-    frame_max_size =
-        (DbgBreakpoint::kMaximumBreakpointSize - breakpoint->ByteSize()) / 2;
+    frame_max_size = budget.GetRemainingSize() / 2;
   }
 
   return S_OK;
@@ -219,82 +232,58 @@ HRESULT StackFrameCollection::PopulateLocalVarsAndMethodArgs(
     return S_FALSE;
   }
 
-  // Loops through all methods in all the documents of the pdb file to find
-  // a MethodInfo object that corresponds with the method at this breakpoint.
-  for (auto &&document_index : pdb_file->GetDocumentIndexTable()) {
-    for (auto &&method : document_index->GetMethods()) {
-      PCCOR_SIGNATURE current_method_signature = 0;
-      ULONG current_method_virtual_addr = 0;
-      mdTypeDef type_def = 0;
-      ULONG method_name_length = 0;
-      DWORD flags1 = 0;
-      ULONG signature_blob;
-      DWORD flags2 = 0;
-
-      hr = metadata_import->GetMethodProps(
-          method.method_def, &type_def, nullptr, 0, &method_name_length,
-          &flags1, &current_method_signature, &signature_blob,
-          &current_method_virtual_addr, &flags2);
-      if (FAILED(hr)) {
-        cerr << "Failed to extract method info from method "
-             << method.method_def;
-        return hr;
-      }
-
-      // Checks that the virtual address of this method matches the one of the
-      // stack frame.
-      if (current_method_virtual_addr !=
-          dbg_stack_frame->GetFuncVirtualAddr()) {
-        continue;
-      }
+  // Finds the MethodInfo object that corresponds with the method at this
+  // frame by matching the virtual address of the method.
+  const IDocumentIndex *document_index = nullptr;
+  const google_cloud_debugger_portable_pdb::MethodInfo *method = nullptr;
+  if (!pdb_file->FindMethodByVirtualAddr(dbg_stack_frame->GetFuncVirtualAddr(),
+                                         &document_index, &method)) {
+    return S_OK;
+  }
 
-      // Sets the file path since we know we are in the correct function.
-      dbg_stack_frame->SetFile(document_index->GetFilePath());
+  // Sets the file path since we know we are in the correct function.
+  dbg_stack_frame->SetFile(document_index->GetFilePath());
 
-      long matching_sequence_point_position = -1;
+  long matching_sequence_point_position = -1;
 
-      // We find the first non-hidden sequence point that is just larger than
-      // the ip offset.
-      for (long index = 0; index < method.sequence_points.size(); index++) {
-        if (!method.sequence_points[index].is_hidden &&
-            method.sequence_points[index].il_offset <= ip_offset) {
-          matching_sequence_point_position =
-              max(matching_sequence_point_position, index);
-        }
-      }
+  // We find the first non-hidden sequence point that is just larger than
+  // the ip offset.
+  for (long index = 0; index < method->sequence_points.size(); index++) {
+    if (!method->sequence_points[index].is_hidden &&
+        method->sequence_points[index].il_offset <= ip_offset) {
+      matching_sequence_point_position =
+          max(matching_sequence_point_position, index);
+    }
+  }
 
-      // If we find the matching sequence point, populates the list of local
-      // variables in dbg_stack_frame from the local variable's vector of the
-      // matching sequence point.
-      if (matching_sequence_point_position != -1) {
-        SequencePoint sequence_point =
-            method.sequence_points[matching_sequence_point_position];
-
-        dbg_stack_frame->SetLineNumber(sequence_point.start_line);
-        vector<LocalVariableInfo> local_variables;
-        vector<LocalConstantInfo> local_constants;
-        for (auto &&local_scope : method.local_scope) {
-          if (local_scope.start_offset > sequence_point.il_offset ||
-              local_scope.start_offset + local_scope.length <
-                  sequence_point.il_offset) {
-            continue;
-          }
-
-          local_variables.insert(local_variables.end(),
-                                 local_scope.local_variables.begin(),
-                                 local_scope.local_variables.end());
-          local_constants.insert(local_constants.end(),
-                                 local_scope.local_constants.begin(),
-                                 local_scope.local_constants.end());
-        }
-
-        hr = dbg_stack_frame->Initialize(il_frame, local_variables,
-                                         local_constants, target_function_token,
-                                         metadata_import);
+  // If we find the matching sequence point, populates the list of local
+  // variables in dbg_stack_frame from the local variable's vector of the
+  // matching sequence point.
+  if (matching_sequence_point_position != -1) {
+    SequencePoint sequence_point =
+        method->sequence_points[matching_sequence_point_position];
+
+    dbg_stack_frame->SetLineNumber(sequence_point.start_line);
+    vector<LocalVariableInfo> local_variables;
+    vector<LocalConstantInfo> local_constants;
+    for (auto &&local_scope : method->local_scope) {
+      if (local_scope.start_offset > sequence_point.il_offset ||
+          local_scope.start_offset + local_scope.length <
+              sequence_point.il_offset) {
+        continue;
       }
 
-      return S_OK;
+      local_variables.insert(local_variables.end(),
+                             local_scope.local_variables.begin(),
+                             local_scope.local_variables.end());
+      local_constants.insert(local_constants.end(),
+                             local_scope.local_constants.begin(),
+                             local_scope.local_constants.end());
     }
+
+    hr = dbg_stack_frame->Initialize(il_frame, local_variables,
+                                     local_constants, target_function_token,
+                                     metadata_import);
   }
 
   return S_OK;
@@ -390,8 +379,15 @@ HRESULT StackFrameCollection::WalkStackAndProcessStackFrame(
     return hr;
   }
 
-  // Skips the first stack if it is already processed.
+  // Skips the first stack if it is already processed. Its variables
+  // were only resolved on demand for the condition and the expressions,
+  // so all of them are populated now that the snapshot is captured.
   if (first_stack_) {
+    hr = first_stack_->PopulateVariables();
+    if (FAILED(hr)) {
+      cerr << "Failed to populate the variables of the first stack.";
+    }
+
     stack_frames_.push_back(first_stack_);
     ++frame_parsed_so_far;
     if (first_stack_->IsProcessedIlFrame()) {
@@ -531,8 +527,11 @@ HRESULT StackFrameCollection::ProcessFirstStack(
     return hr;
   }
 
+  // Conditions and expressions usually reference a few variables,
+  // so the variables of the first stack are resolved on demand.
   first_stack_ = std::shared_ptr<DbgStackFrame>(
       new DbgStackFrame(debug_helper_, obj_factory_));
+  first_stack_->SetLazyVariables(debug_thread);
   hr = PopulateDbgStackFrameHelper(parsed_pdb_files, debug_frame,
                                    first_stack_.get(), true);
   if (FAILED(hr)) {
@@ -657,6 +656,10 @@ HRESULT StackFrameCollection::PopulateDbgStackFrameHelper(
       continue;
     }
 
+    // The frames of a module share the type names of the module so
+    // they are only enumerated once.
+    stack_frame->SetTypeNameTable(pdb_file->GetTypeNameTable());
+
     // Tries to populate local variables and method arguments of this frame.
     hr = PopulateLocalVarsAndMethodArgs(target_function_token, stack_frame,
                                         il_frame, metadata_import,
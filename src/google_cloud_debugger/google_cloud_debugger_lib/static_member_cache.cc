@@ -0,0 +1,82 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "static_member_cache.h"
+
+using std::lock_guard;
+using std::mutex;
+using std::shared_ptr;
+using std::string;
+
+namespace google_cloud_debugger {
+
+shared_ptr<IDbgClassMember> StaticMemberCache::ClassMembers::Find(
+    const string &member_name) const {
+  lock_guard<mutex> lock(mutex_);
+  auto member = members_.find(member_name);
+  if (member == members_.end()) {
+    return shared_ptr<IDbgClassMember>();
+  }
+
+  return member->second;
+}
+
+shared_ptr<IDbgClassMember> StaticMemberCache::ClassMembers::Add(
+    const string &member_name, shared_ptr<IDbgClassMember> member) {
+  lock_guard<mutex> lock(mutex_);
+  // If another thread added the member first, its member wins so every
+  // class object shares the same evaluated value.
+  return members_.emplace(member_name, member).first->second;
+}
+
+shared_ptr<StaticMemberCache::ClassMembers> StaticMemberCache::GetClassMembers(
+    const string &module_name, const string &class_name) {
+  string key = module_name + "!" + class_name;
+
+  lock_guard<mutex> lock(mutex_);
+  shared_ptr<ClassMembers> &class_members = classes_[key];
+  if (!class_members || class_members->generation_ != generation_) {
+    class_members = shared_ptr<ClassMembers>(new (std::nothrow) ClassMembers());
+    if (class_members) {
+      class_members->generation_ = generation_;
+    }
+  }
+
+  return class_members;
+}
+
+void StaticMemberCache::AdvanceGeneration() {
+  lock_guard<mutex> lock(mutex_);
+  ++generation_;
+  // Every cached member belongs to an older generation now.
+  classes_.clear();
+}
+
+std::uint64_t StaticMemberCache::GetGeneration() const {
+  lock_guard<mutex> lock(mutex_);
+  return generation_;
+}
+
+void StaticMemberCache::Clear() {
+  lock_guard<mutex> lock(mutex_);
+  classes_.clear();
+}
+
+std::size_t StaticMemberCache::Size() const {
+  lock_guard<mutex> lock(mutex_);
+  return classes_.size();
+}
+
+}  // namespace google_cloud_debugger
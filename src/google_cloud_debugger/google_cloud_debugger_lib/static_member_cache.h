@@ -0,0 +1,104 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef STATIC_MEMBER_CACHE_H_
+#define STATIC_MEMBER_CACHE_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace google_cloud_debugger {
+
+class IDbgClassMember;
+
+// Cache of the evaluated static fields and properties of classes.
+//
+// Evaluating a static property runs its getter in the debuggee, so the
+// members are cached by class and shared by every object of the class
+// printed during a stop. The cached members hold the ICorDebugValues
+// they read, which ICorDebug neuters when the debuggee continues, so the
+// generation of the cache advances every time the debuggee resumes and
+// the members of older generations expire. The metadata needed to find
+// the members is kept across stops by TypeLayoutCache.
+// This class is thread-safe.
+class StaticMemberCache {
+ public:
+  // The cached static members of a class.
+  // This class is thread-safe.
+  class ClassMembers {
+   public:
+    // Returns the member member_name of the class or null
+    // if it is not in the cache.
+    std::shared_ptr<IDbgClassMember> Find(
+        const std::string &member_name) const;
+
+    // Adds member to the cache under member_name unless there is already
+    // a member with that name. Returns the member that is in the cache.
+    std::shared_ptr<IDbgClassMember> Add(
+        const std::string &member_name,
+        std::shared_ptr<IDbgClassMember> member);
+
+   private:
+    friend class StaticMemberCache;
+
+    // Generation of the cache when these members were created.
+    std::uint64_t generation_ = 0;
+
+    // Map of member name to member.
+    std::unordered_map<std::string, std::shared_ptr<IDbgClassMember>>
+        members_;
+
+    // Protects members_.
+    mutable std::mutex mutex_;
+  };
+
+  // Returns the cached static members of class class_name in module
+  // module_name. If the members expired or the class is not in the
+  // cache, returns an empty set of members for the current generation.
+  // Callers should keep the result for the duration of a snapshot
+  // rather than looking the class up for every member.
+  std::shared_ptr<ClassMembers> GetClassMembers(
+      const std::string &module_name, const std::string &class_name);
+
+  // Advances the generation of the cache. This should be called whenever
+  // the debuggee resumes. Drops the classes that expired.
+  void AdvanceGeneration();
+
+  // Returns the current generation of the cache.
+  std::uint64_t GetGeneration() const;
+
+  // Removes all classes from the cache.
+  void Clear();
+
+  // Returns the number of classes in the cache.
+  std::size_t Size() const;
+
+ private:
+  // Map whose key is the module name and class name separated by "!".
+  std::unordered_map<std::string, std::shared_ptr<ClassMembers>> classes_;
+
+  // Current generation of the cache.
+  std::uint64_t generation_ = 0;
+
+  // Protects all the fields above.
+  mutable std::mutex mutex_;
+};
+
+}  // namespace google_cloud_debugger
+
+#endif  // STATIC_MEMBER_CACHE_H_
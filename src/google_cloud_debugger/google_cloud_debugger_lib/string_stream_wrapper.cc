@@ -14,6 +14,7 @@
 
 #include "string_stream_wrapper.h"
 
+#include <cstdint>
 #include <string>
 
 #include "breakpoint.pb.h"
@@ -25,13 +26,46 @@ using std::vector;
 
 namespace google_cloud_debugger {
 
+ErrorStreamBuffer::int_type ErrorStreamBuffer::overflow(int_type ch) {
+  if (traits_type::eq_int_type(ch, traits_type::eof())) {
+    return traits_type::not_eof(ch);
+  }
+
+  std::string *text = GetText();
+  if (!text) {
+    return traits_type::eof();
+  }
+
+  text->push_back(traits_type::to_char_type(ch));
+  return ch;
+}
+
+std::streamsize ErrorStreamBuffer::xsputn(const char *chars,
+                                          std::streamsize count) {
+  std::string *text = GetText();
+  if (!text) {
+    return 0;
+  }
+
+  text->append(chars, count);
+  return count;
+}
+
+std::string *ErrorStreamBuffer::GetText() {
+  if (!text_) {
+    text_.reset(new (std::nothrow) std::string());
+  }
+  return text_.get();
+}
+
 void SetErrorStatusMessage(Variable *variable, const std::string &err_string) {
   assert(variable != nullptr);
 
-  std::unique_ptr<Status> status(new (std::nothrow) Status());
+  // mutable_status() allocates the status on the arena of the variable,
+  // if there is one.
+  Status *status = variable->mutable_status();
   status->set_message(err_string);
   status->set_iserror(true);
-  variable->set_allocated_status(status.release());
 }
 
 void SetErrorStatusMessage(Variable *variable,
@@ -47,10 +81,9 @@ void SetErrorStatusMessage(
     const std::string &err_string) {
   assert(breakpoint != nullptr);
 
-  std::unique_ptr<Status> status(new (std::nothrow) Status());
+  Status *status = breakpoint->mutable_status();
   status->set_message(err_string);
   status->set_iserror(true);
-  breakpoint->set_allocated_status(status.release());
 }
 
 vector<WCHAR> ConvertStringToWCharPtr(const std::string &target_string) {
@@ -136,4 +169,42 @@ std::string ConvertWCharPtrToString(const vector<WCHAR> &wchar_vector) {
   return ConvertWCharPtrToString(wchar_vector.data());
 }
 
+void AppendWCharToUtf8(const WCHAR *wchar_string, std::size_t length,
+                       std::string *result) {
+  assert(result != nullptr);
+
+  for (std::size_t i = 0; i < length; ++i) {
+    uint32_t code_point = static_cast<uint16_t>(wchar_string[i]);
+    if (code_point < 0x80) {
+      result->push_back(static_cast<char>(code_point));
+      continue;
+    }
+
+    if (code_point >= 0xD800 && code_point <= 0xDBFF && i + 1 < length) {
+      uint32_t low_surrogate = static_cast<uint16_t>(wchar_string[i + 1]);
+      if (low_surrogate >= 0xDC00 && low_surrogate <= 0xDFFF) {
+        code_point =
+            0x10000 + ((code_point - 0xD800) << 10) + (low_surrogate - 0xDC00);
+        ++i;
+      }
+    }
+
+    if (code_point >= 0xD800 && code_point <= 0xDFFF) {
+      code_point = 0xFFFD;
+    }
+
+    if (code_point < 0x800) {
+      result->push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+    } else if (code_point < 0x10000) {
+      result->push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+      result->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    } else {
+      result->push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+      result->push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+      result->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    }
+    result->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  }
+}
+
 }  // namespace google_cloud_debugger
@@ -15,8 +15,10 @@
 #ifndef STRING_STREAM_WRAPPER_H_
 #define STRING_STREAM_WRAPPER_H_
 
+#include <cstddef>
 #include <memory>
-#include <sstream>
+#include <ostream>
+#include <streambuf>
 #include <string>
 #include <vector>
 
@@ -25,41 +27,72 @@
 
 namespace google_cloud_debugger {
 
+// Stream buffer that collects error messages. The text is only allocated
+// when something is written, so objects that never report an error do
+// not allocate anything for it.
+class ErrorStreamBuffer : public std::streambuf {
+ public:
+  // Returns the text written so far.
+  std::string str() const { return text_ ? *text_ : std::string(); }
+
+  // Returns true if nothing has been written.
+  bool empty() const { return !text_ || text_->empty(); }
+
+  // Discards the text written so far.
+  void clear() { text_.reset(); }
+
+ protected:
+  // Appends the character ch to the text.
+  int_type overflow(int_type ch) override;
+
+  // Appends the count characters at chars to the text.
+  std::streamsize xsputn(const char *chars, std::streamsize count) override;
+
+ private:
+  // Returns the text, allocating it on the first write.
+  // Returns null if the allocation fails.
+  std::string *GetText();
+
+  // The text written so far. Null until the first write.
+  std::unique_ptr<std::string> text_;
+};
+
 // This class is meant to be inherited and used for outputting error and
-// output stream to the underlying ostringstream. It has methods to set the
-// underlying streams as well as collecting the output and error stream.
+// output stream to the underlying error stream. It has methods to get the
+// underlying stream as well as collecting the error stream.
+// Every captured value inherits this class, so the stream does not
+// allocate unless an error is written to it.
 // This class is NOT thread-safe.
 class StringStreamWrapper {
  public:
-  // Sets error_stream_ to error_stream and returns the old error stream.
-  std::ostringstream *SetErrorStream(std::ostringstream *error_stream) {
-    std::ostringstream *old_stream = error_stream_.release();
-    error_stream_.reset(error_stream);
-    return old_stream;
-  }
+  StringStreamWrapper() : error_stream_(&error_buffer_) {}
 
   // Writes the string error to the error_stream_.
   void WriteError(const std::string &error) {
-    *error_stream_ << error << std::endl;
+    error_stream_ << error << std::endl;
   }
 
   // Gets the underlying error stream.
-  std::ostringstream *GetErrorStream() { return error_stream_.get(); }
+  std::ostream *GetErrorStream() { return &error_stream_; }
 
   // Gets string collected in the error stream.
-  std::string GetErrorString() { return error_stream_->str(); }
+  std::string GetErrorString() const { return error_buffer_.str(); }
+
+  // Returns true if an error was written to the error stream.
+  bool HasError() const { return !error_buffer_.empty(); }
 
   // Resets the error stream.
   void ResetErrorStream() {
-    error_stream_->str("");
-    error_stream_->clear();
+    error_buffer_.clear();
+    error_stream_.clear();
   }
 
  private:
-  // The underlying error stream.
-  std::unique_ptr<std::ostringstream> error_stream_ =
-      std::unique_ptr<std::ostringstream>(new (std::nothrow)
-                                              std::ostringstream());
+  // Holds the text of the error stream.
+  ErrorStreamBuffer error_buffer_;
+
+  // The underlying error stream. Writes to error_buffer_.
+  std::ostream error_stream_;
 };
 
 // Sets the Status field of variable using error string err_string.
@@ -90,6 +123,11 @@ std::string ConvertWCharPtrToString(const WCHAR *wchar_string);
 // instead of WCHAR array.
 std::string ConvertWCharPtrToString(const std::vector<WCHAR> &wchar_vector);
 
+// Appends the UTF-8 encoding of the first length UTF-16 code units of
+// wchar_string to result. Unpaired surrogates are encoded as U+FFFD.
+void AppendWCharToUtf8(const WCHAR *wchar_string, std::size_t length,
+                       std::string *result);
+
 }  // namespace google_cloud_debugger
 
 #endif
@@ -0,0 +1,478 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "symbol_cache.h"
+
+#include <assert.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <random>
+
+#include "custom_binary_reader.h"
+#include "document_index.h"
+#include "i_portable_pdb_file.h"
+
+using std::array;
+using std::cerr;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace google_cloud_debugger_portable_pdb {
+
+// Magic number at the start of every cache file ("GCSC").
+const std::uint32_t kSymbolCacheMagic = 0x43534347;
+
+// Version of the cache file format. Has to be incremented whenever
+// the format or the content of the parsed structures changes.
+const std::uint32_t kSymbolCacheVersion = 1;
+
+// Extension of the cache files.
+const char kSymbolCacheExtension[] = ".symcache";
+
+namespace {
+
+// Returns the 32-bit FNV-1a hash of the size bytes at data.
+std::uint32_t Checksum(const std::uint8_t *data, std::uint32_t size) {
+  std::uint32_t hash = 2166136261u;
+  for (std::uint32_t i = 0; i < size; ++i) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// Appends the bytes of value to buffer.
+template <typename T>
+void Append(string *buffer, T value) {
+  buffer->append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+// Appends size followed by size bytes at data to buffer.
+void AppendBytes(string *buffer, const void *data, std::uint32_t size) {
+  Append<std::uint32_t>(buffer, size);
+  buffer->append(static_cast<const char *>(data), size);
+}
+
+// Appends a length-prefixed string to buffer.
+void AppendString(string *buffer, const string &value) {
+  AppendBytes(buffer, value.data(), value.size());
+}
+
+// Reads a value written by Append from stream.
+template <typename T>
+bool Read(CustomBinaryStream *stream, T *value) {
+  const std::uint8_t *data;
+  if (!stream->ReadBytesView(sizeof(T), &data)) {
+    return false;
+  }
+  memcpy(value, data, sizeof(T));
+  return true;
+}
+
+// Reads a length-prefixed string written by AppendString from stream.
+bool ReadString(CustomBinaryStream *stream, string *value) {
+  std::uint32_t size;
+  const std::uint8_t *data;
+  if (!Read(stream, &size) || !stream->ReadBytesView(size, &data)) {
+    return false;
+  }
+  value->assign(reinterpret_cast<const char *>(data), size);
+  return true;
+}
+
+// Reads length-prefixed bytes written by AppendBytes from stream.
+bool ReadBytes(CustomBinaryStream *stream, vector<std::uint8_t> *value) {
+  std::uint32_t size;
+  const std::uint8_t *data;
+  if (!Read(stream, &size) || !stream->ReadBytesView(size, &data)) {
+    return false;
+  }
+  value->assign(data, data + size);
+  return true;
+}
+
+// Reads a count written before a list of items. The count is checked
+// against the bytes left so a corrupt count cannot cause a huge
+// allocation. Every item takes at least min_item_size bytes.
+bool ReadCount(CustomBinaryStream *stream, std::uint32_t stream_size,
+               std::uint32_t min_item_size, std::uint32_t *count) {
+  if (!Read(stream, count)) {
+    return false;
+  }
+  std::uint64_t bytes_left = stream_size - stream->Current();
+  return static_cast<std::uint64_t>(*count) * min_item_size <= bytes_left;
+}
+
+// Appends the rows of table to buffer. The rows are plain structs of
+// integers so they are copied as is.
+template <typename TableRow>
+void AppendTable(string *buffer, const vector<TableRow> &table) {
+  Append<std::uint32_t>(buffer, table.size());
+  if (!table.empty()) {
+    buffer->append(reinterpret_cast<const char *>(table.data()),
+                   table.size() * sizeof(TableRow));
+  }
+}
+
+// Reads the rows written by AppendTable from stream into table.
+template <typename TableRow>
+bool ReadTable(CustomBinaryStream *stream, std::uint32_t stream_size,
+               vector<TableRow> *table) {
+  std::uint32_t num_rows;
+  const std::uint8_t *data;
+  if (!ReadCount(stream, stream_size, sizeof(TableRow), &num_rows) ||
+      !stream->ReadBytesView(num_rows * sizeof(TableRow), &data)) {
+    return false;
+  }
+  table->resize(num_rows);
+  if (num_rows != 0) {
+    memcpy(table->data(), data, num_rows * sizeof(TableRow));
+  }
+  return true;
+}
+
+// Appends the content of scope to buffer.
+void AppendScope(string *buffer, const Scope &scope) {
+  Append(buffer, scope.index);
+  Append(buffer, scope.local_var_row_start_index);
+  Append(buffer, scope.local_var_row_end_index);
+  Append(buffer, scope.local_const_row_start_index);
+  Append(buffer, scope.local_const_row_end_index);
+  Append(buffer, scope.start_offset);
+  Append(buffer, scope.length);
+
+  Append<std::uint32_t>(buffer, scope.local_variables.size());
+  for (const LocalVariableInfo &variable : scope.local_variables) {
+    Append(buffer, variable.slot);
+    Append<std::uint8_t>(buffer, variable.debugger_hidden);
+    AppendString(buffer, variable.name);
+  }
+
+  Append<std::uint32_t>(buffer, scope.local_constants.size());
+  for (const LocalConstantInfo &constant : scope.local_constants) {
+    AppendString(buffer, constant.name);
+    AppendBytes(buffer, constant.signature_data.data(),
+                constant.signature_data.size());
+  }
+}
+
+// Reads a scope written by AppendScope from stream.
+bool ReadScope(CustomBinaryStream *stream, std::uint32_t stream_size,
+               Scope *scope) {
+  std::uint32_t num_variables;
+  if (!Read(stream, &scope->index) ||
+      !Read(stream, &scope->local_var_row_start_index) ||
+      !Read(stream, &scope->local_var_row_end_index) ||
+      !Read(stream, &scope->local_const_row_start_index) ||
+      !Read(stream, &scope->local_const_row_end_index) ||
+      !Read(stream, &scope->start_offset) || !Read(stream, &scope->length) ||
+      !ReadCount(stream, stream_size, 7, &num_variables)) {
+    return false;
+  }
+
+  scope->local_variables.resize(num_variables);
+  for (LocalVariableInfo &variable : scope->local_variables) {
+    std::uint8_t debugger_hidden;
+    if (!Read(stream, &variable.slot) || !Read(stream, &debugger_hidden) ||
+        !ReadString(stream, &variable.name)) {
+      return false;
+    }
+    variable.debugger_hidden = debugger_hidden != 0;
+  }
+
+  std::uint32_t num_constants;
+  if (!ReadCount(stream, stream_size, 8, &num_constants)) {
+    return false;
+  }
+
+  scope->local_constants.resize(num_constants);
+  for (LocalConstantInfo &constant : scope->local_constants) {
+    if (!ReadString(stream, &constant.name) ||
+        !ReadBytes(stream, &constant.signature_data)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Appends the content of method to buffer.
+void AppendMethod(string *buffer, const MethodInfo &method) {
+  Append(buffer, method.method_def);
+  Append(buffer, method.first_line);
+  Append(buffer, method.last_line);
+
+  Append<std::uint32_t>(buffer, method.sequence_points.size());
+  for (const SequencePoint &sequence_point : method.sequence_points) {
+    Append(buffer, sequence_point.il_offset);
+    Append(buffer, sequence_point.start_line);
+    Append(buffer, sequence_point.start_col);
+    Append(buffer, sequence_point.end_line);
+    Append(buffer, sequence_point.end_col);
+    Append<std::uint8_t>(buffer, sequence_point.is_hidden);
+  }
+
+  Append<std::uint32_t>(buffer, method.local_scope.size());
+  for (const Scope &scope : method.local_scope) {
+    AppendScope(buffer, scope);
+  }
+}
+
+// Reads a method written by AppendMethod from stream.
+bool ReadMethod(CustomBinaryStream *stream, std::uint32_t stream_size,
+                MethodInfo *method) {
+  std::uint32_t num_sequence_points;
+  if (!Read(stream, &method->method_def) ||
+      !Read(stream, &method->first_line) ||
+      !Read(stream, &method->last_line) ||
+      !ReadCount(stream, stream_size, 21, &num_sequence_points)) {
+    return false;
+  }
+
+  method->sequence_points.resize(num_sequence_points);
+  for (SequencePoint &sequence_point : method->sequence_points) {
+    std::uint8_t is_hidden;
+    if (!Read(stream, &sequence_point.il_offset) ||
+        !Read(stream, &sequence_point.start_line) ||
+        !Read(stream, &sequence_point.start_col) ||
+        !Read(stream, &sequence_point.end_line) ||
+        !Read(stream, &sequence_point.end_col) ||
+        !Read(stream, &is_hidden)) {
+      return false;
+    }
+    sequence_point.is_hidden = is_hidden != 0;
+  }
+
+  std::uint32_t num_scopes;
+  if (!ReadCount(stream, stream_size, 36, &num_scopes)) {
+    return false;
+  }
+
+  method->local_scope.resize(num_scopes);
+  for (Scope &scope : method->local_scope) {
+    if (!ReadScope(stream, stream_size, &scope)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
+SymbolCache::SymbolCache(string directory) : directory_(std::move(directory)) {
+  if (!directory_.empty() && directory_.back() != '/' &&
+      directory_.back() != '\\') {
+    directory_ += '/';
+  }
+}
+
+string SymbolCache::GetCacheFilePath(const PdbId &pdb_id) const {
+  static const char kHexDigits[] = "0123456789abcdef";
+  string path = directory_;
+  for (std::uint8_t byte : pdb_id) {
+    path += kHexDigits[byte >> 4];
+    path += kHexDigits[byte & 0xF];
+  }
+  return path + kSymbolCacheExtension;
+}
+
+bool SymbolCache::Load(
+    const PdbId &pdb_id, std::uint32_t pdb_file_size,
+    vector<DocumentRow> *document_table,
+    vector<MethodDebugInformationRow> *method_debug_info_table,
+    vector<LocalScopeRow> *local_scope_table,
+    vector<LocalVariableRow> *local_variable_table,
+    vector<LocalConstantRow> *local_constant_table,
+    vector<unique_ptr<IDocumentIndex>> *document_indices) const {
+  assert(document_table != nullptr);
+  assert(method_debug_info_table != nullptr);
+  assert(local_scope_table != nullptr);
+  assert(local_variable_table != nullptr);
+  assert(local_constant_table != nullptr);
+  assert(document_indices != nullptr);
+
+  // Everything is copied out of the file below, so the file is read into
+  // the buffer of the stream instead of being mapped into memory.
+  unique_ptr<std::ifstream> cache_file(new (std::nothrow) std::ifstream(
+      GetCacheFilePath(pdb_id), std::ios::in | std::ios::binary));
+  if (!cache_file || !*cache_file) {
+    return false;
+  }
+
+  CustomBinaryStream stream;
+  if (!stream.ConsumeStream(cache_file.release())) {
+    return false;
+  }
+
+  std::uint32_t magic;
+  std::uint32_t version;
+  const std::uint8_t *cached_pdb_id;
+  std::uint32_t cached_pdb_file_size;
+  std::uint32_t checksum;
+  if (!Read(&stream, &magic) || magic != kSymbolCacheMagic ||
+      !Read(&stream, &version) || version != kSymbolCacheVersion ||
+      !stream.ReadBytesView(pdb_id.size(), &cached_pdb_id) ||
+      memcmp(cached_pdb_id, pdb_id.data(), pdb_id.size()) != 0 ||
+      !Read(&stream, &cached_pdb_file_size) ||
+      cached_pdb_file_size != pdb_file_size || !Read(&stream, &checksum)) {
+    cerr << "Symbol cache file for this PDB is stale.";
+    return false;
+  }
+
+  std::uint32_t stream_size = stream.GetLength();
+  std::uint32_t payload_start = stream.Current();
+  const std::uint8_t *payload;
+  if (!stream.ReadBytesView(stream_size - payload_start, &payload) ||
+      Checksum(payload, stream_size - payload_start) != checksum ||
+      !stream.SeekFromOrigin(payload_start)) {
+    cerr << "Symbol cache file for this PDB is corrupt.";
+    return false;
+  }
+
+  vector<unique_ptr<IDocumentIndex>> loaded_indices;
+  std::uint32_t num_documents;
+  bool loaded =
+      ReadTable(&stream, stream_size, document_table) &&
+      ReadTable(&stream, stream_size, method_debug_info_table) &&
+      ReadTable(&stream, stream_size, local_scope_table) &&
+      ReadTable(&stream, stream_size, local_variable_table) &&
+      ReadTable(&stream, stream_size, local_constant_table) &&
+      ReadCount(&stream, stream_size, 20, &num_documents);
+
+  for (std::uint32_t i = 0; loaded && i < num_documents; ++i) {
+    string file_path;
+    string source_language;
+    string hash_algorithm;
+    vector<std::uint8_t> hash;
+    std::uint32_t num_methods;
+    if (!ReadString(&stream, &file_path) ||
+        !ReadString(&stream, &source_language) ||
+        !ReadString(&stream, &hash_algorithm) || !ReadBytes(&stream, &hash) ||
+        !ReadCount(&stream, stream_size, 20, &num_methods)) {
+      loaded = false;
+      break;
+    }
+
+    vector<MethodInfo> methods(num_methods);
+    for (MethodInfo &method : methods) {
+      if (!ReadMethod(&stream, stream_size, &method)) {
+        loaded = false;
+        break;
+      }
+    }
+
+    unique_ptr<DocumentIndex> document_index(new (std::nothrow)
+                                                 DocumentIndex());
+    if (!loaded || !document_index) {
+      loaded = false;
+      break;
+    }
+
+    document_index->InitializeFromParsedContent(
+        std::move(file_path), std::move(source_language),
+        std::move(hash_algorithm), std::move(hash), std::move(methods));
+    loaded_indices.push_back(std::move(document_index));
+  }
+
+  if (!loaded || stream.HasNext()) {
+    cerr << "Symbol cache file for this PDB is corrupt.";
+    document_table->clear();
+    method_debug_info_table->clear();
+    local_scope_table->clear();
+    local_variable_table->clear();
+    local_constant_table->clear();
+    return false;
+  }
+
+  *document_indices = std::move(loaded_indices);
+  return true;
+}
+
+bool SymbolCache::Store(const PdbId &pdb_id, std::uint32_t pdb_file_size,
+                        const IPortablePdbFile &pdb) const {
+  string payload;
+  AppendTable(&payload, pdb.GetDocumentTable());
+  AppendTable(&payload, pdb.GetMethodDebugInfoTable());
+  AppendTable(&payload, pdb.GetLocalScopeTable());
+  AppendTable(&payload, pdb.GetLocalVariableTable());
+  AppendTable(&payload, pdb.GetLocalConstantTable());
+
+  const vector<unique_ptr<IDocumentIndex>> &document_indices =
+      pdb.GetDocumentIndexTable();
+  Append<std::uint32_t>(&payload, document_indices.size());
+  for (const auto &document_index : document_indices) {
+    AppendString(&payload, document_index->GetFilePath());
+    AppendString(&payload, document_index->GetSourceLanguage());
+    AppendString(&payload, document_index->GetHashAlgorithm());
+    const vector<std::uint8_t> &hash = document_index->GetHash();
+    AppendBytes(&payload, hash.data(), hash.size());
+
+    const vector<MethodInfo> &methods = document_index->GetMethods();
+    Append<std::uint32_t>(&payload, methods.size());
+    for (const MethodInfo &method : methods) {
+      AppendMethod(&payload, method);
+    }
+  }
+
+  string header;
+  Append(&header, kSymbolCacheMagic);
+  Append(&header, kSymbolCacheVersion);
+  header.append(reinterpret_cast<const char *>(pdb_id.data()), pdb_id.size());
+  Append(&header, pdb_file_size);
+  Append(&header, Checksum(reinterpret_cast<const std::uint8_t *>(
+                               payload.data()),
+                           payload.size()));
+
+  // Several debugger processes may store the same PDB at the same time,
+  // so each writes to its own temporary file.
+  string cache_file_path = GetCacheFilePath(pdb_id);
+  string temp_file_path =
+      cache_file_path + "." + std::to_string(std::random_device()()) + ".tmp";
+  {
+    std::ofstream cache_file(temp_file_path,
+                             std::ios::out | std::ios::binary);
+    if (!cache_file) {
+      cerr << "Failed to create symbol cache file " << temp_file_path;
+      return false;
+    }
+
+    cache_file.write(header.data(), header.size());
+    cache_file.write(payload.data(), payload.size());
+    if (!cache_file) {
+      cerr << "Failed to write symbol cache file " << temp_file_path;
+      cache_file.close();
+      std::remove(temp_file_path.c_str());
+      return false;
+    }
+  }
+
+  // On Windows, rename fails if the destination exists.
+  if (std::rename(temp_file_path.c_str(), cache_file_path.c_str()) != 0) {
+    std::remove(cache_file_path.c_str());
+    if (std::rename(temp_file_path.c_str(), cache_file_path.c_str()) != 0) {
+      cerr << "Failed to rename symbol cache file " << temp_file_path;
+      std::remove(temp_file_path.c_str());
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace google_cloud_debugger_portable_pdb
@@ -0,0 +1,84 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SYMBOL_CACHE_H_
+#define SYMBOL_CACHE_H_
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "metadata_tables.h"
+
+namespace google_cloud_debugger_portable_pdb {
+
+class IDocumentIndex;
+class IPortablePdbFile;
+
+// The 20-byte id of a Portable PDB, read from its #Pdb stream.
+typedef std::array<std::uint8_t, 20> PdbId;
+
+// On-disk cache of the parsed content of Portable PDB files.
+//
+// Deployments usually run the same binaries on many instances and restart
+// often, so the metadata tables and document indices of a PDB are written
+// to a cache file named after the PDB id the first time the PDB is parsed.
+// Later debugger processes read the cache file instead of parsing the PDB
+// again. The file is read into memory with a single read and the tables
+// and document indices are copied out of it into the same structures
+// parsing produces, so loading still allocates them but skips decoding
+// the metadata streams and building the indices.
+//
+// A cache file starts with a header that contains a magic number, the
+// format version, the PDB id, the size of the PDB file and a checksum of
+// the rest of the file. A cache file that does not match the PDB or whose
+// checksum is wrong is ignored and is overwritten on the next Store.
+class SymbolCache {
+ public:
+  // Creates a symbol cache that keeps its files in directory.
+  explicit SymbolCache(std::string directory);
+
+  // Returns the path of the cache file of the PDB with id pdb_id.
+  std::string GetCacheFilePath(const PdbId &pdb_id) const;
+
+  // Loads the tables and document indices of the PDB with id pdb_id
+  // and size pdb_file_size from the cache. Returns false if there is
+  // no cache file or if it is stale or corrupt, in which case the
+  // output vectors are left empty.
+  bool Load(const PdbId &pdb_id, std::uint32_t pdb_file_size,
+            std::vector<DocumentRow> *document_table,
+            std::vector<MethodDebugInformationRow> *method_debug_info_table,
+            std::vector<LocalScopeRow> *local_scope_table,
+            std::vector<LocalVariableRow> *local_variable_table,
+            std::vector<LocalConstantRow> *local_constant_table,
+            std::vector<std::unique_ptr<IDocumentIndex>> *document_indices)
+      const;
+
+  // Writes the tables and document indices of the parsed PDB pdb
+  // with id pdb_id and size pdb_file_size to the cache.
+  // The file is written to a temporary file first and then renamed
+  // so other processes never see a partially written file.
+  bool Store(const PdbId &pdb_id, std::uint32_t pdb_file_size,
+             const IPortablePdbFile &pdb) const;
+
+ private:
+  // Directory that contains the cache files.
+  std::string directory_;
+};
+
+}  // namespace google_cloud_debugger_portable_pdb
+
+#endif  // SYMBOL_CACHE_H_
@@ -0,0 +1,257 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "type_layout_cache.h"
+
+#include <array>
+#include <unordered_set>
+
+#include "constants.h"
+#include "string_stream_wrapper.h"
+
+using std::array;
+using std::lock_guard;
+using std::mutex;
+using std::shared_ptr;
+using std::string;
+using std::vector;
+
+namespace google_cloud_debugger {
+
+HRESULT TypeLayoutCache::GetTypeLayout(ICorDebugModule *debug_module,
+                                       IMetaDataImport *metadata_import,
+                                       mdTypeDef class_token,
+                                       shared_ptr<const TypeLayout> *layout,
+                                       std::ostream *err_stream) {
+  if (!metadata_import || !layout || !err_stream) {
+    return E_INVALIDARG;
+  }
+
+  auto key = std::make_pair(debug_module, class_token);
+  if (debug_module) {
+    lock_guard<mutex> lock(mutex_);
+    auto cached_layout = layouts_.find(key);
+    if (cached_layout != layouts_.end()) {
+      *layout = cached_layout->second;
+      return S_OK;
+    }
+  }
+
+  // Reads the metadata without holding the lock. If another thread
+  // reads the same type in the meantime, its layout is kept.
+  shared_ptr<TypeLayout> new_layout(new (std::nothrow) TypeLayout());
+  if (!new_layout) {
+    *err_stream << "Ran out of memory while creating the type layout.";
+    return E_OUTOFMEMORY;
+  }
+
+  HRESULT hr =
+      ReadTypeLayout(metadata_import, class_token, new_layout.get(), err_stream);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  new_layout->debug_module = debug_module;
+  new_layout->metadata_import = metadata_import;
+  if (!debug_module) {
+    *layout = std::move(new_layout);
+    return S_OK;
+  }
+
+  lock_guard<mutex> lock(mutex_);
+  *layout = layouts_.emplace(key, std::move(new_layout)).first->second;
+  return S_OK;
+}
+
+void TypeLayoutCache::ClearModule(ICorDebugModule *debug_module) {
+  lock_guard<mutex> lock(mutex_);
+  auto it = layouts_.lower_bound(std::make_pair(debug_module, mdTypeDef(0)));
+  while (it != layouts_.end() && it->first.first == debug_module) {
+    it = layouts_.erase(it);
+  }
+}
+
+void TypeLayoutCache::Clear() {
+  lock_guard<mutex> lock(mutex_);
+  layouts_.clear();
+}
+
+std::size_t TypeLayoutCache::Size() const {
+  lock_guard<mutex> lock(mutex_);
+  return layouts_.size();
+}
+
+HRESULT TypeLayoutCache::ReadTypeLayout(IMetaDataImport *metadata_import,
+                                        mdTypeDef class_token,
+                                        TypeLayout *layout,
+                                        std::ostream *err_stream) {
+  HRESULT hr;
+  HCORENUM cor_enum = nullptr;
+  std::unordered_set<string> backing_field_names;
+
+  while (true) {
+    array<mdFieldDef, 100> field_defs;
+    ULONG field_defs_returned = 0;
+    hr = metadata_import->EnumFields(&cor_enum, class_token, field_defs.data(),
+                                     field_defs.size(), &field_defs_returned);
+    if (FAILED(hr)) {
+      *err_stream << "Failed to enumerate class fields.";
+      break;
+    }
+
+    if (field_defs_returned == 0) {
+      break;
+    }
+
+    for (ULONG i = 0; i < field_defs_returned; ++i) {
+      FieldLayout field;
+      ReadFieldLayout(metadata_import, field_defs[i], &field);
+      if (field.is_backing_field) {
+        // Keeps the names so the properties they back can be skipped.
+        backing_field_names.insert(field.name);
+      }
+      layout->fields.push_back(std::move(field));
+    }
+  }
+
+  if (cor_enum) {
+    metadata_import->CloseEnum(cor_enum);
+    cor_enum = nullptr;
+  }
+
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  while (true) {
+    array<mdProperty, 100> property_defs;
+    ULONG property_defs_returned = 0;
+    hr = metadata_import->EnumProperties(
+        &cor_enum, class_token, property_defs.data(), property_defs.size(),
+        &property_defs_returned);
+    if (FAILED(hr)) {
+      *err_stream << "Failed to enumerate class properties.";
+      break;
+    }
+
+    if (property_defs_returned == 0) {
+      break;
+    }
+
+    for (ULONG i = 0; i < property_defs_returned; ++i) {
+      PropertyLayout property;
+      ReadPropertyLayout(metadata_import, property_defs[i], &property);
+      // If property name is MyProperty and there is a backing field
+      // <MyProperty>k__BackingField, the property is already shown
+      // through the field.
+      if (backing_field_names.find(property.name) !=
+          backing_field_names.end()) {
+        continue;
+      }
+      layout->properties.push_back(std::move(property));
+    }
+  }
+
+  if (cor_enum) {
+    metadata_import->CloseEnum(cor_enum);
+  }
+
+  return SUCCEEDED(hr) ? S_OK : hr;
+}
+
+HRESULT TypeLayoutCache::ReadFieldLayout(IMetaDataImport *metadata_import,
+                                         mdFieldDef field_def,
+                                         FieldLayout *layout) {
+  layout->field_def = field_def;
+  ULONG len_field_name;
+
+  // First call to get length of array.
+  layout->hr = metadata_import->GetFieldProps(
+      field_def, &layout->parent_token, nullptr, 0, &len_field_name,
+      &layout->attributes, &layout->signature, &layout->signature_length,
+      &layout->default_value_type_flags, &layout->default_value,
+      &layout->default_value_length);
+  if (FAILED(layout->hr)) {
+    return layout->hr;
+  }
+
+  vector<WCHAR> wchar_field_name(len_field_name, 0);
+
+  // Second call to get the actual name.
+  layout->hr = metadata_import->GetFieldProps(
+      field_def, &layout->parent_token, wchar_field_name.data(),
+      len_field_name, &len_field_name, &layout->attributes, &layout->signature,
+      &layout->signature_length, &layout->default_value_type_flags,
+      &layout->default_value, &layout->default_value_length);
+  if (FAILED(layout->hr)) {
+    return layout->hr;
+  }
+
+  layout->name = ConvertWCharPtrToString(wchar_field_name);
+
+  // If field name is <MyProperty>k__BackingField, change it to
+  // MyProperty because it is the backing field of a property.
+  string &name = layout->name;
+  if (name.size() > kBackingField.size() + 1 && name[0] == '<') {
+    // Checks that the name ends with k_BackingField.
+    string::size_type position =
+        name.find(kBackingField, name.size() - kBackingField.size());
+    // Extracts out the field name.
+    if (position != string::npos) {
+      layout->is_backing_field = true;
+      name = name.substr(1, position - 1);
+    }
+  }
+
+  return S_OK;
+}
+
+HRESULT TypeLayoutCache::ReadPropertyLayout(IMetaDataImport *metadata_import,
+                                            mdProperty property_def,
+                                            PropertyLayout *layout) {
+  layout->property_def = property_def;
+  ULONG property_name_length;
+  ULONG other_methods_length;
+
+  // First call to get length of array and length of other methods.
+  layout->hr = metadata_import->GetPropertyProps(
+      property_def, &layout->parent_token, nullptr, 0, &property_name_length,
+      &layout->attributes, &layout->signature, &layout->signature_length,
+      &layout->default_value_type_flags, &layout->default_value,
+      &layout->default_value_length, &layout->setter, &layout->getter, nullptr,
+      0, &other_methods_length);
+  if (FAILED(layout->hr)) {
+    return layout->hr;
+  }
+
+  vector<WCHAR> wchar_property_name(property_name_length, 0);
+  layout->other_methods.resize(other_methods_length);
+
+  layout->hr = metadata_import->GetPropertyProps(
+      property_def, &layout->parent_token, wchar_property_name.data(),
+      wchar_property_name.size(), &property_name_length, &layout->attributes,
+      &layout->signature, &layout->signature_length,
+      &layout->default_value_type_flags, &layout->default_value,
+      &layout->default_value_length, &layout->setter, &layout->getter,
+      layout->other_methods.data(), layout->other_methods.size(),
+      &other_methods_length);
+
+  // The name is set even if the second call fails, like
+  // DbgClassProperty always did.
+  layout->name = ConvertWCharPtrToString(wchar_property_name);
+  return layout->hr;
+}
+
+}  //  namespace google_cloud_debugger
@@ -0,0 +1,189 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef TYPE_LAYOUT_CACHE_H_
+#define TYPE_LAYOUT_CACHE_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ccomptr.h"
+#include "cor.h"
+#include "cordebug.h"
+
+namespace google_cloud_debugger {
+
+// Metadata of a field of a .NET type. None of it depends on the object
+// or on the generic instantiation of the type.
+struct FieldLayout {
+  // HRESULT of reading the field properties from the metadata.
+  HRESULT hr = S_OK;
+
+  // Token that represents the field.
+  mdFieldDef field_def = 0;
+
+  // Token to the type that implements the field.
+  mdTypeDef parent_token = 0;
+
+  // Name of the field. If the field is the backing field
+  // <MyProperty>k__BackingField, this is MyProperty.
+  std::string name;
+
+  // True if this is the backing field of a property.
+  bool is_backing_field = false;
+
+  // Attribute flags applied to the field.
+  DWORD attributes = 0;
+
+  // Metadata signature of the field.
+  PCCOR_SIGNATURE signature = nullptr;
+
+  // The number of bytes in signature.
+  ULONG signature_length = 0;
+
+  // The CorElementType of the default value of the field.
+  DWORD default_value_type_flags = 0;
+
+  // The default value of the field.
+  UVCP_CONSTANT default_value = nullptr;
+
+  // The size in wide characters of default_value if it is a string.
+  ULONG default_value_length = 0;
+};
+
+// Metadata of a property of a .NET type. None of it depends on the
+// object or on the generic instantiation of the type.
+struct PropertyLayout {
+  // HRESULT of reading the property properties from the metadata.
+  HRESULT hr = S_OK;
+
+  // Token that represents the property.
+  mdProperty property_def = 0;
+
+  // Token to the type that implements the property.
+  mdTypeDef parent_token = 0;
+
+  // Name of the property.
+  std::string name;
+
+  // Attribute flags applied to the property.
+  DWORD attributes = 0;
+
+  // Metadata signature of the property.
+  PCCOR_SIGNATURE signature = nullptr;
+
+  // The number of bytes in signature.
+  ULONG signature_length = 0;
+
+  // The CorElementType of the default value of the property.
+  DWORD default_value_type_flags = 0;
+
+  // The default value of the property.
+  UVCP_CONSTANT default_value = nullptr;
+
+  // The size in wide characters of default_value if it is a string.
+  ULONG default_value_length = 0;
+
+  // The token of the property getter.
+  mdMethodDef getter = 0;
+
+  // The token of the property setter.
+  mdMethodDef setter = 0;
+
+  // Tokens of the other methods associated with the property.
+  std::vector<mdMethodDef> other_methods;
+};
+
+// The fields and properties of a .NET type.
+struct TypeLayout {
+  // The module the type is in.
+  CComPtr<ICorDebugModule> debug_module;
+
+  // The metadata the layout is read from. This is kept alive because
+  // the signatures and default values point into it.
+  CComPtr<IMetaDataImport> metadata_import;
+
+  // Fields of the type in metadata order.
+  std::vector<FieldLayout> fields;
+
+  // Properties of the type in metadata order, without the properties
+  // that have a backing field in fields.
+  std::vector<PropertyLayout> properties;
+};
+
+// Process-wide cache of the layouts of the types that objects are
+// captured from, keyed by module and type token. The first object of
+// a type reads the fields and properties of the type from the metadata;
+// every later object of that type (for example every element of a
+// List<Order>) reuses them and only has to read its values.
+//
+// A layout is only valid while its module is loaded, so ClearModule
+// has to be called when a module is unloaded.
+// This class is thread-safe.
+class TypeLayoutCache {
+ public:
+  // Gets the layout of the type with token class_token in debug_module,
+  // reading it from metadata_import if it is not in the cache.
+  // If debug_module is null, the layout is read but not cached.
+  HRESULT GetTypeLayout(ICorDebugModule *debug_module,
+                        IMetaDataImport *metadata_import, mdTypeDef class_token,
+                        std::shared_ptr<const TypeLayout> *layout,
+                        std::ostream *err_stream);
+
+  // Removes the layouts of the types in debug_module.
+  void ClearModule(ICorDebugModule *debug_module);
+
+  // Removes all the layouts.
+  void Clear();
+
+  // Returns the number of layouts in the cache.
+  std::size_t Size() const;
+
+  // Reads the layout of the type with token class_token from
+  // metadata_import.
+  static HRESULT ReadTypeLayout(IMetaDataImport *metadata_import,
+                                mdTypeDef class_token, TypeLayout *layout,
+                                std::ostream *err_stream);
+
+  // Reads the layout of the field with token field_def from
+  // metadata_import. The HRESULT is also stored in layout->hr.
+  static HRESULT ReadFieldLayout(IMetaDataImport *metadata_import,
+                                 mdFieldDef field_def, FieldLayout *layout);
+
+  // Reads the layout of the property with token property_def from
+  // metadata_import. The HRESULT is also stored in layout->hr.
+  static HRESULT ReadPropertyLayout(IMetaDataImport *metadata_import,
+                                    mdProperty property_def,
+                                    PropertyLayout *layout);
+
+ private:
+  // Layouts by module and type token.
+  std::map<std::pair<ICorDebugModule *, mdTypeDef>,
+           std::shared_ptr<const TypeLayout>>
+      layouts_;
+
+  // Protects layouts_.
+  mutable std::mutex mutex_;
+};
+
+}  //  namespace google_cloud_debugger
+
+#endif  //  TYPE_LAYOUT_CACHE_H_
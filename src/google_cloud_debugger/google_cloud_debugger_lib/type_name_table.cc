@@ -0,0 +1,176 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "type_name_table.h"
+
+#include <assert.h>
+#include <vector>
+
+#include "i_cor_debug_helper.h"
+
+using std::lock_guard;
+using std::map;
+using std::mutex;
+using std::string;
+using std::vector;
+
+namespace google_cloud_debugger {
+
+HRESULT TypeNameTable::Populate(IMetaDataImport *metadata_import,
+                                ICorDebugHelper *debug_helper,
+                                std::ostream *err_stream) {
+  if (!metadata_import || !debug_helper) {
+    return E_INVALIDARG;
+  }
+
+  // Frames that need the table while it is being populated wait for
+  // it instead of enumerating the module again.
+  lock_guard<mutex> populate_lock(populate_mutex_);
+  if (IsPopulated()) {
+    return S_OK;
+  }
+
+  // The dictionaries are built outside of mutex_ so lookups of
+  // a populated table never wait for another module's enumeration.
+  map<string, mdTypeDef> type_def_dict;
+  HRESULT hr = PopulateTypeDefs(metadata_import, debug_helper, &type_def_dict,
+                                err_stream);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  map<string, mdTypeRef> type_ref_dict;
+  hr = PopulateTypeRefs(metadata_import, debug_helper, &type_ref_dict,
+                        err_stream);
+  if (FAILED(hr)) {
+    return hr;
+  }
+
+  lock_guard<mutex> lock(mutex_);
+  type_def_dict_.swap(type_def_dict);
+  type_ref_dict_.swap(type_ref_dict);
+  populated_ = true;
+  return S_OK;
+}
+
+bool TypeNameTable::IsPopulated() const {
+  lock_guard<mutex> lock(mutex_);
+  return populated_;
+}
+
+bool TypeNameTable::FindTypeDef(const string &type_name,
+                                mdTypeDef *type_def) const {
+  assert(type_def != nullptr);
+
+  lock_guard<mutex> lock(mutex_);
+  auto type_def_info = type_def_dict_.find(type_name);
+  if (type_def_info == type_def_dict_.end()) {
+    return false;
+  }
+
+  *type_def = type_def_info->second;
+  return true;
+}
+
+bool TypeNameTable::FindTypeRef(const string &type_name,
+                                mdTypeRef *type_ref) const {
+  assert(type_ref != nullptr);
+
+  lock_guard<mutex> lock(mutex_);
+  auto type_ref_info = type_ref_dict_.find(type_name);
+  if (type_ref_info == type_ref_dict_.end()) {
+    return false;
+  }
+
+  *type_ref = type_ref_info->second;
+  return true;
+}
+
+HRESULT TypeNameTable::PopulateTypeDefs(
+    IMetaDataImport *metadata_import, ICorDebugHelper *debug_helper,
+    map<string, mdTypeDef> *type_def_dict, std::ostream *err_stream) {
+  HCORENUM cor_enum = nullptr;
+  HRESULT hr = S_OK;
+
+  vector<mdTypeDef> type_defs(100, 0);
+  while (hr == S_OK) {
+    ULONG type_defs_returned = 0;
+    hr = metadata_import->EnumTypeDefs(&cor_enum, type_defs.data(),
+                                       type_defs.size(), &type_defs_returned);
+    if (FAILED(hr)) {
+      *err_stream << "Failed to get enumerate types with hr: " << std::hex
+                  << hr;
+      metadata_import->CloseEnum(cor_enum);
+      return hr;
+    }
+
+    // No type defs.
+    if (type_defs_returned == 0) {
+      break;
+    }
+
+    for (ULONG i = 0; i < type_defs_returned; ++i) {
+      string type_name;
+      mdToken base_token;
+      if (FAILED(debug_helper->GetTypeNameFromMdTypeDef(
+              type_defs[i], metadata_import, &type_name, &base_token,
+              err_stream))) {
+        continue;
+      }
+      (*type_def_dict)[type_name] = type_defs[i];
+    }
+  }
+
+  metadata_import->CloseEnum(cor_enum);
+  return S_OK;
+}
+
+HRESULT TypeNameTable::PopulateTypeRefs(
+    IMetaDataImport *metadata_import, ICorDebugHelper *debug_helper,
+    map<string, mdTypeRef> *type_ref_dict, std::ostream *err_stream) {
+  HCORENUM cor_enum = nullptr;
+  HRESULT hr = S_OK;
+
+  vector<mdTypeRef> type_refs(100, 0);
+  while (hr == S_OK) {
+    ULONG type_refs_returned = 0;
+    hr = metadata_import->EnumTypeRefs(&cor_enum, type_refs.data(),
+                                       type_refs.size(), &type_refs_returned);
+    if (FAILED(hr)) {
+      *err_stream << "Failed to get enumerate types with hr: " << std::hex
+                  << hr;
+      metadata_import->CloseEnum(cor_enum);
+      return hr;
+    }
+
+    // No type refs.
+    if (type_refs_returned == 0) {
+      break;
+    }
+
+    for (ULONG i = 0; i < type_refs_returned; ++i) {
+      string type_name;
+      if (FAILED(debug_helper->GetTypeNameFromMdTypeRef(
+              type_refs[i], metadata_import, &type_name, err_stream))) {
+        continue;
+      }
+      (*type_ref_dict)[type_name] = type_refs[i];
+    }
+  }
+
+  metadata_import->CloseEnum(cor_enum);
+  return S_OK;
+}
+
+}  // namespace google_cloud_debugger
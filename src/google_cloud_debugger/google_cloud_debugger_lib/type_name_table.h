@@ -0,0 +1,97 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPE_NAME_TABLE_H_
+#define TYPE_NAME_TABLE_H_
+
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "cor.h"
+#include "cordebug.h"
+
+namespace google_cloud_debugger {
+
+class ICorDebugHelper;
+
+// Table of the names of the types that are defined in and referenced
+// by a module.
+//
+// Populating the table enumerates every mdTypeDef and mdTypeRef of the
+// module and resolves their names, which is slow for modules with many
+// types. The table is therefore shared by every stack frame in the module
+// and is only populated once, either by the first frame that needs it or
+// by BackgroundPdbParser after the PDB of the module is parsed.
+// This class is thread-safe.
+class TypeNameTable {
+ public:
+  // Populates the table with the types of the module whose
+  // IMetaDataImport is metadata_import. Does nothing if the table
+  // is already populated. If this fails, the next call tries again.
+  HRESULT Populate(IMetaDataImport *metadata_import,
+                   ICorDebugHelper *debug_helper, std::ostream *err_stream);
+
+  // Returns true if the table is populated.
+  bool IsPopulated() const;
+
+  // Sets type_def to the mdTypeDef of the type named type_name that
+  // is defined in the module. Returns false if there is no such type.
+  bool FindTypeDef(const std::string &type_name, mdTypeDef *type_def) const;
+
+  // Sets type_ref to the mdTypeRef of the type named type_name that
+  // the module references from other modules. Returns false if there
+  // is no such type.
+  bool FindTypeRef(const std::string &type_name, mdTypeRef *type_ref) const;
+
+ private:
+  // Enumerates the mdTypeDefs of the module into type_def_dict.
+  static HRESULT PopulateTypeDefs(
+      IMetaDataImport *metadata_import, ICorDebugHelper *debug_helper,
+      std::map<std::string, mdTypeDef> *type_def_dict,
+      std::ostream *err_stream);
+
+  // Enumerates the mdTypeRefs of the module into type_ref_dict.
+  static HRESULT PopulateTypeRefs(
+      IMetaDataImport *metadata_import, ICorDebugHelper *debug_helper,
+      std::map<std::string, mdTypeRef> *type_ref_dict,
+      std::ostream *err_stream);
+
+  // Dictionary whose key is class name and whose value
+  // is the metadata token mdTypeDef of that class.
+  std::map<std::string, mdTypeDef> type_def_dict_;
+
+  // Dictionary whose key is class name and whose value
+  // is the metadata token mdTypeRef of that class.
+  // The difference between mdTypeDef and mdTypeRef
+  // is that mdTypeDef type is found in the current module
+  // whereas mdTypeRef is found in other modules.
+  // Hence, mdTypeRef may needs to be resolved to mdTypeDef
+  // when needed.
+  std::map<std::string, mdTypeRef> type_ref_dict_;
+
+  // True if type_def_dict_ and type_ref_dict_ have been populated.
+  bool populated_ = false;
+
+  // Serializes calls to Populate so the module is only enumerated once.
+  std::mutex populate_mutex_;
+
+  // Protects all the fields above except populate_mutex_.
+  mutable std::mutex mutex_;
+};
+
+}  // namespace google_cloud_debugger
+
+#endif  // TYPE_NAME_TABLE_H_
@@ -15,13 +15,13 @@
 #include "variable_wrapper.h"
 
 #include <iostream>
+#include <new>
 #include <queue>
 #include <vector>
 
 #include "string_stream_wrapper.h"
 
 using google::cloud::diagnostics::debug::Variable;
-using std::function;
 using std::queue;
 using std::shared_ptr;
 using std::string;
@@ -30,80 +30,123 @@ using std::vector;
 
 namespace google_cloud_debugger {
 
-HRESULT VariableWrapper::PerformBFS(queue<VariableWrapper>* bfs_queue,
-                                    const function<bool()> &terminate_condition,
+HRESULT VariableWrapper::PerformBFS(queue<VariableWrapper> *bfs_queue,
+                                    SnapshotSizeBudget *budget,
                                     IEvalCoordinator *eval_coordinator) {
-  if (!bfs_queue) {
+  if (!bfs_queue || !budget) {
     return E_INVALIDARG;
   }
 
-  HRESULT hr;
-  // Until the queue is empty, we:
-  //  1. Pop out an item X.
-  //  2. If X is null, continue with the loop.
-  //  3. If the BFS level of X is kDefaultObjectEvalDepth,
-  // sets an error status on X saying that we cannot evaluate
-  // its children and continue with the loop.
-  //  4. Otherwise, try to get members (children) of X.
-  //  5. If there are members, push them into the queue. We
-  // also set the BFS level of the members to be the BFS
-  // level of the node X + 1. If not, call PopulateValue on X.
   while (!bfs_queue->empty()) {
-    if (terminate_condition()) {
+    if (budget->IsExhausted()) {
       return S_OK;
     }
 
     VariableWrapper current_variable = bfs_queue->front();
-    // Populates the type of the variable into the variable proto.
-    hr = current_variable.PopulateType();
+    bfs_queue->pop();
 
-    if (FAILED(hr)) {
-      SetErrorStatusMessage(current_variable.variable_proto_,
-                            current_variable.variable_value_->GetErrorString());
-      bfs_queue->pop();
+    Variable *variable_proto = current_variable.variable_proto_;
+    if (!variable_proto) {
       continue;
     }
 
-    if (current_variable.bfs_level_ >= kDefaultObjectEvalDepth) {
-      // We have reached a level that is more than the evaluation depth.
-      SetErrorStatusMessage(current_variable.variable_proto_,
-                            "Object evaluation limit reached");
-      bfs_queue->pop();
-      continue;
+    // Only the fields of this variable and the names of its members
+    // are set by ProcessVariable, so measuring the variable before and
+    // after is cheap and gives the growth of the snapshot.
+    std::int64_t old_size = variable_proto->ByteSize();
+    std::shared_ptr<PayloadSize> member_parent_size;
+    current_variable.ProcessVariable(bfs_queue, eval_coordinator,
+                                     &member_parent_size);
+    std::int64_t new_size = variable_proto->ByteSize();
+    if (member_parent_size) {
+      member_parent_size->size = new_size;
     }
 
-    // If variable is null, moves on.
-    if (current_variable.variable_value_->GetIsNull()) {
-      bfs_queue->pop();
-      continue;
-    }
+    budget->UpdateField(old_size, new_size);
+    current_variable.UpdateAncestorSizes(old_size, new_size, budget);
+  }
 
-    // Tries to see whether we can get any members (children) from
-    // this variable.
-    vector<VariableWrapper> variable_members;
-    hr = current_variable.PopulateMembers(&variable_members, eval_coordinator);
+  return S_OK;
+}
 
-    // If hr is S_FALSE then there are no members so we simply
-    // call PopulateValue.
-    if (hr == S_FALSE) {
-      hr = current_variable.PopulateValue();
-    }
-    // Otherwise, process and put the members in the queue.
-    else if (SUCCEEDED(hr)) {
-      for (auto &member_value : variable_members) {
-        member_value.bfs_level_ = current_variable.bfs_level_ + 1;
-        bfs_queue->push(member_value);
-      }
+void VariableWrapper::UpdateAncestorSizes(std::int64_t old_size,
+                                          std::int64_t new_size,
+                                          SnapshotSizeBudget *budget) {
+  // Growth of the payload of the ancestor, which is the growth of the
+  // field of its member (including the length prefix of the member).
+  std::int64_t growth = SnapshotSizeBudget::GetFieldSize(new_size) -
+                        SnapshotSizeBudget::GetFieldSize(old_size);
+  for (PayloadSize *ancestor = parent_size_.get();
+       ancestor != nullptr && growth != 0; ancestor = ancestor->parent.get()) {
+    std::int64_t old_field_size =
+        SnapshotSizeBudget::GetFieldSize(ancestor->size);
+    ancestor->size += growth;
+    std::int64_t new_field_size =
+        SnapshotSizeBudget::GetFieldSize(ancestor->size);
+
+    // The payload growth itself is already in the budget.
+    budget->Add(new_field_size - old_field_size - growth);
+    growth = new_field_size - old_field_size;
+  }
+}
+
+void VariableWrapper::ProcessVariable(
+    queue<VariableWrapper> *bfs_queue, IEvalCoordinator *eval_coordinator,
+    shared_ptr<PayloadSize> *member_parent_size) {
+  // We:
+  //  1. Populate the type of the variable.
+  //  2. If the BFS level of the variable is kDefaultObjectEvalDepth,
+  // sets an error status on it saying that we cannot evaluate
+  // its children and return.
+  //  3. If the variable is null, return.
+  //  4. Otherwise, try to get members (children) of the variable.
+  //  5. If there are members, push them into the queue. We
+  // also set the BFS level of the members to be the BFS
+  // level of the variable + 1. If not, call PopulateValue.
+  HRESULT hr = PopulateType();
+  if (FAILED(hr)) {
+    SetErrorStatusMessage(variable_proto_, variable_value_->GetErrorString());
+    return;
+  }
+
+  if (bfs_level_ >= kDefaultObjectEvalDepth) {
+    // We have reached a level that is more than the evaluation depth.
+    SetErrorStatusMessage(variable_proto_, "Object evaluation limit reached");
+    return;
+  }
+
+  // If variable is null, moves on.
+  if (variable_value_->GetIsNull()) {
+    return;
+  }
+
+  // Tries to see whether we can get any members (children) from
+  // this variable.
+  vector<VariableWrapper> variable_members;
+  hr = PopulateMembers(&variable_members, eval_coordinator);
+
+  // If hr is S_FALSE then there are no members so we simply
+  // call PopulateValue.
+  if (hr == S_FALSE) {
+    hr = PopulateValue();
+  }
+  // Otherwise, process and put the members in the queue.
+  else if (SUCCEEDED(hr)) {
+    if (!variable_members.empty()) {
+      member_parent_size->reset(new (std::nothrow)
+                                    PayloadSize{0, parent_size_});
     }
 
-    if (FAILED(hr)) {
-      SetErrorStatusMessage(current_variable.variable_proto_,
-                            current_variable.variable_value_->GetErrorString());
+    for (auto &member_value : variable_members) {
+      member_value.bfs_level_ = bfs_level_ + 1;
+      member_value.parent_size_ = *member_parent_size;
+      bfs_queue->push(member_value);
     }
-    bfs_queue->pop();
   }
 
-  return S_OK;
+  if (FAILED(hr)) {
+    SetErrorStatusMessage(variable_proto_, variable_value_->GetErrorString());
+  }
 }
 
 // Populates variable proto variable_proto_ with
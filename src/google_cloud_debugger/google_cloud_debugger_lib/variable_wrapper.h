@@ -15,7 +15,6 @@
 #ifndef VARIABLE_WRAPPER_H_
 #define VARIABLE_WRAPPER_H_
 
-#include <functional>
 #include <memory>
 #include <queue>
 #include <sstream>
@@ -26,6 +25,7 @@
 #include "cor.h"
 #include "cordebug.h"
 #include "dbg_object.h"
+#include "snapshot_size_budget.h"
 
 namespace google_cloud_debugger {
 
@@ -49,7 +49,7 @@ public:
   // queue by populating their variable_proto_ with the underlying
   // object variable_value_.
   // Until the queue is empty, this method:
-  //  1. Checks if terminate_condition is true. If so, returns.
+  //  1. Checks if budget is exhausted. If so, returns.
   //  2. Pops out an item X.
   //  3. If X is null, continues with the loop.
   //  4. If the BFS level of X is kDefaultObjectEvalDepth,
@@ -59,8 +59,13 @@ public:
   //  6. If there are members, pushes them into the queue. We
   // also set the BFS level of the members to be the BFS
   // level of the node X + 1. If not, call PopulateValue on X.
+  // The growth of the proto of every item is added to budget,
+  // so checking the size limit does not depend on how many
+  // variables have already been populated. This includes the
+  // growth of the length prefixes of the ancestors of the item,
+  // so the budget matches the serialized size exactly.
   static HRESULT PerformBFS(std::queue<VariableWrapper> *bfs_queue,
-                            const std::function<bool()> &terminate_condition,
+                            SnapshotSizeBudget *budget,
                             IEvalCoordinator *eval_coordinator);
 
   // Populates variable proto variable_proto_ with
@@ -92,6 +97,34 @@ public:
   }
 
 private:
+  // Serialized size of the proto of a variable whose members are
+  // in the BFS queue. When a member grows, the payload of every
+  // ancestor grows with it and so can the length prefix of the
+  // ancestor, which has to be added to the budget as well.
+  struct PayloadSize {
+    // Serialized size of the proto of the variable, without its
+    // tag and length prefix.
+    std::int64_t size;
+
+    // Size of the parent of the variable. Null for the variables
+    // the BFS started from.
+    std::shared_ptr<PayloadSize> parent;
+  };
+
+  // Populates the type and either the value or the members of this
+  // variable (steps 4 to 6 of PerformBFS). Members are pushed into
+  // bfs_queue. If there are members, sets member_parent_size to the
+  // size shared by the members as their parent.
+  void ProcessVariable(std::queue<VariableWrapper> *bfs_queue,
+                       IEvalCoordinator *eval_coordinator,
+                       std::shared_ptr<PayloadSize> *member_parent_size);
+
+  // Adds to budget the growth of the length prefixes of the ancestors
+  // of this variable after the payload of this variable changed from
+  // old_size to new_size bytes, and updates the size of the ancestors.
+  void UpdateAncestorSizes(std::int64_t old_size, std::int64_t new_size,
+                           SnapshotSizeBudget *budget);
+
   // The proto for this variable.
   google::cloud::diagnostics::debug::Variable *variable_proto_;
 
@@ -100,6 +133,10 @@ private:
 
   // The BFS level that this variable is at.
   std::int32_t bfs_level_;
+
+  // Size of the parent of this variable. Null if the BFS started
+  // from this variable.
+  std::shared_ptr<PayloadSize> parent_size_;
 };
 
 }  //  namespace google_cloud_debugger
@@ -0,0 +1,110 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "background_pdb_parser.h"
+#include "i_portable_pdb_mocks.h"
+
+using google_cloud_debugger_portable_pdb::BackgroundPdbParser;
+using std::atomic;
+using std::shared_ptr;
+using std::vector;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+namespace google_cloud_debugger_test {
+
+// Test fixture for BackgroundPdbParser tests.
+class BackgroundPdbParserTest : public ::testing::Test {
+ protected:
+  // Creates num_files mock PDB files. Each ParsePdbFile call takes
+  // a few milliseconds and records how many parses run at once.
+  void CreatePdbFiles(int num_files) {
+    for (int i = 0; i < num_files; ++i) {
+      shared_ptr<NiceMock<IPortablePdbFileMock>> pdb_file(
+          new NiceMock<IPortablePdbFileMock>());
+      EXPECT_CALL(*pdb_file, ParsePdbFile())
+          .Times(1)
+          .WillOnce(Invoke([this]() {
+            int running = ++running_parses_;
+            int max_running = max_running_parses_;
+            while (running > max_running &&
+                   !max_running_parses_.compare_exchange_weak(max_running,
+                                                              running)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            --running_parses_;
+            ++finished_parses_;
+            return true;
+          }));
+      pdb_files_.push_back(pdb_file);
+    }
+  }
+
+  // Mock PDB files to parse.
+  vector<shared_ptr<NiceMock<IPortablePdbFileMock>>> pdb_files_;
+
+  // Number of ParsePdbFile calls in progress.
+  atomic<int> running_parses_{0};
+
+  // Highest value running_parses_ reached.
+  atomic<int> max_running_parses_{0};
+
+  // Number of ParsePdbFile calls that returned.
+  atomic<int> finished_parses_{0};
+};
+
+// Tests that every queued PDB file is parsed exactly once and that
+// no more than the maximum number of threads are used.
+TEST_F(BackgroundPdbParserTest, ParsesWithBoundedThreads) {
+  CreatePdbFiles(20);
+
+  BackgroundPdbParser parser(3);
+  for (auto &&pdb_file : pdb_files_) {
+    parser.Enqueue(pdb_file);
+  }
+  parser.WaitUntilIdle();
+
+  EXPECT_EQ(finished_parses_, 20);
+  EXPECT_LE(parser.GetThreadCount(), 3);
+  EXPECT_LE(max_running_parses_, 3);
+}
+
+// Tests that threads are only started when there is work to do.
+TEST_F(BackgroundPdbParserTest, StartsThreadsLazily) {
+  BackgroundPdbParser parser(4);
+  EXPECT_EQ(parser.GetThreadCount(), 0);
+
+  CreatePdbFiles(1);
+  parser.Enqueue(pdb_files_[0]);
+  parser.WaitUntilIdle();
+
+  EXPECT_EQ(finished_parses_, 1);
+  EXPECT_EQ(parser.GetThreadCount(), 1);
+
+  // Null PDB files are ignored.
+  parser.Enqueue(nullptr);
+  parser.WaitUntilIdle();
+  EXPECT_EQ(parser.GetThreadCount(), 1);
+}
+
+}  // namespace google_cloud_debugger_test
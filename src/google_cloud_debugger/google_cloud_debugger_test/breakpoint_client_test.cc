@@ -23,12 +23,14 @@
 #include "i_named_pipe_mock.h"
 
 using ::testing::DoAll;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::SaveArg;
 using ::testing::_;
 using google::cloud::diagnostics::debug::Breakpoint;
 using google::cloud::diagnostics::debug::SourceLocation;
 using google_cloud_debugger::BreakpointClient;
+using google_cloud_debugger::PipeBuffer;
 using std::string;
 using std::unique_ptr;
 using std::vector;
@@ -176,4 +178,106 @@ TEST(BreakpointClientTest, WriteBreakpointError) {
   EXPECT_EQ(client.WriteBreakpoint(breakpoint), E_ABORT);
 }
 
+// Sets properties of Breakpoint breakpoint like SetBreakpointAndSerialize
+// but returns a length-prefixed breakpoint message.
+string SetBreakpointAndSerializeFramed(Breakpoint *breakpoint, int32_t line,
+                                       const string &path) {
+  string message = SetBreakpointAndSerialize(breakpoint, true, line, path);
+  string breakpoint_string;
+  breakpoint->SerializeToString(&breakpoint_string);
+
+  char header[google_cloud_debugger::kFramedMessageHeaderSize];
+  BreakpointClient::EncodeFramedMessageHeader(breakpoint_string.size(),
+                                              header);
+  return string(header, sizeof(header)) + breakpoint_string;
+}
+
+// Tests that ReadBreakpoint reads consecutive length-prefixed messages
+// that arrive in small chunks.
+TEST(BreakpointClientTest, ReadLengthPrefixedBreakpoints) {
+  Breakpoint first;
+  Breakpoint second;
+  string pipe_content = SetBreakpointAndSerializeFramed(&first, 35, "First") +
+                        SetBreakpointAndSerializeFramed(&second, 70, "Second");
+
+  unique_ptr<INamedPipeMock> named_pipe(new (std::nothrow) INamedPipeMock());
+  std::size_t position = 0;
+  EXPECT_CALL(*named_pipe, ReadBytes(_, _, _))
+      .WillRepeatedly(Invoke([&pipe_content, &position](
+                                 char *buffer, std::size_t buffer_size,
+                                 std::size_t *bytes_read) {
+        *bytes_read = std::min(
+            {buffer_size, static_cast<std::size_t>(7),
+             pipe_content.size() - position});
+        std::copy(pipe_content.begin() + position,
+                  pipe_content.begin() + position + *bytes_read, buffer);
+        position += *bytes_read;
+        return S_OK;
+      }));
+  BreakpointClient client(std::move(named_pipe));
+  client.SetFramingVersion(google_cloud_debugger::kLengthPrefixedFramingVersion);
+
+  Breakpoint read_breakpoint;
+  EXPECT_EQ(client.ReadBreakpoint(&read_breakpoint), S_OK);
+  EXPECT_EQ(read_breakpoint.location().line(), 35);
+  EXPECT_EQ(read_breakpoint.location().path(), "First");
+
+  EXPECT_EQ(client.ReadBreakpoint(&read_breakpoint), S_OK);
+  EXPECT_EQ(read_breakpoint.location().line(), 70);
+  EXPECT_EQ(read_breakpoint.location().path(), "Second");
+
+  // The pipe is closed after the second message.
+  EXPECT_EQ(client.ReadBreakpoint(&read_breakpoint), E_FAIL);
+}
+
+// Tests that ReadBreakpoint rejects a message without a valid header.
+TEST(BreakpointClientTest, ReadLengthPrefixedBreakpointBadHeader) {
+  Breakpoint breakpoint;
+  string pipe_content =
+      SetBreakpointAndSerialize(&breakpoint, true, 35, "My Path");
+
+  unique_ptr<INamedPipeMock> named_pipe(new (std::nothrow) INamedPipeMock());
+  EXPECT_CALL(*named_pipe, ReadBytes(_, _, _))
+      .WillOnce(Invoke([&pipe_content](char *buffer, std::size_t buffer_size,
+                                       std::size_t *bytes_read) {
+        *bytes_read = std::min(buffer_size, pipe_content.size());
+        std::copy(pipe_content.begin(), pipe_content.begin() + *bytes_read,
+                  buffer);
+        return S_OK;
+      }));
+  BreakpointClient client(std::move(named_pipe));
+  client.SetFramingVersion(google_cloud_debugger::kLengthPrefixedFramingVersion);
+
+  Breakpoint read_breakpoint;
+  EXPECT_EQ(client.ReadBreakpoint(&read_breakpoint), E_FAIL);
+}
+
+// Tests that WriteBreakpoint hands the header and the serialized
+// breakpoint to the pipe as separate buffers.
+TEST(BreakpointClientTest, WriteLengthPrefixedBreakpoint) {
+  Breakpoint breakpoint;
+  string breakpoint_string =
+      SetBreakpointAndSerializeFramed(&breakpoint, 35, "My Path");
+
+  unique_ptr<INamedPipeMock> named_pipe(new (std::nothrow) INamedPipeMock());
+  string written;
+  std::size_t buffer_count = 0;
+  EXPECT_CALL(*named_pipe, WriteBuffers(_))
+      .WillOnce(Invoke([&written, &buffer_count](
+                           const vector<PipeBuffer> &buffers) {
+        buffer_count = buffers.size();
+        for (const PipeBuffer &buffer : buffers) {
+          written.append(buffer.data, buffer.size);
+        }
+        return S_OK;
+      }));
+  EXPECT_CALL(*named_pipe, Write(_)).Times(0);
+  BreakpointClient client(std::move(named_pipe));
+  client.SetFramingVersion(google_cloud_debugger::kLengthPrefixedFramingVersion);
+
+  EXPECT_EQ(client.WriteBreakpoint(breakpoint), S_OK);
+  EXPECT_EQ(buffer_count, 2);
+  EXPECT_EQ(written, breakpoint_string);
+}
+
 }  // namespace google_cloud_debugger_test
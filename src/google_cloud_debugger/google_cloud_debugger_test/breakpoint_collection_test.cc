@@ -0,0 +1,258 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "breakpoint_client.h"
+#include "breakpoint_collection.h"
+#include "dbg_breakpoint.h"
+#include "debugger_callback.h"
+#include "i_cor_debug_mocks.h"
+#include "i_eval_coordinator_mock.h"
+#include "i_metadata_import_mock.h"
+#include "i_named_pipe_mock.h"
+#include "i_portable_pdb_mocks.h"
+#include "method_token_cache.h"
+
+using google::cloud::diagnostics::debug::Breakpoint;
+using google_cloud_debugger::BreakpointClient;
+using google_cloud_debugger::BreakpointCollection;
+using google_cloud_debugger::DbgBreakpoint;
+using google_cloud_debugger::MethodTokenCache;
+using std::shared_ptr;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+using ::testing::_;
+using ::testing::DoAll;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::SetArgPointee;
+using ::testing::SetArrayArgument;
+
+namespace google_cloud_debugger_test {
+
+// Test fixture for BreakpointCollection tests.
+class BreakpointCollectionTest : public ::testing::Test {
+ protected:
+  // Adds num_locations breakpoint locations to collection. The i-th
+  // location is at IL offset i of the method with token method_token_.
+  void AddBreakpointLocations(BreakpointCollection *collection,
+                              uint32_t num_locations) {
+    for (uint32_t i = 0; i < num_locations; ++i) {
+      shared_ptr<DbgBreakpoint> breakpoint(new DbgBreakpoint);
+      breakpoint->Initialize(file_name_, "ID" + std::to_string(i), i, 0, "",
+                             vector<string>());
+      breakpoint->SetActivated(true);
+      breakpoint->SetMethodToken(method_token_);
+      breakpoint->SetILOffset(i);
+      breakpoint->SetCorDebugBreakpoint(&cordebug_breakpoint_);
+      HRESULT hr = collection->AddBreakpointLocation(
+          breakpoint->GetBreakpointLocation(), std::move(breakpoint));
+      ASSERT_EQ(hr, S_OK);
+    }
+  }
+
+  // ICorDebugBreakpoint shared by all the breakpoints.
+  // This has to outlive the collections below.
+  NiceMock<ICorDebugBreakpointMock> cordebug_breakpoint_;
+
+  // Mock eval coordinator that is called when a breakpoint is hit.
+  IEvalCoordinatorMock eval_coordinator_;
+
+  // Empty list of PDB files.
+  vector<shared_ptr<google_cloud_debugger_portable_pdb::IPortablePdbFile>>
+      pdb_files_;
+
+  // File name of the breakpoints.
+  string file_name_ = "program.cs";
+
+  // Method token of the breakpoints.
+  mdMethodDef method_token_ = 0x06000001;
+
+  // Method token that no breakpoints are set in.
+  mdMethodDef unmatched_method_token_ = 0x06000002;
+};
+
+// Tests that EvaluateAndPrintBreakpoint only dispatches breakpoint hits
+// that match the method token and IL offset of a location.
+TEST_F(BreakpointCollectionTest, EvaluateAndPrintBreakpoint) {
+  BreakpointCollection collection;
+  AddBreakpointLocations(&collection, 10);
+
+  EXPECT_CALL(eval_coordinator_, ProcessBreakpoints(_, &collection, _, _))
+      .Times(1)
+      .WillOnce(Return(S_OK));
+  EXPECT_EQ(collection.EvaluateAndPrintBreakpoint(
+                method_token_, 5, &eval_coordinator_, nullptr, pdb_files_),
+            S_OK);
+
+  // No breakpoints at this IL offset or in this method.
+  EXPECT_EQ(collection.EvaluateAndPrintBreakpoint(
+                method_token_, 10, &eval_coordinator_, nullptr, pdb_files_),
+            S_FALSE);
+  EXPECT_EQ(collection.EvaluateAndPrintBreakpoint(
+                unmatched_method_token_, 5, &eval_coordinator_, nullptr,
+                pdb_files_),
+            S_FALSE);
+}
+
+// Tests that AddBreakpointLocation rejects null breakpoints.
+TEST_F(BreakpointCollectionTest, AddBreakpointLocationError) {
+  BreakpointCollection collection;
+  EXPECT_EQ(collection.AddBreakpointLocation("location", nullptr),
+            E_INVALIDARG);
+}
+
+// Tests that looking up a breakpoint hit does not compare the hit against
+// every active location, so its cost does not grow with the number of
+// locations.
+TEST_F(BreakpointCollectionTest, DispatchDoesNotScanLocations) {
+  BreakpointCollection collection;
+  AddBreakpointLocations(&collection, 10000);
+
+  for (uint32_t i = 0; i < 1000; ++i) {
+    EXPECT_EQ(collection.EvaluateAndPrintBreakpoint(unmatched_method_token_,
+                                                    i, &eval_coordinator_,
+                                                    nullptr, pdb_files_),
+              S_FALSE);
+  }
+  EXPECT_EQ(collection.GetLocationsExamined(), 0);
+
+  EXPECT_CALL(eval_coordinator_, ProcessBreakpoints(_, &collection, _, _))
+      .Times(1)
+      .WillOnce(Return(S_OK));
+  EXPECT_EQ(collection.EvaluateAndPrintBreakpoint(
+                method_token_, 9999, &eval_coordinator_, nullptr, pdb_files_),
+            S_OK);
+  EXPECT_EQ(collection.GetLocationsExamined(), 1);
+}
+
+// Tests that the method of a breakpoint is only resolved through
+// IMetaDataImport the first time a breakpoint is set in that method
+// and that the method token cache is used afterwards.
+TEST_F(BreakpointCollectionTest, ActivateBreakpointUsesMethodTokenCache) {
+  NiceMock<IPortablePdbFileMock> pdb_file;
+  NiceMock<IMetaDataImportMock> metadata_import;
+  NiceMock<ICorDebugModuleMock> debug_module;
+  NiceMock<ICorDebugFunctionMock> debug_function;
+  NiceMock<ICorDebugCodeMock> debug_code;
+  NiceMock<ICorDebugFunctionBreakpointMock> function_breakpoint;
+  MethodTokenCache method_token_cache;
+
+  uint32_t method_def = 3;
+  PCCOR_SIGNATURE signature = reinterpret_cast<PCCOR_SIGNATURE>(&method_def);
+  ULONG virtual_address = 0x2050;
+  mdMethodDef method_tokens[] = {method_token_};
+
+  ON_CALL(pdb_file, GetMethodTokenCache())
+      .WillByDefault(Return(&method_token_cache));
+  ON_CALL(pdb_file, GetDebugModule(_))
+      .WillByDefault(DoAll(SetArgPointee<0>(&debug_module), Return(S_OK)));
+  ON_CALL(pdb_file, GetMetaDataImport(_))
+      .WillByDefault(DoAll(SetArgPointee<0>(&metadata_import), Return(S_OK)));
+  ON_CALL(metadata_import, GetMethodProps(_, _, _, _, _, _, _, _, _, _))
+      .WillByDefault(DoAll(SetArgPointee<4>(0), SetArgPointee<6>(signature),
+                           SetArgPointee<8>(virtual_address), Return(S_OK)));
+  ON_CALL(debug_function, GetILCode(_))
+      .WillByDefault(DoAll(SetArgPointee<0>(&debug_code), Return(S_OK)));
+  ON_CALL(debug_code, CreateBreakpoint(_, _))
+      .WillByDefault(
+          DoAll(SetArgPointee<1>(&function_breakpoint), Return(S_OK)));
+
+  EXPECT_CALL(metadata_import, EnumMethodsWithName(_, _, _, _, _, _))
+      .Times(1)
+      .WillOnce(DoAll(SetArrayArgument<3>(method_tokens, method_tokens + 1),
+                      SetArgPointee<5>(1), Return(S_OK)));
+  EXPECT_CALL(debug_module, GetFunctionFromToken(method_token_, _))
+      .Times(1)
+      .WillOnce(DoAll(SetArgPointee<1>(&debug_function), Return(S_OK)));
+  EXPECT_CALL(function_breakpoint, Activate(TRUE))
+      .Times(2)
+      .WillRepeatedly(Return(S_OK));
+
+  BreakpointCollection collection;
+  for (uint32_t line = 10; line < 12; ++line) {
+    DbgBreakpoint breakpoint;
+    breakpoint.Initialize(file_name_, "ID" + std::to_string(line), line, 0,
+                          "", vector<string>());
+    breakpoint.SetMethodDef(method_def);
+    breakpoint.SetILOffset(line);
+    EXPECT_EQ(collection.ActivateBreakpointHelper(&breakpoint, &pdb_file),
+              S_OK);
+    EXPECT_EQ(breakpoint.GetMethodToken(), method_token_);
+  }
+  EXPECT_EQ(method_token_cache.Size(), 1);
+
+  // Unloading the module clears the cache.
+  method_token_cache.Clear();
+  EXPECT_EQ(method_token_cache.Size(), 0);
+}
+
+// Tests that CancelSyncBreakpoints writes the queued breakpoints before
+// it tells the agent to shut down and shuts down the pipes.
+TEST_F(BreakpointCollectionTest, CancelSyncBreakpointsWritesQueued) {
+  // Ids of the breakpoints written to the pipe, "kill" for the message
+  // that shuts down the agent and "shutdown" when the pipe is shut down.
+  vector<string> events;
+  unique_ptr<INamedPipeMock> write_pipe(new INamedPipeMock());
+  EXPECT_CALL(*write_pipe, Write(_))
+      .WillRepeatedly(Invoke([&events](const string &message) {
+        size_t start = google_cloud_debugger::kStartBreakpointMessage.size();
+        size_t end = google_cloud_debugger::kEndBreakpointMessage.size();
+        Breakpoint breakpoint;
+        EXPECT_TRUE(breakpoint.ParseFromString(
+            message.substr(start, message.size() - start - end)));
+        events.push_back(breakpoint.kill_server() ? "kill" : breakpoint.id());
+        return S_OK;
+      }));
+  EXPECT_CALL(*write_pipe, ShutDown())
+      .Times(1)
+      .WillRepeatedly(Invoke([&events]() {
+        events.push_back("shutdown");
+        return S_OK;
+      }));
+  unique_ptr<INamedPipeMock> read_pipe(new INamedPipeMock());
+  EXPECT_CALL(*read_pipe, ShutDown()).Times(1).WillRepeatedly(Return(S_OK));
+
+  BreakpointCollection collection;
+  collection.SetBreakpointClients(
+      unique_ptr<BreakpointClient>(new BreakpointClient(std::move(read_pipe))),
+      unique_ptr<BreakpointClient>(
+          new BreakpointClient(std::move(write_pipe))));
+
+  for (const string &id : {"first", "second", "third"}) {
+    shared_ptr<Breakpoint> breakpoint = std::make_shared<Breakpoint>();
+    breakpoint->set_id(id);
+    EXPECT_EQ(collection.QueueBreakpoint(std::move(breakpoint)), S_OK);
+  }
+  EXPECT_EQ(collection.CancelSyncBreakpoints(), S_OK);
+
+  EXPECT_EQ(events, vector<string>({"first", "second", "third", "kill",
+                                    "shutdown"}));
+
+  // Nothing is written to the pipe once it is shut down.
+  Breakpoint late;
+  late.set_id("late");
+  EXPECT_TRUE(FAILED(collection.WriteBreakpoint(late)));
+  EXPECT_EQ(collection.CancelSyncBreakpoints(), S_OK);
+  EXPECT_EQ(events.size(), 5);
+}
+
+}  // namespace google_cloud_debugger_test
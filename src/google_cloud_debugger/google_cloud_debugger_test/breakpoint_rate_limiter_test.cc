@@ -0,0 +1,184 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <gtest/gtest.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "breakpoint_rate_limiter.h"
+
+using google_cloud_debugger::BreakpointRateLimiter;
+using google_cloud_debugger::TokenBucket;
+using std::string;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+namespace google_cloud_debugger_test {
+
+typedef BreakpointRateLimiter::Decision Decision;
+
+// Test Fixture for BreakpointRateLimiter.
+// The rate limiter reads the time from a fake clock that only moves
+// when the test advances it.
+class BreakpointRateLimiterTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    limits_.breakpoint_conditions_per_second = 10;
+    limits_.global_conditions_per_second = 15;
+    limits_.breakpoint_snapshots_per_second = 2;
+    limits_.global_snapshots_per_second = 3;
+    limits_.breakpoint_stopped_time_per_second = milliseconds(10);
+    limits_.global_stopped_time_per_second = milliseconds(100);
+    limits_.burst_seconds = 1;
+    limits_.stopped_time_burst_seconds = 1;
+  }
+
+  // Creates rate_limiter_ with limits_.
+  void CreateRateLimiter() {
+    rate_limiter_.reset(new BreakpointRateLimiter(
+        limits_, [this]() { return now_; }));
+  }
+
+  // Current time of the fake clock.
+  BreakpointRateLimiter::Clock::time_point now_;
+
+  // Limits used by CreateRateLimiter.
+  BreakpointRateLimiter::Limits limits_;
+
+  // Rate limiter under test.
+  std::unique_ptr<BreakpointRateLimiter> rate_limiter_;
+
+  // Reason set by the rate limiter.
+  string reason_;
+};
+
+// Tests that the bucket refills at its fill rate up to its capacity.
+TEST(TokenBucketTest, Refill) {
+  TokenBucket::TimePoint now;
+  TokenBucket bucket(2, 4, now);
+  EXPECT_TRUE(bucket.TryTake(2, now));
+  EXPECT_FALSE(bucket.TryTake(1, now));
+
+  now += milliseconds(250);
+  EXPECT_DOUBLE_EQ(1, bucket.Available(now));
+  EXPECT_TRUE(bucket.TryTake(1, now));
+
+  now += std::chrono::seconds(10);
+  EXPECT_DOUBLE_EQ(2, bucket.Available(now));
+}
+
+// Tests that Take can put the bucket in debt.
+TEST(TokenBucketTest, Debt) {
+  TokenBucket::TimePoint now;
+  TokenBucket bucket(2, 1, now);
+  bucket.Take(5, now);
+  EXPECT_DOUBLE_EQ(-3, bucket.Available(now));
+  EXPECT_FALSE(bucket.TryTake(1, now));
+
+  now += std::chrono::seconds(4);
+  EXPECT_DOUBLE_EQ(1, bucket.Available(now));
+}
+
+// Tests that a breakpoint that evaluates its condition too often is
+// disabled.
+TEST_F(BreakpointRateLimiterTest, DisablesBreakpointOverConditionLimit) {
+  CreateRateLimiter();
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(Decision::kAllow,
+              rate_limiter_->AcquireConditionEvaluation("bp", &reason_));
+  }
+
+  EXPECT_EQ(Decision::kDisable,
+            rate_limiter_->AcquireConditionEvaluation("bp", &reason_));
+  EXPECT_NE(string::npos, reason_.find("10 times per second"));
+
+  // Hits that are already in flight are skipped.
+  now_ += std::chrono::seconds(1);
+  EXPECT_EQ(Decision::kSkip,
+            rate_limiter_->AcquireConditionEvaluation("bp", &reason_));
+
+  // Other breakpoints are not affected.
+  EXPECT_EQ(Decision::kAllow,
+            rate_limiter_->AcquireConditionEvaluation("other", &reason_));
+}
+
+// Tests that hits are skipped, not disabled, when only the global
+// condition limit is exceeded.
+TEST_F(BreakpointRateLimiterTest, SkipsOverGlobalConditionLimit) {
+  CreateRateLimiter();
+  for (int i = 0; i < 15; ++i) {
+    EXPECT_EQ(Decision::kAllow, rate_limiter_->AcquireConditionEvaluation(
+                                    std::to_string(i), &reason_));
+  }
+
+  EXPECT_EQ(Decision::kSkip,
+            rate_limiter_->AcquireConditionEvaluation("bp", &reason_));
+
+  now_ += milliseconds(100);
+  EXPECT_EQ(Decision::kAllow,
+            rate_limiter_->AcquireConditionEvaluation("bp", &reason_));
+}
+
+// Tests the per breakpoint and global snapshot limits.
+TEST_F(BreakpointRateLimiterTest, SnapshotLimits) {
+  CreateRateLimiter();
+  EXPECT_EQ(Decision::kAllow, rate_limiter_->AcquireSnapshot("a", &reason_));
+  EXPECT_EQ(Decision::kAllow, rate_limiter_->AcquireSnapshot("a", &reason_));
+  EXPECT_EQ(Decision::kDisable,
+            rate_limiter_->AcquireSnapshot("a", &reason_));
+
+  EXPECT_EQ(Decision::kAllow, rate_limiter_->AcquireSnapshot("b", &reason_));
+  EXPECT_EQ(Decision::kSkip, rate_limiter_->AcquireSnapshot("c", &reason_));
+}
+
+// Tests that a breakpoint that stops the debuggee for too long is
+// disabled and that the global stopped time budget skips other hits.
+TEST_F(BreakpointRateLimiterTest, StoppedTime) {
+  limits_.global_stopped_time_per_second = milliseconds(20);
+  CreateRateLimiter();
+  EXPECT_EQ(Decision::kAllow,
+            rate_limiter_->ChargeStoppedTime("bp", milliseconds(10), &reason_));
+  EXPECT_EQ(Decision::kDisable,
+            rate_limiter_->ChargeStoppedTime("bp", microseconds(1), &reason_));
+  EXPECT_NE(string::npos, reason_.find("10 ms per second"));
+
+  // A disabled breakpoint is only reported once.
+  EXPECT_EQ(Decision::kAllow,
+            rate_limiter_->ChargeStoppedTime("bp", milliseconds(5), &reason_));
+
+  // The global budget is now used up as well.
+  rate_limiter_->ChargeStoppedTime("other", milliseconds(6), &reason_);
+  EXPECT_EQ(Decision::kSkip,
+            rate_limiter_->AcquireSnapshot("third", &reason_));
+
+  now_ += std::chrono::seconds(1);
+  EXPECT_EQ(Decision::kAllow,
+            rate_limiter_->AcquireSnapshot("third", &reason_));
+}
+
+// Tests that RemoveBreakpoint forgets the usage of a breakpoint.
+TEST_F(BreakpointRateLimiterTest, RemoveBreakpoint) {
+  CreateRateLimiter();
+  rate_limiter_->AcquireSnapshot("bp", &reason_);
+  rate_limiter_->AcquireSnapshot("bp", &reason_);
+  EXPECT_EQ(Decision::kDisable,
+            rate_limiter_->AcquireSnapshot("bp", &reason_));
+
+  rate_limiter_->RemoveBreakpoint("bp");
+  now_ += std::chrono::seconds(1);
+  EXPECT_EQ(Decision::kAllow, rate_limiter_->AcquireSnapshot("bp", &reason_));
+}
+
+}  // namespace google_cloud_debugger_test
@@ -13,12 +13,41 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdlib>
+#include <new>
+
 using google_cloud_debugger::DbgObject;
 using google_cloud_debugger::DbgPrimitive;
 using std::shared_ptr;
 
+namespace {
+
+// Number of calls to operator new made by the current thread.
+thread_local std::size_t thread_allocation_count = 0;
+
+}  // namespace
+
+// Counts the allocations of the current thread for AllocationCounter.
+void *operator new(std::size_t size) {
+  ++thread_allocation_count;
+  void *memory = std::malloc(size == 0 ? 1 : size);
+  if (!memory) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+
 namespace google_cloud_debugger_test {
 
+AllocationCounter::AllocationCounter()
+    : start_count_(thread_allocation_count) {}
+
+std::size_t AllocationCounter::GetCount() const {
+  return thread_allocation_count - start_count_;
+}
+
 void NumericalEvaluatorTestFixture::SetUp() {
   first_short_obj_ =
       shared_ptr<DbgObject>(new DbgPrimitive<int16_t>(first_short_obj_value_));
@@ -17,6 +17,7 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <cstddef>
 #include <string>
 
 #include "class_names.h"
@@ -107,6 +108,21 @@ class NumericalEvaluatorTestFixture : public ::testing::Test {
   std::ostringstream err_stream_;
 };
 
+// Counts the calls to operator new that the current thread makes while
+// the counter is alive. The test binary replaces the global operator new
+// in common_fixtures.cc to keep the count.
+class AllocationCounter {
+ public:
+  AllocationCounter();
+
+  // Returns the number of allocations made since the counter was created.
+  std::size_t GetCount() const;
+
+ private:
+  // Number of allocations made by the thread when the counter was created.
+  std::size_t start_count_;
+};
+
 }  // namespace google_cloud_debugger_test
 
 #endif  //  COMMON_FIXTURES_H_
@@ -15,6 +15,8 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cstdio>
+#include <fstream>
 #include <string>
 
 #include "custom_binary_reader.h"
@@ -170,4 +172,65 @@ TEST(BinaryReader, GetStringTest) {
   EXPECT_EQ(second_string, "def");
 }
 
+// Tests that GetStringView and GetBlobView point into the stream
+// without changing the stream position.
+TEST(BinaryReader, GetViewTest) {
+  char test_data[] = {'a', 'b', 'c', 0, 0x03, 0x07, 0x08, 0x09, 0x05};
+  unique_ptr<stringstream> test_stream =
+      SetUpStream(test_data, sizeof(test_data));
+  google_cloud_debugger_portable_pdb::CustomBinaryStream binary_stream;
+
+  EXPECT_TRUE(binary_stream.ConsumeStream(test_stream.release()));
+
+  const char *string_data;
+  uint32_t string_length;
+  EXPECT_TRUE(binary_stream.GetStringView(0, &string_data, &string_length));
+  EXPECT_EQ(string(string_data, string_length), "abc");
+
+  const uint8_t *blob_data;
+  uint32_t blob_length;
+  EXPECT_TRUE(binary_stream.GetBlobView(4, &blob_data, &blob_length));
+  EXPECT_EQ(blob_length, 3);
+  EXPECT_EQ(blob_data[0], 0x07);
+  EXPECT_EQ(blob_data[2], 0x09);
+
+  // The blob at offset 8 claims 5 bytes but there are none left.
+  EXPECT_FALSE(binary_stream.GetBlobView(8, &blob_data, &blob_length));
+  EXPECT_EQ(binary_stream.Current(), 0);
+
+  // Views are bounded by the stream length.
+  EXPECT_TRUE(binary_stream.SetStreamLength(2));
+  EXPECT_TRUE(binary_stream.GetStringView(0, &string_data, &string_length));
+  EXPECT_EQ(string(string_data, string_length), "ab");
+  EXPECT_FALSE(binary_stream.GetBlobView(4, &blob_data, &blob_length));
+}
+
+// Tests that ConsumeFile exposes the content of the file.
+TEST(BinaryReader, ConsumeFileTest) {
+  const string file_name = "custom_binary_stream_test.bin";
+  {
+    std::ofstream file(file_name, std::ios::out | std::ios::binary);
+    char test_data[] = {0x01, 0x02, 0x03, 0x04, 'd', 'e', 'f', 0};
+    file.write(test_data, sizeof(test_data));
+  }
+
+  google_cloud_debugger_portable_pdb::CustomBinaryStream binary_stream;
+  EXPECT_TRUE(binary_stream.ConsumeFile(file_name));
+
+  uint32_t value;
+  EXPECT_TRUE(binary_stream.ReadUInt32(&value));
+  EXPECT_EQ(value, 0x04030201);
+
+  string result;
+  EXPECT_TRUE(binary_stream.GetString(&result, binary_stream.Current()));
+  EXPECT_EQ(result, "def");
+
+  EXPECT_TRUE(binary_stream.SeekFromCurrent(4));
+  EXPECT_FALSE(binary_stream.HasNext());
+  EXPECT_FALSE(binary_stream.ReadUInt32(&value));
+
+  std::remove(file_name.c_str());
+  EXPECT_FALSE(binary_stream.ConsumeFile(file_name));
+}
+
 }  // namespace google_cloud_debugger_test
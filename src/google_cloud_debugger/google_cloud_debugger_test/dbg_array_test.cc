@@ -361,6 +361,134 @@ TEST_F(DbgArrayTest, TestPopulateMembers) {
   EXPECT_EQ(variable.members(1).value(), std::to_string(value1));
 }
 
+// Tests that PopulateMembers reads the items of an array of primitives
+// with a single ReadMemory call.
+TEST_F(DbgArrayTest, TestPopulatePrimitiveMembers) {
+  SetUpArray();
+
+  Variable variable;
+  vector<VariableWrapper> variable_wrappers;
+  DbgArray dbgarray(&array_type_, 1, debug_helper_, dbg_object_factory_);
+  dbgarray.Initialize(&array_value_, FALSE);
+
+  ICorDebugThreadMock debug_thread;
+  ICorDebugProcessMock debug_process;
+  EXPECT_CALL(eval_coordinator_, GetActiveDebugThread(_))
+      .WillRepeatedly(DoAll(SetArgPointee<0>(&debug_thread), Return(S_OK)));
+  EXPECT_CALL(debug_thread, GetProcess(_))
+      .WillRepeatedly(DoAll(SetArgPointee<0>(&debug_process), Return(S_OK)));
+
+  // Only the first item is retrieved to get the address of the items.
+  ICorDebugGenericValueMock item0;
+  CORDB_ADDRESS item0_address = 0x1000;
+  EXPECT_CALL(array_value_, GetElementAtPosition(0, _))
+      .Times(1)
+      .WillRepeatedly(DoAll(SetArgPointee<1>(&item0), Return(S_OK)));
+  EXPECT_CALL(array_value_, GetElementAtPosition(1, _)).Times(0);
+  EXPECT_CALL(item0, GetAddress(_))
+      .WillRepeatedly(DoAll(SetArgPointee<0>(item0_address), Return(S_OK)));
+  EXPECT_CALL(item0, GetSize(_))
+      .WillRepeatedly(DoAll(SetArgPointee<0>(sizeof(int32_t)), Return(S_OK)));
+
+  int32_t values[] = {20, 40};
+  BYTE *bytes = reinterpret_cast<BYTE *>(values);
+  EXPECT_CALL(debug_process, ReadMemory(item0_address, sizeof(values), _, _))
+      .Times(1)
+      .WillRepeatedly(DoAll(SetArrayArgument<2>(bytes, bytes + sizeof(values)),
+                            SetArgPointee<3>(sizeof(values)), Return(S_OK)));
+
+  HRESULT hr = dbgarray.PopulateMembers(&variable, &variable_wrappers,
+                                        &eval_coordinator_);
+  EXPECT_EQ(hr, S_OK);
+
+  // The members are populated directly without DbgObjects.
+  EXPECT_EQ(variable_wrappers.size(), 0);
+  ASSERT_EQ(variable.members_size(), 2);
+  EXPECT_EQ(variable.members(0).name(), "[0]");
+  EXPECT_EQ(variable.members(1).name(), "[1]");
+  EXPECT_EQ(variable.members(0).type(), "System.Int32");
+  EXPECT_EQ(variable.members(1).type(), "System.Int32");
+  EXPECT_EQ(variable.members(0).value(), std::to_string(values[0]));
+  EXPECT_EQ(variable.members(1).value(), std::to_string(values[1]));
+}
+
+// Tests that PopulateMembers falls back to retrieving the items one by
+// one if they cannot be read from memory.
+TEST_F(DbgArrayTest, TestPopulatePrimitiveMembersReadError) {
+  SetUpArray();
+
+  Variable variable;
+  vector<VariableWrapper> variable_wrappers;
+  DbgArray dbgarray(&array_type_, 1, debug_helper_, dbg_object_factory_);
+  dbgarray.Initialize(&array_value_, FALSE);
+
+  ICorDebugThreadMock debug_thread;
+  ICorDebugProcessMock debug_process;
+  EXPECT_CALL(eval_coordinator_, GetActiveDebugThread(_))
+      .WillRepeatedly(DoAll(SetArgPointee<0>(&debug_thread), Return(S_OK)));
+  EXPECT_CALL(debug_thread, GetProcess(_))
+      .WillRepeatedly(DoAll(SetArgPointee<0>(&debug_process), Return(S_OK)));
+  EXPECT_CALL(debug_process, ReadMemory(_, _, _, _))
+      .WillRepeatedly(Return(E_FAIL));
+
+  ICorDebugGenericValueMock item0;
+  int32_t value0 = 20;
+  SetUpMockGenericValue(&item0, value0);
+  EXPECT_CALL(item0, GetAddress(_))
+      .WillRepeatedly(DoAll(SetArgPointee<0>(0x1000), Return(S_OK)));
+  EXPECT_CALL(item0, GetSize(_))
+      .WillRepeatedly(DoAll(SetArgPointee<0>(sizeof(int32_t)), Return(S_OK)));
+  EXPECT_CALL(array_value_, GetElementAtPosition(0, _))
+      .WillRepeatedly(DoAll(SetArgPointee<1>(&item0), Return(S_OK)));
+
+  ICorDebugGenericValueMock item1;
+  int32_t value1 = 40;
+  SetUpMockGenericValue(&item1, value1);
+  EXPECT_CALL(array_value_, GetElementAtPosition(1, _))
+      .Times(1)
+      .WillRepeatedly(DoAll(SetArgPointee<1>(&item1), Return(S_OK)));
+
+  HRESULT hr = dbgarray.PopulateMembers(&variable, &variable_wrappers,
+                                        &eval_coordinator_);
+  EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
+
+  ASSERT_EQ(variable_wrappers.size(), 2);
+  PopulateTypeAndValue(variable_wrappers);
+  EXPECT_EQ(variable.members(0).value(), std::to_string(value0));
+  EXPECT_EQ(variable.members(1).value(), std::to_string(value1));
+}
+
+// Tests that the items of an array of primitives that is too large to
+// read at once, which expressions can request, are retrieved one by one.
+TEST_F(DbgArrayTest, TestPopulatePrimitiveMembersLargeArray) {
+  const int item_count = DbgArray::kMaximumPrimitiveItemsToRead + 1;
+  dimensions_[0] = item_count;
+  SetUpArray();
+
+  Variable variable;
+  vector<VariableWrapper> variable_wrappers;
+  DbgArray dbgarray(&array_type_, 1, debug_helper_, dbg_object_factory_);
+  dbgarray.Initialize(&array_value_, FALSE);
+  dbgarray.SetMaxArrayItemsToRetrieve(UINT32_MAX);
+
+  ICorDebugThreadMock debug_thread;
+  ICorDebugProcessMock debug_process;
+  EXPECT_CALL(eval_coordinator_, GetActiveDebugThread(_))
+      .WillRepeatedly(DoAll(SetArgPointee<0>(&debug_thread), Return(S_OK)));
+  EXPECT_CALL(debug_thread, GetProcess(_))
+      .WillRepeatedly(DoAll(SetArgPointee<0>(&debug_process), Return(S_OK)));
+  EXPECT_CALL(debug_process, ReadMemory(_, _, _, _)).Times(0);
+  EXPECT_CALL(array_value_, GetElementAtPosition(_, _))
+      .Times(item_count)
+      .WillRepeatedly(Return(E_FAIL));
+
+  HRESULT hr = dbgarray.PopulateMembers(&variable, &variable_wrappers,
+                                        &eval_coordinator_);
+  EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
+  EXPECT_EQ(variable.members_size(), item_count);
+  EXPECT_TRUE(variable.members(item_count - 1).status().iserror());
+}
+
 // Tests error case for PopulateMembers function of DbgArray.
 TEST_F(DbgArrayTest, TestPopulateMembersError) {
   SetUpArray();
@@ -118,6 +118,18 @@ TEST_F(DbgBreakpointTest, Initialize) {
   EXPECT_EQ(breakpoint2.GetColumn(), breakpoint_.GetColumn());
 }
 
+// Tests that the logpoint fields are copied by Initialize.
+TEST_F(DbgBreakpointTest, InitializeLogPoint) {
+  SetUpBreakpoint();
+  breakpoint_.SetLogPoint(true);
+  breakpoint_.SetLogMessageFormat("Value is $0");
+
+  DbgBreakpoint breakpoint2;
+  breakpoint2.Initialize(breakpoint_);
+  EXPECT_TRUE(breakpoint2.IsLogPoint());
+  EXPECT_EQ(breakpoint2.GetLogMessageFormat(), "Value is $0");
+}
+
 // Tests that the Set/GetMethodToken function sets up the correct fields.
 TEST_F(DbgBreakpointTest, SetGetMethodToken) {
   mdMethodDef method_token = 10;
@@ -355,6 +367,57 @@ TEST_F(DbgBreakpointTest, EvaluateExpressions) {
   EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
 }
 
+// Tests that expressions parsed once by ParseConditionAndExpressions
+// can be evaluated on every hit of the breakpoint.
+TEST_F(DbgBreakpointTest, EvaluateParsedExpressionsMultipleTimes) {
+  expressions_ = { "1", "2" };
+  SetUpBreakpoint();
+  breakpoint_.ParseConditionAndExpressions();
+
+  int num_hits = 3;
+  EXPECT_CALL(eval_coordinator_mock_, GetActiveDebugFrame(_))
+    .Times(expressions_.size() * num_hits)
+    .WillRepeatedly(DoAll(SetArgPointee<0>(&active_frame_mock_), Return(S_OK)));
+
+  for (int i = 0; i < num_hits; ++i) {
+    HRESULT hr = breakpoint_.EvaluateExpressions(
+        &dbg_stack_frame_, &eval_coordinator_mock_, &object_factory_);
+    EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
+  }
+}
+
+// Tests that a condition parsed once by ParseConditionAndExpressions
+// can be evaluated on every hit of the breakpoint.
+TEST_F(DbgBreakpointTest, EvaluateParsedConditionMultipleTimes) {
+  condition_ = "1 < 2";
+  SetUpBreakpoint();
+  breakpoint_.ParseConditionAndExpressions();
+
+  int num_hits = 3;
+  EXPECT_CALL(eval_coordinator_mock_, GetActiveDebugFrame(_))
+    .Times(num_hits)
+    .WillRepeatedly(DoAll(SetArgPointee<0>(&active_frame_mock_), Return(S_OK)));
+
+  for (int i = 0; i < num_hits; ++i) {
+    HRESULT hr = breakpoint_.EvaluateCondition(
+        &dbg_stack_frame_, &eval_coordinator_mock_, &object_factory_);
+    EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
+    EXPECT_TRUE(breakpoint_.GetEvaluatedCondition());
+  }
+}
+
+// Tests that a condition that cannot be parsed is reported
+// when the breakpoint is evaluated.
+TEST_F(DbgBreakpointTest, EvaluateUnparsableCondition) {
+  condition_ = "1 <";
+  SetUpBreakpoint();
+  breakpoint_.ParseConditionAndExpressions();
+
+  HRESULT hr = breakpoint_.EvaluateCondition(
+      &dbg_stack_frame_, &eval_coordinator_mock_, &object_factory_);
+  EXPECT_EQ(hr, E_FAIL);
+}
+
 // Tests that after EvaluateExpressions is called, PopulateBreakpoint
 // populates breakpoint proto with expressions.
 TEST_F(DbgBreakpointTest, PopulateBreakpointExpression) {
@@ -396,4 +459,40 @@ TEST_F(DbgBreakpointTest, PopulateBreakpointExpression) {
   }
 }
 
+// Tests the placeholders of FormatLogMessage.
+TEST_F(DbgBreakpointTest, FormatLogMessage) {
+  vector<string> arguments = {"a", "b"};
+  EXPECT_EQ(DbgBreakpoint::FormatLogMessage("$1 and $0", arguments),
+            "b and a");
+  EXPECT_EQ(DbgBreakpoint::FormatLogMessage("Costs $$5", arguments),
+            "Costs $5");
+  EXPECT_EQ(DbgBreakpoint::FormatLogMessage("$2 is missing", arguments),
+            "$2 is missing");
+  EXPECT_EQ(DbgBreakpoint::FormatLogMessage("$x and $", arguments),
+            "$x and $");
+  EXPECT_EQ(DbgBreakpoint::FormatLogMessage("", arguments), "");
+}
+
+// Tests that after EvaluateExpressions is called, PopulateLogMessage
+// formats the message of a logpoint without touching the stack frames.
+TEST_F(DbgBreakpointTest, PopulateLogMessage) {
+  expressions_ = { "1", "2" };
+  SetUpBreakpoint();
+  breakpoint_.SetLogPoint(true);
+  breakpoint_.SetLogMessageFormat("$0 + $1");
+
+  EXPECT_CALL(eval_coordinator_mock_, GetActiveDebugFrame(_))
+    .Times(expressions_.size())
+    .WillRepeatedly(DoAll(SetArgPointee<0>(&active_frame_mock_), Return(S_OK)));
+
+  HRESULT hr = breakpoint_.EvaluateExpressions(&dbg_stack_frame_, &eval_coordinator_mock_, &object_factory_);
+  EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
+
+  string message;
+  hr = breakpoint_.PopulateLogMessage(&message);
+  EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
+  EXPECT_EQ(message, "1 + 2");
+  EXPECT_EQ(breakpoint_.PopulateLogMessage(nullptr), E_INVALIDARG);
+}
+
 }  // namespace google_cloud_debugger_test
@@ -0,0 +1,95 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "dbg_object_pool.h"
+#include "dbg_string.h"
+
+using google_cloud_debugger::DbgObject;
+using google_cloud_debugger::DbgObjectPool;
+using google_cloud_debugger::DbgString;
+using std::vector;
+
+namespace google_cloud_debugger_test {
+
+// Tests that freed blocks are reused for blocks of the same size.
+TEST(DbgObjectPoolTest, ReusesFreedBlocks) {
+  DbgObjectPool pool;
+  void *first = pool.Allocate(40);
+  void *second = pool.Allocate(40);
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  EXPECT_NE(first, second);
+
+  pool.Free(first, 40);
+  EXPECT_EQ(pool.Allocate(33), first);
+  EXPECT_NE(pool.Allocate(40), first);
+  EXPECT_EQ(pool.GetStats().live_blocks, 3);
+}
+
+// Tests that the pool is rewound once every block is freed and that
+// only the first chunk is kept.
+TEST(DbgObjectPoolTest, RewindsWhenEmpty) {
+  DbgObjectPool pool;
+  vector<void *> blocks;
+  for (std::size_t i = 0; i < 3 * DbgObjectPool::kChunkSize / 64; ++i) {
+    blocks.push_back(pool.Allocate(64));
+    ASSERT_NE(blocks.back(), nullptr);
+  }
+
+  DbgObjectPool::Stats stats = pool.GetStats();
+  EXPECT_EQ(stats.live_blocks, blocks.size());
+  EXPECT_EQ(stats.chunks, 3);
+  EXPECT_EQ(stats.rewinds, 0);
+
+  for (void *block : blocks) {
+    pool.Free(block, 64);
+  }
+
+  stats = pool.GetStats();
+  EXPECT_EQ(stats.live_blocks, 0);
+  EXPECT_EQ(stats.chunks, 1);
+  EXPECT_EQ(stats.rewinds, 1);
+
+  // Allocation starts again at the beginning of the first chunk,
+  // whatever the size of the block.
+  EXPECT_EQ(pool.Allocate(128), blocks[0]);
+}
+
+// Tests that large blocks are not allocated from the pool.
+TEST(DbgObjectPoolTest, LargeBlocks) {
+  DbgObjectPool pool;
+  void *block = pool.Allocate(DbgObjectPool::kMaxBlockSize + 1);
+  ASSERT_NE(block, nullptr);
+  EXPECT_EQ(pool.GetStats().live_blocks, 0);
+  EXPECT_EQ(pool.GetStats().chunks, 0);
+  pool.Free(block, DbgObjectPool::kMaxBlockSize + 1);
+}
+
+// Tests that DbgObjects are allocated from the pool of DbgObject.
+TEST(DbgObjectPoolTest, DbgObjectsUsePool) {
+  DbgObjectPool *pool = DbgObject::GetObjectPool();
+  std::size_t live_blocks = pool->GetStats().live_blocks;
+  {
+    std::unique_ptr<DbgObject> first(new (std::nothrow) DbgString("first"));
+    std::unique_ptr<DbgObject> second(new DbgString("second"));
+    EXPECT_EQ(pool->GetStats().live_blocks, live_blocks + 2);
+  }
+  EXPECT_EQ(pool->GetStats().live_blocks, live_blocks);
+}
+
+}  // namespace google_cloud_debugger_test
@@ -31,6 +31,7 @@ using google::cloud::diagnostics::debug::StackFrame;
 using google_cloud_debugger::CComPtr;
 using google_cloud_debugger::ConvertStringToWCharPtr;
 using google_cloud_debugger::CorDebugHelper;
+using google_cloud_debugger::DbgObject;
 using google_cloud_debugger::DbgObjectFactory;
 using google_cloud_debugger::DbgStackFrame;
 using google_cloud_debugger::ICorDebugHelper;
@@ -94,6 +95,24 @@ class DbgStackFrameTest : public ::testing::Test {
 
   // Sets up mock calls to process local variables.
   virtual void SetUpLocalVariables() {
+    SetUpLocalVariableInfos();
+
+    // Makes the ICorDebugValueEnum returns the local variables that we set up.
+    EXPECT_CALL(frame_mock_, EnumerateLocalVariables(_))
+        .Times(1)
+        .WillRepeatedly(
+            DoAll(SetArgPointee<0>(&local_var_enum_mock_), Return(S_OK)));
+
+    EXPECT_CALL(local_var_enum_mock_, Next(_, _, _))
+        .Times(2)
+        .WillOnce(DoAll(SetArrayArgument<1>(local_variables_.begin(),
+                                            local_variables_.end()),
+                        SetArgPointee<2>(2), Return(S_OK)));
+  }
+
+  // Sets up the local variables and their names without expecting
+  // them to be enumerated.
+  virtual void SetUpLocalVariableInfos() {
     // Sets up the name, position and value
     // of the variables.
     first_local_var_.slot_ = 0;
@@ -120,18 +139,6 @@ class DbgStackFrameTest : public ::testing::Test {
                           first_local_var_.value_);
     SetUpMockGenericValue(&(second_local_var_.cordebug_value_),
                           second_local_var_.value_);
-
-    // Makes the ICorDebugValueEnum returns the local variables that we set up.
-    EXPECT_CALL(frame_mock_, EnumerateLocalVariables(_))
-        .Times(1)
-        .WillRepeatedly(
-            DoAll(SetArgPointee<0>(&local_var_enum_mock_), Return(S_OK)));
-
-    EXPECT_CALL(local_var_enum_mock_, Next(_, _, _))
-        .Times(2)
-        .WillOnce(DoAll(SetArrayArgument<1>(local_variables_.begin(),
-                                            local_variables_.end()),
-                        SetArgPointee<2>(2), Return(S_OK)));
   }
 
   // Sets up mock calls to process method arguments.
@@ -341,6 +348,61 @@ TEST_F(DbgStackFrameTest, TestInitializeEnumerateArgumentsError) {
   EXPECT_EQ(hr, CORDBG_E_BAD_THREAD_STATE);
 }
 
+// Tests that a frame initialized with SetLazyVariables only retrieves
+// the variables that are looked up.
+TEST_F(DbgStackFrameTest, TestLazyVariables) {
+  DbgStackFrame stack_frame(debug_helper_, dbg_object_factory_);
+  ICorDebugThreadMock debug_thread;
+
+  SetUpLocalVariableInfos();
+  SetUpMetaDataImport();
+  first_method_arg_.value_ = 1000;
+  SetUpMockGenericValue(&(first_method_arg_.cordebug_value_),
+                        first_method_arg_.value_);
+
+  ON_CALL(debug_thread, GetActiveFrame(_))
+      .WillByDefault(DoAll(SetArgPointee<0>(&frame_mock_), Return(S_OK)));
+  ON_CALL(frame_mock_, QueryInterface(__uuidof(ICorDebugILFrame), _))
+      .WillByDefault(DoAll(SetArgPointee<1>(&frame_mock_), Return(S_OK)));
+  ON_CALL(debug_module_, GetMetaDataInterface(_, _))
+      .WillByDefault(DoAll(SetArgPointee<1>(&metadata_import_), Return(S_OK)));
+
+  // Nothing is enumerated by Initialize.
+  stack_frame.SetLazyVariables(&debug_thread);
+  HRESULT hr = stack_frame.Initialize(
+      &frame_mock_, local_variables_info_, local_constants_info_,
+      method_token_, &metadata_import_);
+  EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
+  EXPECT_TRUE(stack_frame.IsProcessedIlFrame());
+  EXPECT_FALSE(stack_frame.IsVariablesPopulated());
+
+  // Only the slot of the local variable is retrieved and the result
+  // is cached.
+  EXPECT_CALL(frame_mock_, GetLocalVariable(second_local_var_.slot_, _))
+      .Times(1)
+      .WillOnce(DoAll(SetArgPointee<1>(&second_local_var_.cordebug_value_),
+                      Return(S_OK)));
+  std::shared_ptr<DbgObject> variable;
+  for (int i = 0; i < 2; ++i) {
+    hr = stack_frame.GetLocalVariable(second_local_var_.name_, &variable,
+                                      &std::cerr);
+    EXPECT_EQ(hr, S_OK);
+    EXPECT_TRUE(variable != nullptr);
+  }
+
+  EXPECT_CALL(frame_mock_, GetArgument(0, _))
+      .Times(1)
+      .WillOnce(DoAll(SetArgPointee<1>(&first_method_arg_.cordebug_value_),
+                      Return(S_OK)));
+  hr = stack_frame.GetLocalVariable(first_method_arg_.name_, &variable,
+                                    &std::cerr);
+  EXPECT_EQ(hr, S_OK);
+  EXPECT_TRUE(variable != nullptr);
+
+  hr = stack_frame.GetLocalVariable("NoSuchVariable", &variable, &std::cerr);
+  EXPECT_EQ(hr, S_FALSE);
+}
+
 // Tests the PopulateStackFrame function of DbgStackFrame.
 TEST_F(DbgStackFrameTest, TestPopulateStackFrame) {
   DbgStackFrame stack_frame(debug_helper_, dbg_object_factory_);
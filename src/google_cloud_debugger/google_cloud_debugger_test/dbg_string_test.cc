@@ -146,6 +146,77 @@ TEST_F(DbgStringTest, GetString) {
   EXPECT_EQ(returned_string, test_string_value);
 }
 
+// Tests that PopulateValue only captures the first characters of
+// a long string and says so in the status of the variable.
+TEST_F(DbgStringTest, PopulateValueTruncated) {
+  static const string test_string_value = "This is a test string";
+  static const std::uint32_t max_length = 4;
+
+  vector<WCHAR> wchar_string = ConvertStringToWCharPtr(test_string_value);
+
+  uint32_t string_size = wchar_string.size();
+  EXPECT_CALL(string_value_, GetLength(_))
+      .WillRepeatedly(DoAll(SetArgPointee<0>(string_size - 1), Return(S_OK)));
+
+  // Only a buffer for the captured characters is passed.
+  EXPECT_CALL(string_value_, GetString(max_length + 1, _, _))
+      .Times(1)
+      .WillRepeatedly(
+          DoAll(SetArrayArgument<2>(wchar_string.data(),
+                                    wchar_string.data() + max_length),
+                Return(S_OK)));
+
+  DbgString dbg_string(nullptr, debug_helper_);
+  SetUpString();
+  dbg_string.Initialize(&string_value_, FALSE);
+
+  DbgString::SetMaxCapturedLength(max_length);
+  Variable variable;
+  HRESULT hr = dbg_string.PopulateValue(&variable);
+  DbgString::SetMaxCapturedLength(DbgString::kDefaultMaxCapturedLength);
+
+  EXPECT_EQ(hr, S_OK);
+  EXPECT_EQ(variable.value(), "This");
+  EXPECT_FALSE(variable.status().iserror());
+  EXPECT_NE(variable.status().message().find(
+                std::to_string(test_string_value.size())),
+            string::npos);
+}
+
+// Tests that PopulateValue does not split a surrogate pair when it
+// truncates a string and reports the number of characters captured.
+TEST_F(DbgStringTest, PopulateValueTruncatedSurrogatePair) {
+  static const std::uint32_t max_length = 4;
+
+  // "abc", U+1F600 as a surrogate pair and "def".
+  vector<WCHAR> wchar_string = {0x0061, 0x0062, 0x0063, 0xD83D,
+                                0xDE00, 0x0064, 0x0065, 0x0066};
+  EXPECT_CALL(string_value_, GetLength(_))
+      .WillRepeatedly(
+          DoAll(SetArgPointee<0>(wchar_string.size()), Return(S_OK)));
+  EXPECT_CALL(string_value_, GetString(max_length + 1, _, _))
+      .Times(1)
+      .WillRepeatedly(
+          DoAll(SetArrayArgument<2>(wchar_string.data(),
+                                    wchar_string.data() + max_length),
+                Return(S_OK)));
+
+  DbgString dbg_string(nullptr, debug_helper_);
+  SetUpString();
+  dbg_string.Initialize(&string_value_, FALSE);
+
+  DbgString::SetMaxCapturedLength(max_length);
+  Variable variable;
+  HRESULT hr = dbg_string.PopulateValue(&variable);
+  DbgString::SetMaxCapturedLength(DbgString::kDefaultMaxCapturedLength);
+
+  EXPECT_EQ(hr, S_OK);
+  EXPECT_EQ(variable.value(), "abc");
+  EXPECT_FALSE(variable.status().iserror());
+  EXPECT_EQ(variable.status().message(),
+            "Only the first 3 of 8 characters of the string were captured.");
+}
+
 // Tests error cases for GetString.
 TEST_F(DbgStringTest, GetStringError) {
   static const string test_string_value = "This is a test string";
@@ -0,0 +1,247 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "document_index.h"
+#include "i_portable_pdb_mocks.h"
+
+using google_cloud_debugger_portable_pdb::DocumentIndex;
+using google_cloud_debugger_portable_pdb::DocumentRow;
+using google_cloud_debugger_portable_pdb::IDocumentIndex;
+using google_cloud_debugger_portable_pdb::LocalConstantRow;
+using google_cloud_debugger_portable_pdb::LocalScopeRow;
+using google_cloud_debugger_portable_pdb::LocalVariableRow;
+using google_cloud_debugger_portable_pdb::MethodDebugInformationRow;
+using google_cloud_debugger_portable_pdb::MethodInfo;
+using google_cloud_debugger_portable_pdb::MethodSequencePointInformation;
+using google_cloud_debugger_portable_pdb::Scope;
+using google_cloud_debugger_portable_pdb::SequencePointRecord;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+namespace google_cloud_debugger_test {
+
+// Test fixture for DocumentIndex tests. Sets up a synthetic Portable PDB
+// whose methods are spread across documents in a round-robin fashion.
+class DocumentIndexTest : public ::testing::Test {
+ protected:
+  // Populates the tables of the synthetic PDB with num_documents documents
+  // and num_methods methods. Every method has one sequence point and
+  // scopes_per_method local scopes, each owning one local variable.
+  void SetUpPdb(uint32_t num_documents, uint32_t num_methods,
+                uint32_t scopes_per_method) {
+    // Row 0 of every table is unused.
+    document_table_.assign(num_documents + 1, DocumentRow());
+    method_debug_info_table_.assign(num_methods + 1,
+                                    MethodDebugInformationRow());
+    local_scope_table_.assign(1, LocalScopeRow());
+    local_variable_table_.assign(1, LocalVariableRow());
+    local_constant_table_.assign(1, LocalConstantRow());
+
+    for (uint32_t method_def = 1; method_def <= num_methods; ++method_def) {
+      method_debug_info_table_[method_def].document =
+          1 + method_def % num_documents;
+      method_debug_info_table_[method_def].sequence_points = method_def;
+    }
+
+    // Local scopes are sorted by method in the PDB.
+    for (uint32_t method_def = 1; method_def <= num_methods; ++method_def) {
+      for (uint32_t i = 0; i < scopes_per_method; ++i) {
+        LocalScopeRow scope_row;
+        scope_row.method_def = method_def;
+        scope_row.variable_list = local_variable_table_.size();
+        scope_row.constant_list = 1;
+        scope_row.start_offset = i;
+        scope_row.length = 10;
+        local_scope_table_.push_back(scope_row);
+
+        LocalVariableRow variable_row;
+        variable_row.index = i;
+        variable_row.name = local_variable_table_.size();
+        local_variable_table_.push_back(variable_row);
+      }
+    }
+
+    pdb_calls_ = 0;
+    ON_CALL(pdb_, GetDocumentTable())
+        .WillByDefault(Invoke([this]() -> const vector<DocumentRow> & {
+          ++pdb_calls_;
+          return document_table_;
+        }));
+    ON_CALL(pdb_, GetMethodDebugInfoTable())
+        .WillByDefault(
+            Invoke([this]() -> const vector<MethodDebugInformationRow> & {
+              ++pdb_calls_;
+              return method_debug_info_table_;
+            }));
+    ON_CALL(pdb_, GetLocalScopeTable())
+        .WillByDefault(Invoke([this]() -> const vector<LocalScopeRow> & {
+          ++pdb_calls_;
+          return local_scope_table_;
+        }));
+    ON_CALL(pdb_, GetLocalVariableTable())
+        .WillByDefault(Invoke([this]() -> const vector<LocalVariableRow> & {
+          ++pdb_calls_;
+          return local_variable_table_;
+        }));
+    ON_CALL(pdb_, GetLocalConstantTable())
+        .WillByDefault(Invoke([this]() -> const vector<LocalConstantRow> & {
+          ++pdb_calls_;
+          return local_constant_table_;
+        }));
+    ON_CALL(pdb_, GetDocumentName(_, _))
+        .WillByDefault(Invoke([this](uint32_t index, string *doc_name) {
+          ++pdb_calls_;
+          *doc_name = "file" + std::to_string(index) + ".cs";
+          return true;
+        }));
+    ON_CALL(pdb_, GetHeapGuid(_, _))
+        .WillByDefault(Invoke([this](uint32_t index, string *guid) {
+          ++pdb_calls_;
+          return true;
+        }));
+    ON_CALL(pdb_, GetHash(_, _))
+        .WillByDefault(Invoke([this](uint32_t index, vector<uint8_t> *hash) {
+          ++pdb_calls_;
+          return true;
+        }));
+    ON_CALL(pdb_, GetHeapString(_, _))
+        .WillByDefault(Invoke([this](uint32_t index, string *result) {
+          ++pdb_calls_;
+          *result = "var" + std::to_string(index);
+          return true;
+        }));
+    ON_CALL(pdb_, GetMethodSeqInfo(_, _, _))
+        .WillByDefault(Invoke([this](uint32_t doc_index,
+                                     uint32_t sequence_index,
+                                     MethodSequencePointInformation *info) {
+          ++pdb_calls_;
+          SequencePointRecord record;
+          record.il_delta = 1;
+          record.start_line = sequence_index;
+          record.end_line = sequence_index + 1;
+          record.start_col = 1;
+          record.end_col = 2;
+          info->records.clear();
+          info->records.push_back(record);
+          return true;
+        }));
+  }
+
+  // Returns the number of calls to the synthetic PDB made to index
+  // every document of it.
+  int CountCreateDocumentIndicesCalls() {
+    vector<unique_ptr<IDocumentIndex>> document_indices;
+    pdb_calls_ = 0;
+    EXPECT_TRUE(DocumentIndex::CreateDocumentIndices(pdb_, &document_indices));
+    return pdb_calls_;
+  }
+
+  // Number of calls to pdb_ since the last reset.
+  int pdb_calls_ = 0;
+
+  // Mock of the synthetic Portable PDB.
+  NiceMock<IPortablePdbFileMock> pdb_;
+
+  // Tables of the synthetic PDB.
+  vector<DocumentRow> document_table_;
+  vector<MethodDebugInformationRow> method_debug_info_table_;
+  vector<LocalScopeRow> local_scope_table_;
+  vector<LocalVariableRow> local_variable_table_;
+  vector<LocalConstantRow> local_constant_table_;
+};
+
+// Tests that the document indices created with a single pass over the
+// tables are identical to indices initialized one document at a time.
+TEST_F(DocumentIndexTest, CreateDocumentIndicesMatchesInitialize) {
+  SetUpPdb(3, 20, 2);
+
+  vector<unique_ptr<IDocumentIndex>> document_indices;
+  ASSERT_TRUE(DocumentIndex::CreateDocumentIndices(pdb_, &document_indices));
+  ASSERT_EQ(document_indices.size(), 3);
+
+  for (int doc_index = 1; doc_index <= 3; ++doc_index) {
+    DocumentIndex expected;
+    ASSERT_TRUE(expected.Initialize(pdb_, doc_index));
+
+    const IDocumentIndex &actual = *document_indices[doc_index - 1];
+    EXPECT_EQ(actual.GetFilePath(), expected.GetFilePath());
+
+    const vector<MethodInfo> &actual_methods = actual.GetMethods();
+    const vector<MethodInfo> &expected_methods = expected.GetMethods();
+    ASSERT_EQ(actual_methods.size(), expected_methods.size());
+    for (size_t i = 0; i < actual_methods.size(); ++i) {
+      const MethodInfo &actual_method = actual_methods[i];
+      const MethodInfo &expected_method = expected_methods[i];
+      EXPECT_EQ(actual_method.method_def, expected_method.method_def);
+      EXPECT_EQ(actual_method.first_line, expected_method.first_line);
+      EXPECT_EQ(actual_method.last_line, expected_method.last_line);
+      EXPECT_EQ(actual_method.sequence_points.size(),
+                expected_method.sequence_points.size());
+
+      ASSERT_EQ(actual_method.local_scope.size(), 2);
+      ASSERT_EQ(expected_method.local_scope.size(), 2);
+      for (size_t j = 0; j < actual_method.local_scope.size(); ++j) {
+        const Scope &actual_scope = actual_method.local_scope[j];
+        const Scope &expected_scope = expected_method.local_scope[j];
+        EXPECT_EQ(actual_scope.index, expected_scope.index);
+        EXPECT_EQ(actual_scope.start_offset, expected_scope.start_offset);
+        ASSERT_EQ(actual_scope.local_variables.size(), 1);
+        ASSERT_EQ(expected_scope.local_variables.size(), 1);
+        EXPECT_EQ(actual_scope.local_variables[0].name,
+                  expected_scope.local_variables[0].name);
+      }
+    }
+  }
+}
+
+// Tests that methods pointing to a document outside of the document
+// table are ignored.
+TEST_F(DocumentIndexTest, CreateDocumentIndicesIgnoresUnknownDocument) {
+  SetUpPdb(2, 4, 1);
+  method_debug_info_table_[1].document = 10;
+
+  vector<unique_ptr<IDocumentIndex>> document_indices;
+  ASSERT_TRUE(DocumentIndex::CreateDocumentIndices(pdb_, &document_indices));
+  ASSERT_EQ(document_indices.size(), 2);
+  EXPECT_EQ(document_indices[0]->GetMethods().size() +
+                document_indices[1]->GetMethods().size(),
+            3);
+}
+
+// Tests that the number of lookups in the PDB made to index it grows
+// linearly with its size.
+TEST_F(DocumentIndexTest, CreateDocumentIndicesIsLinear) {
+  SetUpPdb(100, 2000, 2);
+  int small_calls = CountCreateDocumentIndicesCalls();
+
+  SetUpPdb(1000, 20000, 2);
+  int large_calls = CountCreateDocumentIndicesCalls();
+
+  EXPECT_GT(small_calls, 0);
+  EXPECT_LE(large_calls, small_calls * 10);
+}
+
+}  // namespace google_cloud_debugger_test
@@ -119,6 +119,8 @@ TEST_F(EvalCoordinatorTest, TestProcessBreakpoint) {
   // TODO(quoct): Add a test when breakpoints_ have members.
   EXPECT_CALL(breakpoint_collection_, WriteBreakpoint(_))
       .Times(0);
+  EXPECT_CALL(breakpoint_collection_, QueueBreakpoint(_))
+      .Times(0);
   HRESULT hr = eval_coordinator_.ProcessBreakpoints(
       &debug_thread_, &breakpoint_collection_, breakpoints_,
       pdb_files_);
@@ -129,4 +131,20 @@ TEST_F(EvalCoordinatorTest, TestProcessBreakpoint) {
   std::this_thread::sleep_for(minutes(1));
 }
 
+// Tests that breakpoint hits are processed one after the other by the
+// same capture worker.
+TEST_F(EvalCoordinatorTest, TestProcessBreakpointsCaptureWorker) {
+  EXPECT_CALL(breakpoint_collection_, QueueBreakpoint(_)).Times(0);
+  for (int i = 0; i < 3; ++i) {
+    // ProcessBreakpoints returns once the capture worker is done.
+    HRESULT hr = eval_coordinator_.ProcessBreakpoints(
+        &debug_thread_, &breakpoint_collection_, breakpoints_, pdb_files_);
+    EXPECT_EQ(hr, S_OK);
+  }
+
+  EvalCoordinator::CaptureStats stats = eval_coordinator_.GetCaptureStats();
+  EXPECT_EQ(stats.hits, 3);
+  EXPECT_GE(stats.total_latency, stats.max_latency);
+}
+
 }  // namespace google_cloud_debugger_test
@@ -300,6 +300,39 @@ TEST_F(FieldEvaluatorTest, StaticField) {
   EXPECT_EQ(evaluate_result.get(), static_field);
 }
 
+// Tests that compiling the evaluator again against a source of the
+// same type reuses the field found by the first compilation.
+TEST_F(FieldEvaluatorTest, CompileReusesBoundField) {
+  int num_compiles = 3;
+  EXPECT_CALL(*expression_mock_, Compile(_, _, _))
+      .Times(num_compiles)
+      .WillRepeatedly(Return(S_OK));
+  ON_CALL(*expression_mock_, GetStaticType())
+      .WillByDefault(ReturnRef(source_type_sig_));
+
+  // The class and the field are only looked up by the first compilation.
+  EXPECT_CALL(stack_mock_,
+              GetClassTokenAndModule(source_type_sig_.type_name, _, _, _))
+      .Times(1)
+      .WillOnce(DoAll(SetArgPointee<1>(source_class_token_),
+                      SetArgPointee<2>(&debug_module_), Return(S_OK)));
+  EXPECT_CALL(stack_mock_, GetFieldFromClass(source_class_token_, field_name_,
+                                             _, _, _, _, _, _))
+      .Times(1)
+      .WillOnce(DoAll(SetArgPointee<3>(false),
+                      SetArgPointee<4>(field_type_sig_), Return(S_OK)));
+
+  FieldEvaluator evaluator(std::move(expression_mock_), identifier_,
+                           possible_class_name_, field_name_, debug_helper_mock_);
+
+  for (int i = 0; i < num_compiles; ++i) {
+    EXPECT_EQ(evaluator.Compile(&stack_mock_, &debug_frame_, &err_stream_),
+              S_OK);
+    EXPECT_EQ(evaluator.GetStaticType().cor_type, field_type_sig_.cor_type);
+    EXPECT_EQ(evaluator.GetStaticType().type_name, field_type_sig_.type_name);
+  }
+}
+
 // Tests error cases for field/auto-implemented property.
 TEST_F(FieldEvaluatorTest, FieldError) {
   SetUpField(false);
@@ -44,6 +44,10 @@ class IBreakpointCollectionMock
   MOCK_METHOD1(
       WriteBreakpoint,
       HRESULT(const google::cloud::diagnostics::debug::Breakpoint &breakpoint));
+  MOCK_METHOD1(
+      QueueBreakpoint,
+      HRESULT(std::shared_ptr<google::cloud::diagnostics::debug::Breakpoint>
+                  breakpoint));
   MOCK_METHOD1(
       ReadBreakpoint,
       HRESULT(google::cloud::diagnostics::debug::Breakpoint *breakpoint));
@@ -55,6 +59,11 @@ class IBreakpointCollectionMock
               const std::vector<std::shared_ptr<
                   google_cloud_debugger_portable_pdb::IPortablePdbFile>>
                   &pdb_files));
+  MOCK_METHOD0(GetRateLimiter,
+               google_cloud_debugger::BreakpointRateLimiter *());
+  MOCK_METHOD2(DisableBreakpoint,
+               HRESULT(const google_cloud_debugger::DbgBreakpoint &breakpoint,
+                       const std::string &reason));
 };
 
 }  // namespace google_cloud_debugger_test
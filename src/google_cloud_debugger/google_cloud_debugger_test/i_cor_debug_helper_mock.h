@@ -67,6 +67,12 @@ class ICorDebugHelperMock : public google_cloud_debugger::ICorDebugHelper {
   MOCK_METHOD3(ExtractStringFromICorDebugStringValue,
                HRESULT(ICorDebugStringValue *debug_string,
                        std::string *returned_string, std::ostream *err_stream));
+  MOCK_METHOD6(ExtractStringPrefixFromICorDebugStringValue,
+               HRESULT(ICorDebugStringValue *debug_string,
+                       std::uint32_t max_length, std::string *returned_string,
+                       std::uint32_t *string_length,
+                       std::uint32_t *captured_length,
+                       std::ostream *err_stream));
   MOCK_METHOD4(ExtractParamName,
                HRESULT(IMetaDataImport *metadata_import, mdParamDef param_token,
                        std::string *param_name, std::ostream *err_stream));
@@ -33,6 +33,10 @@ class INamedPipeMock : public google_cloud_debugger::INamedPipe {
       HRESULT(std::string *message));
   MOCK_METHOD1(Write,
       HRESULT(const std::string &message));
+  MOCK_METHOD3(ReadBytes,
+      HRESULT(char *buffer, std::size_t buffer_size, std::size_t *bytes_read));
+  MOCK_METHOD1(WriteBuffers,
+      HRESULT(const std::vector<google_cloud_debugger::PipeBuffer> &buffers));
   MOCK_METHOD0(ShutDown,
       HRESULT());
 };
@@ -17,6 +17,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+using google_cloud_debugger_portable_pdb::SourceIndex;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::ReturnRef;
 using std::unique_ptr;
@@ -45,6 +47,14 @@ void PortablePDBFileFixture::SetUpIPortablePDBFile(
   ON_CALL(*file_mock, GetDocumentIndexTable())
       .WillByDefault(ReturnRef(document_indices_));
 
+  // The source index is built from the documents when it is requested.
+  ON_CALL(*file_mock, GetSourceIndex())
+      .WillByDefault(Invoke([this]() -> const SourceIndex & {
+        source_index_ = SourceIndex();
+        source_index_.AddDocuments(document_indices_);
+        return source_index_;
+      }));
+
   // Module name should be the same as file name.
   ON_CALL(*file_mock, GetModuleName()).WillByDefault(ReturnRef(module_name_));
 }
@@ -71,10 +71,29 @@ class IPortablePdbFileMock
       const std::vector<
           std::unique_ptr<google_cloud_debugger_portable_pdb::IDocumentIndex>>
           &());
+  MOCK_CONST_METHOD0(
+      GetSourceIndex,
+      const google_cloud_debugger_portable_pdb::SourceIndex &());
+  MOCK_CONST_METHOD3(
+      FindMethodByDef,
+      bool(std::uint32_t method_def,
+           const google_cloud_debugger_portable_pdb::IDocumentIndex
+               **document_index,
+           const google_cloud_debugger_portable_pdb::MethodInfo **method));
+  MOCK_CONST_METHOD3(
+      FindMethodByVirtualAddr,
+      bool(std::uint32_t virtual_addr,
+           const google_cloud_debugger_portable_pdb::IDocumentIndex
+               **document_index,
+           const google_cloud_debugger_portable_pdb::MethodInfo **method));
   MOCK_CONST_METHOD0(GetModuleName, const std::string &());
   MOCK_CONST_METHOD1(GetDebugModule, HRESULT(ICorDebugModule **debug_module));
   MOCK_CONST_METHOD1(GetMetaDataImport,
                      HRESULT(IMetaDataImport **metadata_import));
+  MOCK_METHOD0(GetMethodTokenCache,
+               google_cloud_debugger::MethodTokenCache *());
+  MOCK_METHOD0(GetTypeNameTable,
+               std::shared_ptr<google_cloud_debugger::TypeNameTable>());
   MOCK_CONST_METHOD2(GetBlobBytes,
                      bool(std::uint32_t index, std::vector<uint8_t> *result));
 };
@@ -88,6 +107,9 @@ class IDocumentIndexMock
       bool(const google_cloud_debugger_portable_pdb::IPortablePdbFile &pdb,
            int doc_index));
   MOCK_CONST_METHOD0(GetFilePath, std::string &());
+  MOCK_CONST_METHOD0(GetSourceLanguage, const std::string &());
+  MOCK_CONST_METHOD0(GetHashAlgorithm, const std::string &());
+  MOCK_CONST_METHOD0(GetHash, const std::vector<uint8_t> &());
   MOCK_CONST_METHOD0(
       GetMethods,
       const std::vector<google_cloud_debugger_portable_pdb::MethodInfo> &());
@@ -121,6 +143,11 @@ class PortablePDBFileFixture {
   std::vector<
       std::unique_ptr<google_cloud_debugger_portable_pdb::IDocumentIndex>>
       document_indices_;
+
+  // Source index that the file_mock_ returns. It is rebuilt from
+  // document_indices_ every time it is requested so tests can add
+  // methods after SetUpIPortablePDBFile is called.
+  google_cloud_debugger_portable_pdb::SourceIndex source_index_;
 };
 
 }  // namespace google_cloud_debugger_test
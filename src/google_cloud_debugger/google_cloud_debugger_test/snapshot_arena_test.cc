@@ -0,0 +1,194 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common_fixtures.h"
+#include "snapshot_arena.h"
+
+using google::cloud::diagnostics::debug::Breakpoint;
+using google::cloud::diagnostics::debug::StackFrame;
+using google::cloud::diagnostics::debug::Variable;
+using google_cloud_debugger::SnapshotArena;
+using std::shared_ptr;
+using std::string;
+using std::vector;
+
+namespace google_cloud_debugger_test {
+
+// Number of stack frames in the benchmark snapshot.
+const int kFrameCount = 10;
+
+// Number of top-level arguments and locals in each frame.
+const int kVariablesPerFrame = 5;
+
+// Number of members of each top-level variable.
+const int kMembersPerVariable = 9;
+
+// Fills variable with a name, a type and a value.
+void PopulateVariable(Variable *variable, int index) {
+  variable->set_name("variable_" + std::to_string(index));
+  variable->set_type(index % 2 == 0
+                         ? "System.Int32"
+                         : "System.Collections.Generic.List<System.String>");
+  variable->set_value(std::to_string(index * 31));
+}
+
+// Fills breakpoint like a representative snapshot of 500 variables:
+// 10 frames with 5 arguments and locals each, and 9 members per
+// argument or local.
+void PopulateSnapshot(Breakpoint *breakpoint) {
+  breakpoint->set_id("benchmark");
+  breakpoint->mutable_location()->set_path("Program.cs");
+  breakpoint->mutable_location()->set_line(42);
+  int index = 0;
+  for (int frame_index = 0; frame_index < kFrameCount; ++frame_index) {
+    StackFrame *frame = breakpoint->add_stack_frames();
+    frame->set_method_name("Method" + std::to_string(frame_index));
+    frame->mutable_location()->set_path("Program.cs");
+    frame->mutable_location()->set_line(frame_index);
+    for (int i = 0; i < kVariablesPerFrame; ++i) {
+      Variable *variable =
+          i < 2 ? frame->add_arguments() : frame->add_locals();
+      PopulateVariable(variable, index++);
+      for (int j = 0; j < kMembersPerVariable; ++j) {
+        PopulateVariable(variable->add_members(), index++);
+      }
+    }
+  }
+}
+
+// Returns the number of variables in breakpoint.
+int CountVariables(const Breakpoint &breakpoint) {
+  int count = 0;
+  for (const StackFrame &frame : breakpoint.stack_frames()) {
+    for (const Variable &variable : frame.arguments()) {
+      count += 1 + variable.members_size();
+    }
+    for (const Variable &variable : frame.locals()) {
+      count += 1 + variable.members_size();
+    }
+  }
+  return count;
+}
+
+// Returns the number of allocations made by building and freeing a
+// snapshot on the heap.
+std::size_t CountHeapAllocations() {
+  AllocationCounter counter;
+  {
+    std::unique_ptr<Breakpoint> breakpoint(new Breakpoint());
+    PopulateSnapshot(breakpoint.get());
+  }
+  return counter.GetCount();
+}
+
+// Returns the number of allocations made by building and freeing a
+// snapshot in arena.
+std::size_t CountArenaAllocations(SnapshotArena *arena) {
+  AllocationCounter counter;
+  {
+    shared_ptr<Breakpoint> breakpoint = arena->NewSnapshot();
+    PopulateSnapshot(breakpoint.get());
+  }
+  return counter.GetCount();
+}
+
+// Compares the allocations needed to capture a 500-variable snapshot on
+// the heap and in a reused SnapshotArena.
+TEST(SnapshotArenaTest, AllocationCount) {
+  Breakpoint breakpoint;
+  PopulateSnapshot(&breakpoint);
+  EXPECT_EQ(CountVariables(breakpoint), 500);
+
+  SnapshotArena arena;
+  // The first snapshot allocates the initial block of the arena.
+  CountArenaAllocations(&arena);
+
+  std::size_t heap_allocations = CountHeapAllocations();
+  std::size_t arena_allocations = CountArenaAllocations(&arena);
+
+  // Only the buffers of strings too long for the small string
+  // optimization still come from the heap.
+  EXPECT_LT(arena_allocations * 4, heap_allocations);
+}
+
+// Tests that the arena is reused once earlier snapshots are released.
+TEST(SnapshotArenaTest, ResetsReleasedSnapshots) {
+  SnapshotArena arena;
+  EXPECT_EQ(arena.SpaceAllocated(), 0);
+
+  shared_ptr<Breakpoint> first = arena.NewSnapshot();
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(first->GetArena(), nullptr);
+  PopulateSnapshot(first.get());
+  google::protobuf::Arena *first_arena = first->GetArena();
+  first.reset();
+
+  shared_ptr<Breakpoint> second = arena.NewSnapshot();
+  EXPECT_EQ(second->GetArena(), first_arena);
+  EXPECT_EQ(second->stack_frames_size(), 0);
+  EXPECT_EQ(arena.SpaceAllocated(),
+            SnapshotArena::kDefaultInitialBlockSize);
+}
+
+// Tests that a snapshot that is still referenced, for example by the
+// snapshot writer, is not reset by the next one.
+TEST(SnapshotArenaTest, KeepsPendingSnapshots) {
+  SnapshotArena arena;
+  shared_ptr<Breakpoint> pending = arena.NewSnapshot();
+  PopulateSnapshot(pending.get());
+
+  shared_ptr<Breakpoint> next = arena.NewSnapshot();
+  PopulateSnapshot(next.get());
+  EXPECT_NE(next->GetArena(), pending->GetArena());
+
+  // The arena of pending is freed with its last reference.
+  next.reset();
+  EXPECT_EQ(pending->id(), "benchmark");
+  EXPECT_EQ(CountVariables(*pending), 500);
+}
+
+// Tests that the arenas of snapshots that were written are reused while
+// other snapshots are still pending, without allocating initial blocks.
+TEST(SnapshotArenaTest, ReusesWrittenGenerations) {
+  SnapshotArena arena;
+  shared_ptr<Breakpoint> pending = arena.NewSnapshot();
+  shared_ptr<Breakpoint> written = arena.NewSnapshot();
+  google::protobuf::Arena *written_arena = written->GetArena();
+  written.reset();
+
+  for (int i = 0; i < 10; ++i) {
+    AllocationCounter counter;
+    shared_ptr<Breakpoint> next = arena.NewSnapshot();
+    EXPECT_EQ(counter.GetCount(), 0);
+    EXPECT_EQ(next->GetArena(), written_arena);
+    PopulateSnapshot(next.get());
+  }
+  EXPECT_EQ(pending->stack_frames_size(), 0);
+
+  // Once every kept arena is in use, snapshots get arenas of their own.
+  vector<shared_ptr<Breakpoint>> snapshots;
+  for (size_t i = 0; i < SnapshotArena::kMaxGenerations + 2; ++i) {
+    snapshots.push_back(arena.NewSnapshot());
+    ASSERT_NE(snapshots.back(), nullptr);
+    PopulateSnapshot(snapshots.back().get());
+  }
+  EXPECT_EQ(CountVariables(*snapshots.back()), 500);
+}
+
+}  // namespace google_cloud_debugger_test
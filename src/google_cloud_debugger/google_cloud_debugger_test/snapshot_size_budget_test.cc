@@ -0,0 +1,73 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "breakpoint.pb.h"
+#include "snapshot_size_budget.h"
+
+using google::cloud::diagnostics::debug::Breakpoint;
+using google::cloud::diagnostics::debug::StackFrame;
+using google::cloud::diagnostics::debug::Variable;
+using google_cloud_debugger::SnapshotSizeBudget;
+using std::string;
+
+namespace google_cloud_debugger_test {
+
+// Tests that GetFieldSize matches the size protobuf computes for
+// length-delimited fields around the varint length boundaries.
+TEST(SnapshotSizeBudgetTest, GetFieldSize) {
+  for (size_t length : {1, 127, 128, 16383, 16384}) {
+    Variable variable;
+    variable.set_value(string(length, 'a'));
+    EXPECT_EQ(SnapshotSizeBudget::GetFieldSize(length), variable.ByteSize())
+        << "Length " << length;
+  }
+}
+
+// Tests that accounting for the growth of the variables of a stack frame
+// one at a time gives the same size as measuring the stack frame.
+TEST(SnapshotSizeBudgetTest, TracksStackFrameSize) {
+  StackFrame stack_frame;
+  for (int i = 0; i < 10; ++i) {
+    stack_frame.add_locals()->set_name("local" + std::to_string(i));
+  }
+
+  SnapshotSizeBudget budget(1000, stack_frame.ByteSize());
+  for (int i = 0; i < 10; ++i) {
+    Variable *local = stack_frame.mutable_locals(i);
+    int old_size = local->ByteSize();
+    local->set_type("System.String");
+    local->set_value(string(i * 20, 'v'));
+    budget.UpdateField(old_size, local->ByteSize());
+    EXPECT_EQ(budget.GetUsedSize(), stack_frame.ByteSize());
+  }
+
+  EXPECT_TRUE(budget.IsExhausted());
+  EXPECT_EQ(budget.GetRemainingSize(), 1000 - stack_frame.ByteSize());
+
+  // Adding the stack frame to a breakpoint adds its field size.
+  Breakpoint breakpoint;
+  breakpoint.set_id("breakpoint");
+  SnapshotSizeBudget breakpoint_budget(65536, breakpoint.ByteSize());
+  *breakpoint.add_stack_frames() = stack_frame;
+  breakpoint_budget.Add(
+      SnapshotSizeBudget::GetFieldSize(stack_frame.ByteSize()));
+  EXPECT_EQ(breakpoint_budget.GetUsedSize(), breakpoint.ByteSize());
+  EXPECT_FALSE(breakpoint_budget.IsExhausted());
+}
+
+}  // namespace google_cloud_debugger_test
@@ -0,0 +1,214 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "snapshot_writer.h"
+
+using google::cloud::diagnostics::debug::Breakpoint;
+using google_cloud_debugger::SnapshotWriter;
+using std::shared_ptr;
+using std::string;
+using std::vector;
+using std::chrono::milliseconds;
+
+namespace google_cloud_debugger_test {
+
+// Returns a breakpoint with id id.
+shared_ptr<Breakpoint> MakeBreakpoint(const string &id) {
+  shared_ptr<Breakpoint> breakpoint = std::make_shared<Breakpoint>();
+  breakpoint->set_id(id);
+  return breakpoint;
+}
+
+// Tests that queued snapshots are written in order.
+TEST(SnapshotWriterTest, WritesInOrder) {
+  vector<string> written;
+  SnapshotWriter writer([&written](const Breakpoint &breakpoint) {
+    written.push_back(breakpoint.id());
+    return S_OK;
+  });
+
+  EXPECT_EQ(writer.Enqueue(MakeBreakpoint("first")), S_OK);
+  EXPECT_EQ(writer.Enqueue(MakeBreakpoint("second")), S_OK);
+  EXPECT_EQ(writer.Enqueue(MakeBreakpoint("third")), S_OK);
+  EXPECT_EQ(writer.Enqueue(nullptr), E_INVALIDARG);
+  writer.Flush();
+
+  EXPECT_EQ(written, vector<string>({"first", "second", "third"}));
+  SnapshotWriter::Stats stats = writer.GetStats();
+  EXPECT_EQ(stats.queued, 3);
+  EXPECT_EQ(stats.written, 3);
+  EXPECT_EQ(stats.failed, 0);
+  EXPECT_EQ(stats.dropped, 0);
+}
+
+// Tests that snapshots are dropped when the writer does not catch up
+// and that failed writes are counted.
+TEST(SnapshotWriterTest, DropsWhenFull) {
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool writing = false;
+  bool blocked = true;
+  SnapshotWriter writer(
+      [&](const Breakpoint &breakpoint) {
+        std::unique_lock<std::mutex> lock(mutex);
+        writing = true;
+        cv.notify_all();
+        cv.wait(lock, [&] { return !blocked; });
+        return breakpoint.id() == "fail" ? E_FAIL : S_OK;
+      },
+      1, milliseconds(10));
+
+  // The writer thread blocks on the first snapshot, the second one
+  // fills the queue and the third one is dropped.
+  EXPECT_EQ(writer.Enqueue(MakeBreakpoint("fail")), S_OK);
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&] { return writing; });
+  }
+  EXPECT_EQ(writer.Enqueue(MakeBreakpoint("second")), S_OK);
+  EXPECT_EQ(writer.Enqueue(MakeBreakpoint("dropped")), S_FALSE);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    blocked = false;
+  }
+  cv.notify_all();
+  writer.Stop();
+
+  SnapshotWriter::Stats stats = writer.GetStats();
+  EXPECT_EQ(stats.written, 1);
+  EXPECT_EQ(stats.failed, 1);
+  EXPECT_EQ(stats.dropped, 1);
+  EXPECT_GT(stats.wait_time.count(), 0);
+  EXPECT_EQ(writer.Enqueue(MakeBreakpoint("late")), E_FAIL);
+}
+
+// Returns a log entry of logpoint id with message message.
+shared_ptr<Breakpoint> MakeLogEntry(const string &id, const string &message) {
+  shared_ptr<Breakpoint> log_entry = MakeBreakpoint(id);
+  log_entry->set_log_point(true);
+  log_entry->add_log_messages(message);
+  return log_entry;
+}
+
+// Tests that pending log entries of the same logpoint are merged into
+// a single write.
+TEST(SnapshotWriterTest, MergesLogMessages) {
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool writing = false;
+  bool blocked = true;
+  vector<Breakpoint> written;
+  SnapshotWriter writer([&](const Breakpoint &breakpoint) {
+    std::unique_lock<std::mutex> lock(mutex);
+    writing = true;
+    cv.notify_all();
+    cv.wait(lock, [&] { return !blocked; });
+    written.push_back(breakpoint);
+    return S_OK;
+  });
+
+  // The writer thread blocks on the first entry while the others queue
+  // up behind it.
+  EXPECT_EQ(writer.Enqueue(MakeBreakpoint("snapshot")), S_OK);
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&] { return writing; });
+  }
+  EXPECT_EQ(writer.Enqueue(MakeLogEntry("log", "a")), S_OK);
+  EXPECT_EQ(writer.Enqueue(MakeLogEntry("other", "x")), S_OK);
+  EXPECT_EQ(writer.Enqueue(MakeLogEntry("log", "b")), S_OK);
+  EXPECT_EQ(writer.Enqueue(MakeLogEntry("log", "c")), S_OK);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    blocked = false;
+  }
+  cv.notify_all();
+  writer.Flush();
+
+  ASSERT_EQ(written.size(), 3);
+  EXPECT_EQ(written[0].id(), "snapshot");
+  EXPECT_EQ(written[1].id(), "log");
+  ASSERT_EQ(written[1].log_messages_size(), 3);
+  EXPECT_EQ(written[1].log_messages(0), "a");
+  EXPECT_EQ(written[1].log_messages(1), "b");
+  EXPECT_EQ(written[1].log_messages(2), "c");
+  EXPECT_EQ(written[2].id(), "other");
+  EXPECT_EQ(written[2].log_messages_size(), 1);
+
+  SnapshotWriter::Stats stats = writer.GetStats();
+  EXPECT_EQ(stats.queued, 5);
+  EXPECT_EQ(stats.written, 3);
+  EXPECT_EQ(stats.merged, 2);
+}
+
+// Tests that log entries queued after a final status of the logpoint
+// are not merged ahead of the status.
+TEST(SnapshotWriterTest, DoesNotMergeLogMessagesPastStatus) {
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool writing = false;
+  bool blocked = true;
+  vector<Breakpoint> written;
+  SnapshotWriter writer([&](const Breakpoint &breakpoint) {
+    std::unique_lock<std::mutex> lock(mutex);
+    writing = true;
+    cv.notify_all();
+    cv.wait(lock, [&] { return !blocked; });
+    written.push_back(breakpoint);
+    return S_OK;
+  });
+
+  EXPECT_EQ(writer.Enqueue(MakeBreakpoint("snapshot")), S_OK);
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&] { return writing; });
+  }
+  shared_ptr<Breakpoint> status = MakeBreakpoint("log");
+  status->set_log_point(true);
+  status->mutable_status()->set_iserror(true);
+  status->mutable_status()->set_message("Logpoint expired.");
+  EXPECT_EQ(writer.Enqueue(MakeLogEntry("log", "a")), S_OK);
+  EXPECT_EQ(writer.Enqueue(status), S_OK);
+  EXPECT_EQ(writer.Enqueue(MakeLogEntry("log", "b")), S_OK);
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    blocked = false;
+  }
+  cv.notify_all();
+  writer.Flush();
+
+  ASSERT_EQ(written.size(), 4);
+  EXPECT_EQ(written[0].id(), "snapshot");
+  ASSERT_EQ(written[1].log_messages_size(), 1);
+  EXPECT_EQ(written[1].log_messages(0), "a");
+  EXPECT_FALSE(written[1].has_status());
+  EXPECT_TRUE(written[2].has_status());
+  EXPECT_EQ(written[2].log_messages_size(), 0);
+  ASSERT_EQ(written[3].log_messages_size(), 1);
+  EXPECT_EQ(written[3].log_messages(0), "b");
+  EXPECT_EQ(writer.GetStats().merged, 0);
+}
+
+}  // namespace google_cloud_debugger_test
@@ -0,0 +1,175 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "document_index.h"
+#include "source_index.h"
+
+using google_cloud_debugger_portable_pdb::DocumentIndex;
+using google_cloud_debugger_portable_pdb::IDocumentIndex;
+using google_cloud_debugger_portable_pdb::MethodInfo;
+using google_cloud_debugger_portable_pdb::SequencePoint;
+using google_cloud_debugger_portable_pdb::SourceIndex;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace google_cloud_debugger_test {
+
+// Test fixture for SourceIndex tests.
+class SourceIndexTest : public ::testing::Test {
+ protected:
+  // Returns a method that spans first_line to last_line with a
+  // sequence point on every line_step-th line. The IL offset of
+  // a sequence point is its line times 10.
+  static MethodInfo MakeMethod(uint32_t method_def, uint32_t first_line,
+                               uint32_t last_line, uint32_t line_step = 1) {
+    MethodInfo method;
+    method.method_def = method_def;
+    method.first_line = first_line;
+    method.last_line = last_line;
+    for (uint32_t line = first_line; line <= last_line; line += line_step) {
+      SequencePoint sequence_point;
+      sequence_point.start_line = line;
+      sequence_point.end_line = line;
+      sequence_point.il_offset = line * 10;
+      method.sequence_points.push_back(sequence_point);
+    }
+    return method;
+  }
+
+  // Adds a document with path path and methods methods.
+  void AddDocument(const string &path, vector<MethodInfo> methods) {
+    unique_ptr<DocumentIndex> document(new DocumentIndex());
+    document->InitializeFromParsedContent(path, "C#", "SHA1",
+                                          vector<uint8_t>(),
+                                          std::move(methods));
+    document_indices_.push_back(std::move(document));
+  }
+
+  // Document indices the source index is built from.
+  vector<unique_ptr<IDocumentIndex>> document_indices_;
+};
+
+// Tests that documents are matched by the end of their normalized path
+// and that the longest matching path wins.
+TEST_F(SourceIndexTest, MatchesPathSuffix) {
+  AddDocument("C:\\src\\App\\Program.cs", {MakeMethod(1, 1, 20)});
+  AddDocument("/build/lib/app/program.cs", {MakeMethod(2, 1, 20)});
+  AddDocument("/build/other.cs", {MakeMethod(3, 1, 20)});
+
+  SourceIndex index;
+  index.AddDocuments(document_indices_);
+  EXPECT_EQ(index.GetDocumentCount(), 3);
+
+  SourceIndex::Location location;
+  ASSERT_TRUE(index.FindLocation("app/program.cs", 5, &location));
+  EXPECT_EQ(location.document_index, document_indices_[1].get());
+  EXPECT_EQ(location.method->method_def, 2);
+
+  ASSERT_TRUE(index.FindLocation("src/APP/program.cs", 5, &location));
+  EXPECT_EQ(location.document_index, document_indices_[0].get());
+
+  ASSERT_TRUE(index.FindLocation("other.cs", 5, &location));
+  EXPECT_EQ(location.method->method_def, 3);
+
+  EXPECT_FALSE(index.FindLocation("missing.cs", 5, &location));
+  EXPECT_FALSE(index.FindLocation("x/app/program.cs", 5, &location));
+}
+
+// Tests that a document with a longer path but without code at the
+// line falls back to a shorter matching path.
+TEST_F(SourceIndexTest, FallsBackToShorterPath) {
+  AddDocument("/a/long/path/file.cs", {MakeMethod(1, 1, 10)});
+  AddDocument("/path/file.cs", {MakeMethod(2, 1, 100)});
+
+  SourceIndex index;
+  index.AddDocuments(document_indices_);
+
+  SourceIndex::Location location;
+  ASSERT_TRUE(index.FindLocation("file.cs", 50, &location));
+  EXPECT_EQ(location.method->method_def, 2);
+  ASSERT_TRUE(index.FindLocation("file.cs", 5, &location));
+  EXPECT_EQ(location.method->method_def, 1);
+}
+
+// Tests that the innermost method that contains the line is picked and
+// that the closest non-hidden sequence point at or after the line is used.
+TEST_F(SourceIndexTest, PicksInnermostMethodAndClosestLine) {
+  MethodInfo outer = MakeMethod(1, 10, 50, 5);
+  MethodInfo lambda = MakeMethod(2, 20, 28, 2);
+  lambda.last_line = 30;
+  MethodInfo after = MakeMethod(3, 60, 70);
+
+  // Sequence points are in IL order, which does not have to be line order.
+  std::swap(lambda.sequence_points[0], lambda.sequence_points[3]);
+  lambda.sequence_points[1].is_hidden = true;
+  AddDocument("file.cs", {outer, after, lambda});
+
+  SourceIndex index;
+  index.AddDocuments(document_indices_);
+
+  SourceIndex::Location location;
+  ASSERT_TRUE(index.FindLocation("file.cs", 21, &location));
+  EXPECT_EQ(location.method->method_def, 2);
+  // Line 22 is hidden so the breakpoint moves to line 24.
+  EXPECT_EQ(location.sequence_point->start_line, 24);
+  EXPECT_EQ(location.sequence_point->il_offset, 240);
+
+  ASSERT_TRUE(index.FindLocation("file.cs", 12, &location));
+  EXPECT_EQ(location.method->method_def, 1);
+  EXPECT_EQ(location.sequence_point->start_line, 15);
+
+  ASSERT_TRUE(index.FindLocation("file.cs", 40, &location));
+  EXPECT_EQ(location.method->method_def, 1);
+
+  // A lambda without code after the line defers to the outer method.
+  ASSERT_TRUE(index.FindLocation("file.cs", 29, &location));
+  EXPECT_EQ(location.method->method_def, 1);
+  EXPECT_EQ(location.sequence_point->start_line, 30);
+
+  EXPECT_FALSE(index.FindLocation("file.cs", 55, &location));
+  EXPECT_FALSE(index.FindLocation("file.cs", 5, &location));
+}
+
+// Tests that 500 breakpoints set in a synthetic process with
+// 2000 documents of 50 methods each resolve to the right methods.
+TEST_F(SourceIndexTest, BreakpointStorm) {
+  for (uint32_t i = 0; i < 2000; ++i) {
+    vector<MethodInfo> methods;
+    for (uint32_t j = 0; j < 50; ++j) {
+      methods.push_back(MakeMethod(i * 50 + j, j * 20 + 1, j * 20 + 15));
+    }
+    AddDocument("/src/project" + std::to_string(i % 10) + "/dir" +
+                    std::to_string(i) + "/file" + std::to_string(i) + ".cs",
+                std::move(methods));
+  }
+
+  SourceIndex index;
+  index.AddDocuments(document_indices_);
+
+  for (uint32_t i = 0; i < 500; ++i) {
+    uint32_t document = i * 4;
+    SourceIndex::Location location;
+    ASSERT_TRUE(index.FindLocation("file" + std::to_string(document) + ".cs",
+                                   (i % 50) * 20 + 5, &location));
+    EXPECT_EQ(location.method->method_def, document * 50 + i % 50);
+  }
+}
+
+}  // namespace google_cloud_debugger_test
@@ -43,6 +43,7 @@ using google_cloud_debugger::DbgPrimitive;
 using google_cloud_debugger::ICorDebugHelper;
 using google_cloud_debugger::IDbgObjectFactory;
 using google_cloud_debugger::StackFrameCollection;
+using google_cloud_debugger_portable_pdb::IDocumentIndex;
 using google_cloud_debugger_portable_pdb::LocalVariableInfo;
 using google_cloud_debugger_portable_pdb::MethodInfo;
 using google_cloud_debugger_portable_pdb::Scope;
@@ -305,22 +306,10 @@ class StackFrameCollectionTest : public ::testing::Test {
     pdb_file_fixture_.module_name_ = module_name_;
     pdb_file_fixture_.SetUpIPortablePDBFile(pdb_file.get());
 
-    pdb_files_.push_back(std::move(pdb_file));
-
     MethodInfo method;
     // Method def can just be some random number, not important here.
     method.method_def = 4000;
 
-    // Makes this method the same as the first frame's method by giving
-    // them the same function name and virtual address.
-    EXPECT_CALL(metadata_import_, GetMethodProps(method.method_def, _, nullptr,
-                                                 0, _, _, _, _, _, _))
-        .WillRepeatedly(
-            DoAll(SetArgPointee<1>(method.method_def),
-                  SetArgPointee<4>(first_frame_.wchar_function_name_.size()),
-                  SetArgPointee<8>(first_frame_.frame_func_virtual_addr_),
-                  Return(S_OK)));
-
     // Gives the method a sequence point that matches the IP Offset of the
     // first frame.
     SequencePoint seq_point;
@@ -330,6 +319,19 @@ class StackFrameCollectionTest : public ::testing::Test {
     method.sequence_points.push_back(seq_point);
     pdb_file_fixture_.first_doc_.methods_.push_back(method);
 
+    // Makes this method the same as the first frame's method by giving
+    // them the same virtual address.
+    const IDocumentIndex *first_doc_index =
+        pdb_file_fixture_.document_indices_[0].get();
+    ON_CALL(*pdb_file, FindMethodByVirtualAddr(
+                           first_frame_.frame_func_virtual_addr_, _, _))
+        .WillByDefault(
+            DoAll(SetArgPointee<1>(first_doc_index),
+                  SetArgPointee<2>(&pdb_file_fixture_.first_doc_.methods_[0]),
+                  Return(true)));
+
+    pdb_files_.push_back(std::move(pdb_file));
+
     // Sets up the name of the file for the first doc.
     first_frame_.file_name_ = "First file";
     pdb_file_fixture_.first_doc_.file_name_ = first_frame_.file_name_;
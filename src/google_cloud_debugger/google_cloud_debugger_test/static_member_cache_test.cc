@@ -0,0 +1,74 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+#include "dbg_class_property.h"
+#include "static_member_cache.h"
+
+using google_cloud_debugger::DbgClassProperty;
+using google_cloud_debugger::IDbgClassMember;
+using google_cloud_debugger::StaticMemberCache;
+using std::shared_ptr;
+
+namespace google_cloud_debugger_test {
+
+// Returns a class member that is not backed by the debuggee.
+shared_ptr<IDbgClassMember> CreateMember() {
+  return shared_ptr<IDbgClassMember>(new DbgClassProperty(nullptr, nullptr));
+}
+
+// Tests that members are shared by the objects of a class and that the
+// first member added under a name wins.
+TEST(StaticMemberCacheTest, SharesMembersOfClass) {
+  StaticMemberCache cache;
+  shared_ptr<StaticMemberCache::ClassMembers> members =
+      cache.GetClassMembers("App.dll", "App.Program");
+  ASSERT_TRUE(members != nullptr);
+  EXPECT_EQ(members->Find("Count"), nullptr);
+
+  shared_ptr<IDbgClassMember> count = CreateMember();
+  EXPECT_EQ(members->Add("Count", count), count);
+  EXPECT_EQ(members->Add("Count", CreateMember()), count);
+
+  EXPECT_EQ(cache.GetClassMembers("App.dll", "App.Program")->Find("Count"),
+            count);
+  EXPECT_EQ(cache.GetClassMembers("Other.dll", "App.Program")->Find("Count"),
+            nullptr);
+  EXPECT_EQ(cache.Size(), 2);
+}
+
+// Tests that members expire as soon as the debuggee resumes.
+TEST(StaticMemberCacheTest, ExpiresAfterResume) {
+  StaticMemberCache cache;
+  shared_ptr<IDbgClassMember> count = CreateMember();
+  shared_ptr<StaticMemberCache::ClassMembers> members =
+      cache.GetClassMembers("App.dll", "App.Program");
+  members->Add("Count", count);
+  EXPECT_EQ(cache.GetClassMembers("App.dll", "App.Program"), members);
+
+  cache.AdvanceGeneration();
+  EXPECT_EQ(cache.Size(), 0);
+  EXPECT_EQ(cache.GetGeneration(), 1);
+
+  shared_ptr<StaticMemberCache::ClassMembers> new_members =
+      cache.GetClassMembers("App.dll", "App.Program");
+  EXPECT_NE(new_members, members);
+  EXPECT_EQ(new_members->Find("Count"), nullptr);
+}
+
+}  // namespace google_cloud_debugger_test
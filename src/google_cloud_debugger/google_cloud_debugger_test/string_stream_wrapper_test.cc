@@ -0,0 +1,217 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "breakpoint.pb.h"
+#include "common_fixtures.h"
+#include "dbg_object.h"
+#include "dbg_primitive.h"
+#include "snapshot_size_budget.h"
+#include "string_stream_wrapper.h"
+#include "variable_wrapper.h"
+
+using google::cloud::diagnostics::debug::Variable;
+using google_cloud_debugger::DbgObject;
+using google_cloud_debugger::DbgPrimitive;
+using google_cloud_debugger::ICorDebugHelper;
+using google_cloud_debugger::IEvalCoordinator;
+using google_cloud_debugger::SnapshotSizeBudget;
+using google_cloud_debugger::StringStreamWrapper;
+using google_cloud_debugger::VariableWrapper;
+using std::shared_ptr;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+
+namespace google_cloud_debugger_test {
+
+// Number of values in the captured object graph.
+const int kNodeCount = 1000;
+
+// Stands in for a captured value of an object graph.
+class CapturedNode : public StringStreamWrapper {};
+
+// Reports an error to err_stream if hr is a failure, the way the
+// helpers that the captured values pass their error stream to do.
+void ReportIfFailed(HRESULT hr, std::ostream *err_stream) {
+  if (FAILED(hr)) {
+    *err_stream << "Failed with " << hr;
+  }
+}
+
+// The error stream that StringStreamWrapper used to have: every
+// captured value allocated an ostringstream when it was constructed.
+class LegacyStringStreamWrapper {
+ public:
+  // Gets the underlying error stream.
+  std::ostringstream *GetErrorStream() { return error_stream_.get(); }
+
+ private:
+  // The underlying error stream.
+  unique_ptr<std::ostringstream> error_stream_ =
+      unique_ptr<std::ostringstream>(new (std::nothrow) std::ostringstream());
+};
+
+// Captured int that also carries the error stream of
+// LegacyStringStreamWrapper, like every DbgObject used to.
+class LegacyPrimitive : public DbgPrimitive<std::int32_t> {
+ public:
+  LegacyPrimitive(std::int32_t value) : DbgPrimitive<std::int32_t>(value) {}
+
+  // Reports no error to the legacy error stream.
+  HRESULT PopulateValue(Variable *variable) override {
+    ReportIfFailed(S_OK, legacy_wrapper_.GetErrorStream());
+    return DbgPrimitive<std::int32_t>::PopulateValue(variable);
+  }
+
+ private:
+  // The error stream of the old wrapper.
+  LegacyStringStreamWrapper legacy_wrapper_;
+};
+
+// Captured object whose members are the other values of the graph.
+class GraphRoot : public DbgObject {
+ public:
+  GraphRoot() : DbgObject(nullptr, 0, shared_ptr<ICorDebugHelper>()) {}
+
+  void Initialize(ICorDebugValue *debug_value, BOOL is_null) override {}
+
+  HRESULT GetTypeString(string *type_string) override {
+    *type_string = "Graph";
+    return S_OK;
+  }
+
+  HRESULT GetICorDebugValue(ICorDebugValue **debug_value,
+                            ICorDebugEval *debug_eval) override {
+    return E_NOTIMPL;
+  }
+
+  // Adds the protos of the members to variable_proto.
+  HRESULT PopulateMembers(Variable *variable_proto,
+                          vector<VariableWrapper> *members,
+                          IEvalCoordinator *eval_coordinator) override {
+    for (size_t i = 0; i < members_.size(); ++i) {
+      Variable *member_proto = variable_proto->add_members();
+      member_proto->set_name("member_" + std::to_string(i));
+      ReportIfFailed(S_OK, members_[i]->GetErrorStream());
+      members->push_back(VariableWrapper(member_proto, members_[i]));
+    }
+    return S_OK;
+  }
+
+  // Members of the object.
+  vector<shared_ptr<DbgObject>> members_;
+};
+
+// Returns the number of allocations made by building a graph of
+// kNodeCount captured values, the root and its members of type Member,
+// and populating the proto of the root with VariableWrapper::PerformBFS.
+template <typename Member>
+std::size_t CountGraphAllocations(IEvalCoordinator *eval_coordinator) {
+  AllocationCounter counter;
+  {
+    shared_ptr<GraphRoot> root(new GraphRoot());
+    root->members_.reserve(kNodeCount - 1);
+    for (int i = 1; i < kNodeCount; ++i) {
+      root->members_.push_back(shared_ptr<DbgObject>(new Member(i)));
+    }
+
+    Variable variable;
+    std::queue<VariableWrapper> bfs_queue;
+    bfs_queue.push(VariableWrapper(&variable, root));
+    SnapshotSizeBudget budget(std::numeric_limits<std::int64_t>::max());
+    EXPECT_EQ(
+        VariableWrapper::PerformBFS(&bfs_queue, &budget, eval_coordinator),
+        S_OK);
+    EXPECT_EQ(variable.members_size(), kNodeCount - 1);
+    EXPECT_EQ(variable.members(kNodeCount - 2).value(),
+              std::to_string(kNodeCount - 1));
+
+    for (const auto &member : root->members_) {
+      EXPECT_FALSE(member->HasError());
+    }
+  }
+  return counter.GetCount();
+}
+
+// Compares the allocations of capturing a 1,000 node object graph that
+// reports no errors with the error stream of StringStreamWrapper and
+// with the ostringstream that every captured value used to allocate.
+TEST(StringStreamWrapperTest, ErrorStreamsOfObjectGraph) {
+  IEvalCoordinatorMock eval_coordinator;
+  // The first capture also makes the one-time allocations of protobuf.
+  CountGraphAllocations<DbgPrimitive<std::int32_t>>(&eval_coordinator);
+
+  std::size_t wrapper_allocations =
+      CountGraphAllocations<DbgPrimitive<std::int32_t>>(&eval_coordinator);
+  std::size_t legacy_allocations =
+      CountGraphAllocations<LegacyPrimitive>(&eval_coordinator);
+
+  // Every value of the old graph allocated its own error stream.
+  EXPECT_GE(legacy_allocations, wrapper_allocations + kNodeCount - 1);
+}
+
+// Tests that errors written to the error stream are reported and reset.
+TEST(StringStreamWrapperTest, WriteError) {
+  CapturedNode node;
+  EXPECT_FALSE(node.HasError());
+  EXPECT_EQ(node.GetErrorString(), "");
+
+  node.WriteError("Failed to get field.");
+  ReportIfFailed(E_FAIL, node.GetErrorStream());
+  EXPECT_TRUE(node.HasError());
+  std::ostringstream expected;
+  expected << "Failed to get field." << std::endl << "Failed with " << E_FAIL;
+  EXPECT_EQ(node.GetErrorString(), expected.str());
+
+  Variable variable;
+  google_cloud_debugger::SetErrorStatusMessage(&variable, &node);
+  EXPECT_TRUE(variable.status().iserror());
+  EXPECT_EQ(variable.status().message(), expected.str());
+  EXPECT_FALSE(node.HasError());
+
+  // The stream can still be written to after it is reset.
+  node.WriteError("Again");
+  EXPECT_EQ(node.GetErrorString(), "Again\n");
+}
+
+// Tests that UTF-16 characters are converted to UTF-8.
+TEST(StringStreamWrapperTest, AppendWCharToUtf8) {
+  // "a", U+00E9, U+20AC, U+1F600 as a surrogate pair and a lone surrogate.
+  const WCHAR wchar_string[] = {0x0061, 0x00E9, 0x20AC, 0xD83D,
+                                0xDE00, 0xD800, 0x0062};
+  string result = "prefix ";
+  google_cloud_debugger::AppendWCharToUtf8(wchar_string, 7, &result);
+  EXPECT_EQ(result,
+            "prefix a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\xEF\xBF\xBD"
+            "b");
+
+  // Only the given number of characters is converted.
+  result.clear();
+  google_cloud_debugger::AppendWCharToUtf8(wchar_string, 2, &result);
+  EXPECT_EQ(result, "a\xC3\xA9");
+}
+
+}  // namespace google_cloud_debugger_test
@@ -0,0 +1,350 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "document_index.h"
+#include "i_portable_pdb_mocks.h"
+#include "symbol_cache.h"
+
+using google_cloud_debugger_portable_pdb::DocumentIndex;
+using google_cloud_debugger_portable_pdb::DocumentRow;
+using google_cloud_debugger_portable_pdb::IDocumentIndex;
+using google_cloud_debugger_portable_pdb::LocalConstantRow;
+using google_cloud_debugger_portable_pdb::LocalScopeRow;
+using google_cloud_debugger_portable_pdb::LocalVariableRow;
+using google_cloud_debugger_portable_pdb::MethodDebugInformationRow;
+using google_cloud_debugger_portable_pdb::MethodInfo;
+using google_cloud_debugger_portable_pdb::MethodSequencePointInformation;
+using google_cloud_debugger_portable_pdb::PdbId;
+using google_cloud_debugger_portable_pdb::Scope;
+using google_cloud_debugger_portable_pdb::SequencePointRecord;
+using google_cloud_debugger_portable_pdb::SymbolCache;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+using std::chrono::duration;
+using std::chrono::steady_clock;
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+namespace google_cloud_debugger_test {
+
+// Size of the synthetic PDB file the cache entries are keyed by.
+const uint32_t kPdbFileSize = 12345;
+
+// Test fixture for SymbolCache tests. Sets up a synthetic Portable PDB
+// and a symbol cache in the working directory.
+class SymbolCacheTest : public ::testing::Test {
+ protected:
+  SymbolCacheTest() : symbol_cache_(".") {
+    for (size_t i = 0; i < pdb_id_.size(); ++i) {
+      pdb_id_[i] = static_cast<uint8_t>(i * 7);
+    }
+  }
+
+  ~SymbolCacheTest() override {
+    std::remove(symbol_cache_.GetCacheFilePath(pdb_id_).c_str());
+  }
+
+  // Populates the tables of the synthetic PDB with num_documents documents
+  // and num_methods methods and indexes its documents. Every method has
+  // one sequence point and one local scope with a local variable and
+  // a local constant.
+  void SetUpPdb(uint32_t num_documents, uint32_t num_methods) {
+    // Row 0 of every table is unused.
+    document_table_.assign(num_documents + 1, DocumentRow());
+    method_debug_info_table_.assign(num_methods + 1,
+                                    MethodDebugInformationRow());
+    local_scope_table_.assign(1, LocalScopeRow());
+    local_variable_table_.assign(1, LocalVariableRow());
+    local_constant_table_.assign(1, LocalConstantRow());
+
+    for (uint32_t method_def = 1; method_def <= num_methods; ++method_def) {
+      method_debug_info_table_[method_def].document =
+          1 + method_def % num_documents;
+      method_debug_info_table_[method_def].sequence_points = method_def;
+
+      LocalScopeRow scope_row;
+      scope_row.method_def = method_def;
+      scope_row.variable_list = local_variable_table_.size();
+      scope_row.constant_list = local_constant_table_.size();
+      scope_row.length = 10;
+      local_scope_table_.push_back(scope_row);
+
+      LocalVariableRow variable_row;
+      variable_row.index = method_def % 5;
+      variable_row.name = local_variable_table_.size();
+      local_variable_table_.push_back(variable_row);
+
+      LocalConstantRow constant_row;
+      constant_row.name = local_constant_table_.size();
+      constant_row.signature = local_constant_table_.size();
+      local_constant_table_.push_back(constant_row);
+    }
+
+    ON_CALL(pdb_, GetDocumentTable()).WillByDefault(ReturnRef(document_table_));
+    ON_CALL(pdb_, GetMethodDebugInfoTable())
+        .WillByDefault(ReturnRef(method_debug_info_table_));
+    ON_CALL(pdb_, GetLocalScopeTable())
+        .WillByDefault(ReturnRef(local_scope_table_));
+    ON_CALL(pdb_, GetLocalVariableTable())
+        .WillByDefault(ReturnRef(local_variable_table_));
+    ON_CALL(pdb_, GetLocalConstantTable())
+        .WillByDefault(ReturnRef(local_constant_table_));
+    ON_CALL(pdb_, GetDocumentIndexTable())
+        .WillByDefault(ReturnRef(document_indices_));
+    ON_CALL(pdb_, GetDocumentName(_, _))
+        .WillByDefault(Invoke([](uint32_t index, string *doc_name) {
+          *doc_name = "file" + std::to_string(index) + ".cs";
+          return true;
+        }));
+    ON_CALL(pdb_, GetHeapGuid(_, _))
+        .WillByDefault(Invoke([](uint32_t index, string *guid) {
+          *guid = "guid" + std::to_string(index);
+          return true;
+        }));
+    ON_CALL(pdb_, GetHash(_, _))
+        .WillByDefault(Invoke([](uint32_t index, vector<uint8_t> *hash) {
+          hash->assign(20, static_cast<uint8_t>(index));
+          return true;
+        }));
+    ON_CALL(pdb_, GetHeapString(_, _))
+        .WillByDefault(Invoke([](uint32_t index, string *result) {
+          *result = "name" + std::to_string(index);
+          return true;
+        }));
+    ON_CALL(pdb_, GetBlobBytes(_, _))
+        .WillByDefault(Invoke([](uint32_t index, vector<uint8_t> *result) {
+          result->assign(4, static_cast<uint8_t>(index));
+          return true;
+        }));
+    ON_CALL(pdb_, GetMethodSeqInfo(_, _, _))
+        .WillByDefault(Invoke([](uint32_t doc_index, uint32_t sequence_index,
+                                 MethodSequencePointInformation *info) {
+          SequencePointRecord record;
+          record.il_delta = 1;
+          record.start_line = sequence_index;
+          record.end_line = sequence_index + 1;
+          record.start_col = 1;
+          record.end_col = 2;
+          info->records.clear();
+          info->records.push_back(record);
+          return true;
+        }));
+
+    document_indices_.clear();
+    ASSERT_TRUE(DocumentIndex::CreateDocumentIndices(pdb_, &document_indices_));
+  }
+
+  // Loads the cache entry of pdb_id_ into the loaded_* members.
+  bool Load(uint32_t pdb_file_size) {
+    return symbol_cache_.Load(pdb_id_, pdb_file_size, &loaded_document_table_,
+                              &loaded_method_debug_info_table_,
+                              &loaded_local_scope_table_,
+                              &loaded_local_variable_table_,
+                              &loaded_local_constant_table_,
+                              &loaded_document_indices_);
+  }
+
+  // Flips the byte at offset in the cache file of pdb_id_.
+  void CorruptCacheFile(std::streamoff offset) {
+    std::fstream file(symbol_cache_.GetCacheFilePath(pdb_id_),
+                      std::ios::in | std::ios::out | std::ios::binary);
+    file.seekg(offset);
+    char byte = 0;
+    file.get(byte);
+    file.seekp(offset);
+    file.put(~byte);
+  }
+
+  // Mock of the synthetic Portable PDB.
+  NiceMock<IPortablePdbFileMock> pdb_;
+
+  // The cache under test.
+  SymbolCache symbol_cache_;
+
+  // Id of the synthetic PDB.
+  PdbId pdb_id_;
+
+  // Tables and document indices of the synthetic PDB.
+  vector<DocumentRow> document_table_;
+  vector<MethodDebugInformationRow> method_debug_info_table_;
+  vector<LocalScopeRow> local_scope_table_;
+  vector<LocalVariableRow> local_variable_table_;
+  vector<LocalConstantRow> local_constant_table_;
+  vector<unique_ptr<IDocumentIndex>> document_indices_;
+
+  // Tables and document indices loaded from the cache.
+  vector<DocumentRow> loaded_document_table_;
+  vector<MethodDebugInformationRow> loaded_method_debug_info_table_;
+  vector<LocalScopeRow> loaded_local_scope_table_;
+  vector<LocalVariableRow> loaded_local_variable_table_;
+  vector<LocalConstantRow> loaded_local_constant_table_;
+  vector<unique_ptr<IDocumentIndex>> loaded_document_indices_;
+};
+
+// Tests that the loaded tables and document indices are identical
+// to the stored ones.
+TEST_F(SymbolCacheTest, StoreAndLoad) {
+  SetUpPdb(3, 20);
+  EXPECT_FALSE(Load(kPdbFileSize));
+  ASSERT_TRUE(symbol_cache_.Store(pdb_id_, kPdbFileSize, pdb_));
+  ASSERT_TRUE(Load(kPdbFileSize));
+
+  ASSERT_EQ(loaded_method_debug_info_table_.size(),
+            method_debug_info_table_.size());
+  for (size_t i = 0; i < method_debug_info_table_.size(); ++i) {
+    EXPECT_EQ(loaded_method_debug_info_table_[i].document,
+              method_debug_info_table_[i].document);
+    EXPECT_EQ(loaded_method_debug_info_table_[i].sequence_points,
+              method_debug_info_table_[i].sequence_points);
+  }
+  EXPECT_EQ(loaded_document_table_.size(), document_table_.size());
+  EXPECT_EQ(loaded_local_scope_table_.size(), local_scope_table_.size());
+  ASSERT_EQ(loaded_local_variable_table_.size(), local_variable_table_.size());
+  EXPECT_EQ(loaded_local_variable_table_.back().index,
+            local_variable_table_.back().index);
+  ASSERT_EQ(loaded_local_constant_table_.size(), local_constant_table_.size());
+  EXPECT_EQ(loaded_local_constant_table_.back().signature,
+            local_constant_table_.back().signature);
+
+  ASSERT_EQ(loaded_document_indices_.size(), document_indices_.size());
+  for (size_t i = 0; i < document_indices_.size(); ++i) {
+    const IDocumentIndex &expected = *document_indices_[i];
+    const IDocumentIndex &actual = *loaded_document_indices_[i];
+    EXPECT_EQ(actual.GetFilePath(), expected.GetFilePath());
+    EXPECT_EQ(actual.GetSourceLanguage(), expected.GetSourceLanguage());
+    EXPECT_EQ(actual.GetHashAlgorithm(), expected.GetHashAlgorithm());
+    EXPECT_EQ(actual.GetHash(), expected.GetHash());
+
+    const vector<MethodInfo> &expected_methods = expected.GetMethods();
+    const vector<MethodInfo> &actual_methods = actual.GetMethods();
+    ASSERT_EQ(actual_methods.size(), expected_methods.size());
+    for (size_t j = 0; j < expected_methods.size(); ++j) {
+      const MethodInfo &expected_method = expected_methods[j];
+      const MethodInfo &actual_method = actual_methods[j];
+      EXPECT_EQ(actual_method.method_def, expected_method.method_def);
+      EXPECT_EQ(actual_method.first_line, expected_method.first_line);
+      EXPECT_EQ(actual_method.last_line, expected_method.last_line);
+
+      ASSERT_EQ(actual_method.sequence_points.size(), 1);
+      ASSERT_EQ(expected_method.sequence_points.size(), 1);
+      EXPECT_EQ(actual_method.sequence_points[0].start_line,
+                expected_method.sequence_points[0].start_line);
+      EXPECT_EQ(actual_method.sequence_points[0].end_col,
+                expected_method.sequence_points[0].end_col);
+
+      ASSERT_EQ(actual_method.local_scope.size(), 1);
+      ASSERT_EQ(expected_method.local_scope.size(), 1);
+      const Scope &expected_scope = expected_method.local_scope[0];
+      const Scope &actual_scope = actual_method.local_scope[0];
+      EXPECT_EQ(actual_scope.index, expected_scope.index);
+      EXPECT_EQ(actual_scope.length, expected_scope.length);
+      ASSERT_EQ(actual_scope.local_variables.size(), 1);
+      ASSERT_EQ(expected_scope.local_variables.size(), 1);
+      EXPECT_EQ(actual_scope.local_variables[0].name,
+                expected_scope.local_variables[0].name);
+      EXPECT_EQ(actual_scope.local_variables[0].slot,
+                expected_scope.local_variables[0].slot);
+      ASSERT_EQ(actual_scope.local_constants.size(),
+                expected_scope.local_constants.size());
+      for (size_t k = 0; k < expected_scope.local_constants.size(); ++k) {
+        EXPECT_EQ(actual_scope.local_constants[k].name,
+                  expected_scope.local_constants[k].name);
+        EXPECT_EQ(actual_scope.local_constants[k].signature_data,
+                  expected_scope.local_constants[k].signature_data);
+      }
+    }
+  }
+}
+
+// Tests that a cache entry of a PDB with another size or id is not used.
+TEST_F(SymbolCacheTest, StaleCacheFile) {
+  SetUpPdb(2, 5);
+  ASSERT_TRUE(symbol_cache_.Store(pdb_id_, kPdbFileSize, pdb_));
+  EXPECT_FALSE(Load(kPdbFileSize + 1));
+  EXPECT_TRUE(loaded_document_indices_.empty());
+
+  // Copies the cache file of pdb_id_ to the file of another id.
+  PdbId other_pdb_id = pdb_id_;
+  other_pdb_id[0] += 1;
+  {
+    std::ifstream source(symbol_cache_.GetCacheFilePath(pdb_id_),
+                         std::ios::binary);
+    std::ofstream destination(symbol_cache_.GetCacheFilePath(other_pdb_id),
+                              std::ios::binary);
+    destination << source.rdbuf();
+  }
+  std::swap(pdb_id_, other_pdb_id);
+  EXPECT_FALSE(Load(kPdbFileSize));
+  std::remove(symbol_cache_.GetCacheFilePath(other_pdb_id).c_str());
+
+  // Storing the entry again replaces the stale file.
+  ASSERT_TRUE(symbol_cache_.Store(pdb_id_, kPdbFileSize, pdb_));
+  EXPECT_TRUE(Load(kPdbFileSize));
+}
+
+// Tests that a corrupt cache file is detected.
+TEST_F(SymbolCacheTest, CorruptCacheFile) {
+  SetUpPdb(2, 5);
+  ASSERT_TRUE(symbol_cache_.Store(pdb_id_, kPdbFileSize, pdb_));
+
+  // Corrupts a byte in the middle of the payload.
+  CorruptCacheFile(100);
+  EXPECT_FALSE(Load(kPdbFileSize));
+  EXPECT_TRUE(loaded_document_table_.empty());
+  EXPECT_TRUE(loaded_document_indices_.empty());
+
+  // Truncated files are corrupt too.
+  ASSERT_TRUE(symbol_cache_.Store(pdb_id_, kPdbFileSize, pdb_));
+  {
+    std::ofstream file(symbol_cache_.GetCacheFilePath(pdb_id_),
+                       std::ios::out | std::ios::binary);
+    file.write("GCSC", 4);
+  }
+  EXPECT_FALSE(Load(kPdbFileSize));
+}
+
+// Benchmark that compares indexing the synthetic PDB (cold start)
+// with loading its cache entry (warm start).
+TEST_F(SymbolCacheTest, WarmStartIsFaster) {
+  SetUpPdb(100, 5000);
+  ASSERT_TRUE(symbol_cache_.Store(pdb_id_, kPdbFileSize, pdb_));
+
+  auto start = steady_clock::now();
+  vector<unique_ptr<IDocumentIndex>> document_indices;
+  ASSERT_TRUE(DocumentIndex::CreateDocumentIndices(pdb_, &document_indices));
+  duration<double, std::milli> cold_cost = steady_clock::now() - start;
+
+  start = steady_clock::now();
+  ASSERT_TRUE(Load(kPdbFileSize));
+  duration<double, std::milli> warm_cost = steady_clock::now() - start;
+
+  EXPECT_LT(warm_cost.count(), cold_cost.count())
+      << "Indexing: " << cold_cost.count()
+      << " ms, loading from the cache: " << warm_cost.count() << " ms.";
+}
+
+}  // namespace google_cloud_debugger_test
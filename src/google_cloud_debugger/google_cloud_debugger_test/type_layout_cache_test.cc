@@ -0,0 +1,216 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "i_cor_debug_mocks.h"
+#include "i_metadata_import_mock.h"
+#include "string_stream_wrapper.h"
+#include "type_layout_cache.h"
+
+using google_cloud_debugger::ConvertStringToWCharPtr;
+using google_cloud_debugger::TypeLayout;
+using google_cloud_debugger::TypeLayoutCache;
+using std::map;
+using std::shared_ptr;
+using std::string;
+using std::vector;
+using ::testing::_;
+using ::testing::DoAll;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::SetArgPointee;
+
+namespace google_cloud_debugger_test {
+
+// Test fixture for TypeLayoutCache tests. The class with token
+// class_token_ has the fields <Name>k__BackingField and count_
+// and the properties Name and Age.
+class TypeLayoutCacheTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    ON_CALL(metadata_import_, EnumFields(_, class_token_, _, _, _))
+        .WillByDefault(Invoke([this](HCORENUM *cor_enum, mdTypeDef,
+                                     mdFieldDef *field_defs, ULONG,
+                                     ULONG *field_defs_returned) {
+          // Returns all the fields the first time and nothing afterwards.
+          if (*cor_enum) {
+            *field_defs_returned = 0;
+            return S_FALSE;
+          }
+          ++enumerations_;
+          *cor_enum = reinterpret_cast<HCORENUM>(1);
+          field_defs[0] = 1;
+          field_defs[1] = 2;
+          *field_defs_returned = 2;
+          return S_OK;
+        }));
+    ON_CALL(metadata_import_, EnumProperties(_, class_token_, _, _, _))
+        .WillByDefault(Invoke([](HCORENUM *cor_enum, mdTypeDef,
+                                 mdProperty *property_defs, ULONG,
+                                 ULONG *property_defs_returned) {
+          if (*cor_enum) {
+            *property_defs_returned = 0;
+            return S_FALSE;
+          }
+          *cor_enum = reinterpret_cast<HCORENUM>(1);
+          property_defs[0] = 3;
+          property_defs[1] = 4;
+          *property_defs_returned = 2;
+          return S_OK;
+        }));
+    ON_CALL(metadata_import_, GetFieldPropsFirst(_, _, _, _, _, _))
+        .WillByDefault(Invoke([this](mdFieldDef field_def, mdTypeDef *,
+                                     LPWSTR name, ULONG, ULONG *name_length,
+                                     DWORD *) {
+          return GetName(field_def, name, name_length);
+        }));
+    ON_CALL(metadata_import_,
+            GetPropertyPropsFirst(_, _, _, _, _, _, _, _, _))
+        .WillByDefault(Invoke([this](mdProperty property_def, mdTypeDef *,
+                                     LPCWSTR name, ULONG, ULONG *name_length,
+                                     DWORD *, PCCOR_SIGNATURE *, ULONG *,
+                                     DWORD *) {
+          return GetName(property_def, const_cast<LPWSTR>(name),
+                         name_length);
+        }));
+    ON_CALL(metadata_import_,
+            GetPropertyPropsSecond(_, _, _, _, _, _, _, _))
+        .WillByDefault(
+            DoAll(SetArgPointee<4>(getter_), SetArgPointee<7>(0),
+                  Return(S_OK)));
+  }
+
+  // Sets name_length to the length of the name of the member with token
+  // token and copies the name to name if it is not null.
+  HRESULT GetName(mdToken token, WCHAR *name, ULONG *name_length) {
+    vector<WCHAR> wchar_name = ConvertStringToWCharPtr(names_[token]);
+    *name_length = wchar_name.size();
+    if (name) {
+      memcpy(name, wchar_name.data(), wchar_name.size() * sizeof(WCHAR));
+    }
+    return S_OK;
+  }
+
+  // Token of the class.
+  mdTypeDef class_token_ = 100;
+
+  // Token of the getter of the properties.
+  mdMethodDef getter_ = 200;
+
+  // Names of the fields and properties by token.
+  map<mdToken, string> names_ = {{1, "<Name>k__BackingField"},
+                                 {2, "count_"},
+                                 {3, "Name"},
+                                 {4, "Age"}};
+
+  // Number of times the fields of the class are enumerated.
+  int enumerations_ = 0;
+
+  NiceMock<IMetaDataImportMock> metadata_import_;
+  NiceMock<ICorDebugModuleMock> first_module_;
+  NiceMock<ICorDebugModuleMock> second_module_;
+
+  // Stream for errors.
+  std::ostringstream err_stream_;
+};
+
+// Tests that the layout contains the fields and the properties
+// that are not backed by a field.
+TEST_F(TypeLayoutCacheTest, ReadTypeLayout) {
+  TypeLayout layout;
+  EXPECT_EQ(TypeLayoutCache::ReadTypeLayout(&metadata_import_, class_token_,
+                                            &layout, &err_stream_),
+            S_OK);
+
+  ASSERT_EQ(layout.fields.size(), 2);
+  EXPECT_EQ(layout.fields[0].field_def, 1);
+  EXPECT_EQ(layout.fields[0].name, "Name");
+  EXPECT_TRUE(layout.fields[0].is_backing_field);
+  EXPECT_EQ(layout.fields[1].name, "count_");
+  EXPECT_FALSE(layout.fields[1].is_backing_field);
+
+  ASSERT_EQ(layout.properties.size(), 1);
+  EXPECT_EQ(layout.properties[0].property_def, 4);
+  EXPECT_EQ(layout.properties[0].name, "Age");
+  EXPECT_EQ(layout.properties[0].getter, getter_);
+}
+
+// Tests that the layout of a type is read once per module and read
+// again after its module is cleared.
+TEST_F(TypeLayoutCacheTest, CachesByModule) {
+  TypeLayoutCache cache;
+  shared_ptr<const TypeLayout> first_layout;
+  shared_ptr<const TypeLayout> second_layout;
+
+  EXPECT_EQ(cache.GetTypeLayout(&first_module_, &metadata_import_,
+                                class_token_, &first_layout, &err_stream_),
+            S_OK);
+  EXPECT_EQ(cache.GetTypeLayout(&first_module_, &metadata_import_,
+                                class_token_, &second_layout, &err_stream_),
+            S_OK);
+  EXPECT_EQ(first_layout, second_layout);
+  EXPECT_EQ(enumerations_, 1);
+
+  EXPECT_EQ(cache.GetTypeLayout(&second_module_, &metadata_import_,
+                                class_token_, &second_layout, &err_stream_),
+            S_OK);
+  EXPECT_NE(first_layout, second_layout);
+  EXPECT_EQ(enumerations_, 2);
+  EXPECT_EQ(cache.Size(), 2);
+
+  // Layouts without a module are not cached.
+  EXPECT_EQ(cache.GetTypeLayout(nullptr, &metadata_import_, class_token_,
+                                &second_layout, &err_stream_),
+            S_OK);
+  EXPECT_EQ(enumerations_, 3);
+  EXPECT_EQ(cache.Size(), 2);
+
+  cache.ClearModule(&first_module_);
+  EXPECT_EQ(cache.Size(), 1);
+  EXPECT_EQ(cache.GetTypeLayout(&first_module_, &metadata_import_,
+                                class_token_, &second_layout, &err_stream_),
+            S_OK);
+  EXPECT_EQ(enumerations_, 4);
+
+  cache.Clear();
+  EXPECT_EQ(cache.Size(), 0);
+}
+
+// Tests that a failure to enumerate the fields is not cached.
+TEST_F(TypeLayoutCacheTest, EnumerationError) {
+  EXPECT_CALL(metadata_import_, EnumFields(_, class_token_, _, _, _))
+      .WillOnce(Return(E_FAIL));
+
+  TypeLayoutCache cache;
+  shared_ptr<const TypeLayout> layout;
+  EXPECT_EQ(cache.GetTypeLayout(&first_module_, &metadata_import_,
+                                class_token_, &layout, &err_stream_),
+            E_FAIL);
+  EXPECT_EQ(cache.Size(), 0);
+  EXPECT_EQ(cache.GetTypeLayout(nullptr, nullptr, class_token_, &layout,
+                                &err_stream_),
+            E_INVALIDARG);
+}
+
+}  // namespace google_cloud_debugger_test
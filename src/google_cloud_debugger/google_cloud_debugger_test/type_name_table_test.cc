@@ -0,0 +1,157 @@
+// Copyright 2017 Google Inc. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "i_cor_debug_helper_mock.h"
+#include "i_metadata_import_mock.h"
+#include "type_name_table.h"
+#include "type_signature.h"
+
+using google_cloud_debugger::TypeNameTable;
+using std::string;
+using std::vector;
+using ::testing::_;
+using ::testing::DoAll;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::SetArgPointee;
+
+namespace google_cloud_debugger_test {
+
+// Test fixture for TypeNameTable tests. The module defines the types
+// App.Program (token 1) and App.Helper (token 2) and references the
+// type System.String (token 3).
+class TypeNameTableTest : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    ON_CALL(metadata_import_, EnumTypeDefs(_, _, _, _))
+        .WillByDefault(Invoke([this](HCORENUM *cor_enum, mdTypeDef *type_defs,
+                                     ULONG, ULONG *type_defs_returned) {
+          // Returns all the types the first time and nothing afterwards.
+          if (*cor_enum) {
+            *type_defs_returned = 0;
+            return S_FALSE;
+          }
+          ++enumerations_;
+          *cor_enum = reinterpret_cast<HCORENUM>(1);
+          type_defs[0] = 1;
+          type_defs[1] = 2;
+          *type_defs_returned = 2;
+          return S_OK;
+        }));
+    ON_CALL(metadata_import_, EnumTypeRefs(_, _, _, _))
+        .WillByDefault(Invoke([](HCORENUM *cor_enum, mdTypeRef *type_refs,
+                                 ULONG, ULONG *type_refs_returned) {
+          if (*cor_enum) {
+            *type_refs_returned = 0;
+            return S_FALSE;
+          }
+          *cor_enum = reinterpret_cast<HCORENUM>(1);
+          type_refs[0] = 3;
+          *type_refs_returned = 1;
+          return S_OK;
+        }));
+    ON_CALL(debug_helper_, GetTypeNameFromMdTypeDef(1, _, _, _, _))
+        .WillByDefault(
+            DoAll(SetArgPointee<2>(string("App.Program")), Return(S_OK)));
+    ON_CALL(debug_helper_, GetTypeNameFromMdTypeDef(2, _, _, _, _))
+        .WillByDefault(
+            DoAll(SetArgPointee<2>(string("App.Helper")), Return(S_OK)));
+    ON_CALL(debug_helper_, GetTypeNameFromMdTypeRef(3, _, _, _))
+        .WillByDefault(
+            DoAll(SetArgPointee<2>(string("System.String")), Return(S_OK)));
+  }
+
+  // Metadata of the module.
+  NiceMock<IMetaDataImportMock> metadata_import_;
+
+  // Helper that resolves the names of the types.
+  NiceMock<ICorDebugHelperMock> debug_helper_;
+
+  // Number of times the type definitions were enumerated.
+  int enumerations_ = 0;
+
+  // Error stream of the tests.
+  std::ostringstream err_stream_;
+};
+
+// Tests that types defined in and referenced by the module are found.
+TEST_F(TypeNameTableTest, FindsTypeDefsAndTypeRefs) {
+  TypeNameTable table;
+  EXPECT_FALSE(table.IsPopulated());
+  EXPECT_EQ(table.Populate(&metadata_import_, &debug_helper_, &err_stream_),
+            S_OK);
+  EXPECT_TRUE(table.IsPopulated());
+
+  mdTypeDef type_def = 0;
+  EXPECT_TRUE(table.FindTypeDef("App.Helper", &type_def));
+  EXPECT_EQ(type_def, 2);
+  EXPECT_FALSE(table.FindTypeDef("System.String", &type_def));
+
+  mdTypeRef type_ref = 0;
+  EXPECT_TRUE(table.FindTypeRef("System.String", &type_ref));
+  EXPECT_EQ(type_ref, 3);
+  EXPECT_FALSE(table.FindTypeRef("App.Program", &type_ref));
+}
+
+// Tests that concurrent Populate calls only enumerate the module once.
+TEST_F(TypeNameTableTest, PopulatesOnce) {
+  TypeNameTable table;
+  vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.push_back(std::thread([this, &table]() {
+      EXPECT_EQ(table.Populate(&metadata_import_, &debug_helper_,
+                               &err_stream_),
+                S_OK);
+      mdTypeDef type_def = 0;
+      EXPECT_TRUE(table.FindTypeDef("App.Program", &type_def));
+      EXPECT_EQ(type_def, 1);
+    }));
+  }
+  for (auto &&thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(enumerations_, 1);
+}
+
+// Tests that a failed Populate call is retried by the next call.
+TEST_F(TypeNameTableTest, RetriesAfterFailure) {
+  EXPECT_CALL(metadata_import_, EnumTypeRefs(_, _, _, _))
+      .WillOnce(Return(E_FAIL))
+      .WillRepeatedly(Invoke([](HCORENUM *cor_enum, mdTypeRef *,
+                                ULONG, ULONG *type_refs_returned) {
+        *type_refs_returned = 0;
+        return S_FALSE;
+      }));
+
+  TypeNameTable table;
+  EXPECT_EQ(table.Populate(&metadata_import_, &debug_helper_, &err_stream_),
+            E_FAIL);
+  EXPECT_FALSE(table.IsPopulated());
+  EXPECT_EQ(table.Populate(&metadata_import_, &debug_helper_, &err_stream_),
+            S_OK);
+  EXPECT_TRUE(table.IsPopulated());
+  EXPECT_EQ(enumerations_, 2);
+}
+
+}  // namespace google_cloud_debugger_test
@@ -16,7 +16,10 @@
 #include <gtest/gtest.h>
 #include <cstdint>
 #include <cstdlib>
+#include <limits>
 #include <queue>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "breakpoint.pb.h"
@@ -27,6 +30,7 @@
 #include "i_cor_debug_helper.h"
 #include "i_dbg_object_factory.h"
 #include "i_eval_coordinator_mock.h"
+#include "snapshot_size_budget.h"
 #include "variable_wrapper.h"
 #include "winerror.h"
 
@@ -35,6 +39,7 @@ using google_cloud_debugger::DbgObject;
 using google_cloud_debugger::ICorDebugHelper;
 using google_cloud_debugger::IDbgObjectFactory;
 using google_cloud_debugger::IEvalCoordinator;
+using google_cloud_debugger::SnapshotSizeBudget;
 using google_cloud_debugger::VariableWrapper;
 using std::queue;
 using std::shared_ptr;
@@ -130,6 +135,31 @@ class FakeDbgObjectMembers : public FakeDbgObjectBase {
   vector<VariableWrapper> members_;
 };
 
+// Helper class that implements DbgObject.
+// Like the objects the debugger captures, this class adds the protos
+// of its members to the proto of the variable.
+class FakeDbgObjectNested : public FakeDbgObjectBase {
+ public:
+  FakeDbgObjectNested(ICorDebugType *debug_type, int depth)
+      : FakeDbgObjectBase(debug_type, depth) {}
+
+  virtual HRESULT PopulateValue(Variable *variable) override { return S_FALSE; }
+
+  virtual HRESULT PopulateMembers(Variable *variable_proto,
+                                  std::vector<VariableWrapper> *members,
+                                  IEvalCoordinator *eval_coordinator) override {
+    for (auto &member : members_) {
+      Variable *member_proto = variable_proto->add_members();
+      member_proto->set_name(member.first);
+      members->push_back(VariableWrapper(member_proto, member.second));
+    }
+    return S_OK;
+  }
+
+  // Names and objects of the members of the object.
+  vector<std::pair<string, shared_ptr<DbgObject>>> members_;
+};
+
 // Test Fixture for DbgClass.
 // Contains various ICorDebug mock objects needed.
 class VariableWrapperTest : public ::testing::Test {
@@ -146,6 +176,43 @@ class VariableWrapperTest : public ::testing::Test {
       FakeDbgObjectMembers::GetVariableWrapper();
 
   IEvalCoordinatorMock eval_coordinator_;
+
+  // Budget that is never exhausted.
+  SnapshotSizeBudget unlimited_budget_ =
+      SnapshotSizeBudget(std::numeric_limits<std::int64_t>::max());
+
+  // Returns an object of type type with value value.
+  shared_ptr<FakeDbgObjectValue> CreateValue(const string &type,
+                                             const string &value) {
+    shared_ptr<FakeDbgObjectValue> object(new FakeDbgObjectValue(nullptr, 0));
+    object->type_ = type;
+    object->value_ = value;
+    return object;
+  }
+
+  // Returns a wrapper of variable_proto whose object has a member "child",
+  // which has a member "grandchild", which has the members "first"
+  // and "second" with objects first_value and second_value.
+  VariableWrapper CreateNestedVariable(Variable *variable_proto,
+                                       shared_ptr<DbgObject> first_value,
+                                       shared_ptr<DbgObject> second_value) {
+    shared_ptr<FakeDbgObjectNested> grandchild(
+        new FakeDbgObjectNested(nullptr, 0));
+    grandchild->type_ = "Grandchild";
+    grandchild->members_.push_back(std::make_pair("first", first_value));
+    grandchild->members_.push_back(std::make_pair("second", second_value));
+
+    shared_ptr<FakeDbgObjectNested> child(new FakeDbgObjectNested(nullptr, 0));
+    child->type_ = "Child";
+    child->members_.push_back(std::make_pair("grandchild", grandchild));
+
+    shared_ptr<FakeDbgObjectNested> root(new FakeDbgObjectNested(nullptr, 0));
+    root->type_ = "Root";
+    root->members_.push_back(std::make_pair("child", child));
+
+    variable_proto->set_name("root");
+    return VariableWrapper(variable_proto, root);
+  }
 };
 
 // Helper function to check the value populated in the variable proto
@@ -235,7 +302,7 @@ TEST_F(VariableWrapperTest, TestPopulateMembersError) {
 TEST_F(VariableWrapperTest, TestBFSOneItem) {
   queue<VariableWrapper> bfs_queue;
   bfs_queue.push(value_wrapper_);
-  HRESULT hr = VariableWrapper::PerformBFS(&bfs_queue, []() { return false; },
+  HRESULT hr = VariableWrapper::PerformBFS(&bfs_queue, &unlimited_budget_,
                                            &eval_coordinator_);
   EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
 
@@ -251,7 +318,7 @@ TEST_F(VariableWrapperTest, TestBFSTwoChildren) {
 
   queue<VariableWrapper> bfs_queue;
   bfs_queue.push(members_wrapper_);
-  HRESULT hr = VariableWrapper::PerformBFS(&bfs_queue, []() { return false; },
+  HRESULT hr = VariableWrapper::PerformBFS(&bfs_queue, &unlimited_budget_,
                                            &eval_coordinator_);
   EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
 
@@ -273,20 +340,12 @@ TEST_F(VariableWrapperTest, TestBFSTwoChildrenWithTerminatingCondition) {
   AddMembers(&members_wrapper_, value_wrapper_);
   AddMembers(&members_wrapper_, value_wrapper_2_);
 
-  bool first_time = true;
+  // Terminates the BFS after processing the first item.
+  SnapshotSizeBudget budget(0);
   queue<VariableWrapper> bfs_queue;
   bfs_queue.push(members_wrapper_);
-  HRESULT hr = VariableWrapper::PerformBFS(&bfs_queue,
-                                           [&first_time]() {
-                                             // Terminates the BFS after
-                                             // processing the first item.
-                                             if (first_time) {
-                                               first_time = false;
-                                               return false;
-                                             }
-                                             return true;
-                                           },
-                                           &eval_coordinator_);
+  HRESULT hr =
+      VariableWrapper::PerformBFS(&bfs_queue, &budget, &eval_coordinator_);
   EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
 
   // BFS should fill up the proto with correct type.
@@ -312,7 +371,7 @@ TEST_F(VariableWrapperTest, TestBFSTwoLevels) {
 
   queue<VariableWrapper> bfs_queue;
   bfs_queue.push(members_wrapper_);
-  HRESULT hr = VariableWrapper::PerformBFS(&bfs_queue, []() { return false; },
+  HRESULT hr = VariableWrapper::PerformBFS(&bfs_queue, &unlimited_budget_,
                                            &eval_coordinator_);
   EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
 
@@ -347,7 +406,7 @@ TEST_F(VariableWrapperTest, TestBFSThreeLevels) {
 
   queue<VariableWrapper> bfs_queue;
   bfs_queue.push(members_wrapper_);
-  HRESULT hr = VariableWrapper::PerformBFS(&bfs_queue, []() { return false; },
+  HRESULT hr = VariableWrapper::PerformBFS(&bfs_queue, &unlimited_budget_,
                                            &eval_coordinator_);
   EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
 
@@ -366,4 +425,62 @@ TEST_F(VariableWrapperTest, TestBFSThreeLevels) {
   CheckValue(&value_wrapper_4_);
 }
 
+// Tests that the budget used by PerformBFS matches the serialized size
+// of the variables, including the length prefixes of the ancestors that
+// grow when a deeply nested member is populated.
+TEST_F(VariableWrapperTest, TestBFSBudgetIsExact) {
+  Variable variable;
+  queue<VariableWrapper> bfs_queue;
+  bfs_queue.push(CreateNestedVariable(&variable,
+                                      CreateValue("string", string(300, 'a')),
+                                      CreateValue("int", "1")));
+
+  SnapshotSizeBudget budget(std::numeric_limits<std::int64_t>::max(),
+                            SnapshotSizeBudget::GetFieldSize(
+                                variable.ByteSize()));
+  HRESULT hr =
+      VariableWrapper::PerformBFS(&bfs_queue, &budget, &eval_coordinator_);
+  EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
+
+  EXPECT_EQ(budget.GetUsedSize(),
+            SnapshotSizeBudget::GetFieldSize(variable.ByteSize()));
+}
+
+// Tests that PerformBFS stops as soon as the budget runs out when a
+// deeply nested member makes the length prefixes of its ancestors grow.
+TEST_F(VariableWrapperTest, TestBFSBudgetRunsOutAtDeepLevel) {
+  // Measures the whole variable first.
+  Variable full_variable;
+  queue<VariableWrapper> full_bfs_queue;
+  full_bfs_queue.push(CreateNestedVariable(
+      &full_variable, CreateValue("string", string(300, 'a')),
+      CreateValue("int", "1")));
+  HRESULT hr = VariableWrapper::PerformBFS(
+      &full_bfs_queue, &unlimited_budget_, &eval_coordinator_);
+  EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
+  std::int64_t full_size =
+      SnapshotSizeBudget::GetFieldSize(full_variable.ByteSize());
+
+  // The type and value of the second member take 2 + 3 and 2 + 1 bytes
+  // and do not change any length prefix, so the budget runs out right
+  // after the first member is populated.
+  Variable variable;
+  queue<VariableWrapper> bfs_queue;
+  bfs_queue.push(CreateNestedVariable(&variable,
+                                      CreateValue("string", string(300, 'a')),
+                                      CreateValue("int", "1")));
+  SnapshotSizeBudget budget(full_size - 9, SnapshotSizeBudget::GetFieldSize(
+                                               variable.ByteSize()));
+  hr = VariableWrapper::PerformBFS(&bfs_queue, &budget, &eval_coordinator_);
+  EXPECT_TRUE(SUCCEEDED(hr)) << "Failed with hr: " << hr;
+
+  EXPECT_TRUE(budget.IsExhausted());
+  EXPECT_EQ(budget.GetUsedSize(), full_size - 8);
+  const Variable &grandchild = variable.members(0).members(0);
+  ASSERT_EQ(grandchild.members_size(), 2);
+  EXPECT_EQ(grandchild.members(0).value(), string(300, 'a'));
+  EXPECT_EQ(grandchild.members(1).type(), "");
+  EXPECT_EQ(grandchild.members(1).value(), "");
+}
+
 }  // namespace google_cloud_debugger_test
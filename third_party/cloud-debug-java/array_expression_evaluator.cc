@@ -69,6 +69,15 @@ HRESULT IndexerAccessExpressionEvaluator::Compile(IDbgStackFrame *stack_frame,
   }
 
   // If this is not an array, we need to get the function get_Item().
+  // The one found by a previous compilation is reused if the types
+  // of the collection and the index have not changed.
+  if (get_item_method_ &&
+      get_item_source_type_.compare(source_type) == 0 &&
+      get_item_index_type_.compare(index_type) == 0) {
+    return S_OK;
+  }
+
+  get_item_method_.Release();
   CComPtr<ICorDebugModule> debug_module;
   CComPtr<IMetaDataImport> metadata_import;
   mdTypeDef class_token;
@@ -96,10 +105,13 @@ HRESULT IndexerAccessExpressionEvaluator::Compile(IDbgStackFrame *stack_frame,
   if (FAILED(hr)) {
     std::cerr << "Failed to retrieve ICorDebugFunction for get_Item "
               << " from class " << source_type.type_name;
+    get_item_method_.Release();
     return hr;
   }
 
   return_type_ = method_info.returned_type;
+  get_item_source_type_ = source_type;
+  get_item_index_type_ = index_type;
   return S_OK;
 }
 
@@ -87,6 +87,11 @@ class IndexerAccessExpressionEvaluator : public ExpressionEvaluator {
   // ICorDebugFunction for get_Item method.
   CComPtr<ICorDebugFunction> get_item_method_;
 
+  // Types of the collection and the index that get_item_method_
+  // was found for.
+  TypeSignature get_item_source_type_;
+  TypeSignature get_item_index_type_;
+
   // Helper for dealing with ICorDebug objects.
   std::shared_ptr<ICorDebugHelper> debug_helper_;
 
@@ -46,6 +46,7 @@ FieldEvaluator::FieldEvaluator(
 HRESULT FieldEvaluator::Compile(IDbgStackFrame *stack_frame,
                                 ICorDebugILFrame *debug_frame,
                                 std::ostream *err_stream) {
+  compiled_using_instance_source_ = false;
   HRESULT hr = CompileUsingInstanceSource(stack_frame, debug_frame, err_stream);
   if (SUCCEEDED(hr)) {
     compiled_using_instance_source_ = true;
@@ -96,6 +97,33 @@ HRESULT FieldEvaluator::CompileClassMemberHelper(
     const TypeSignature &class_signature, const std::string &member_name,
     IDbgStackFrame *stack_frame, ICorDebugILFrame *debug_frame,
     std::ostream *err_stream) {
+  // The member found by a previous compilation only depends on the
+  // class it was found in, so the metadata lookups can be skipped
+  // if the class is the same.
+  if (member_bound_ && bound_class_signature_.compare(class_signature) == 0) {
+    return S_OK;
+  }
+
+  member_bound_ = false;
+  is_array_length_ = false;
+  class_property_.reset();
+  metadata_import_.Release();
+  debug_module_.Release();
+
+  HRESULT hr = BindClassMember(class_signature, member_name, stack_frame,
+                               debug_frame, err_stream);
+  if (SUCCEEDED(hr)) {
+    member_bound_ = true;
+    bound_class_signature_ = class_signature;
+  }
+
+  return hr;
+}
+
+HRESULT FieldEvaluator::BindClassMember(
+    const TypeSignature &class_signature, const std::string &member_name,
+    IDbgStackFrame *stack_frame, ICorDebugILFrame *debug_frame,
+    std::ostream *err_stream) {
   // If class_signature is an array, we can only support "Length" property.
   if (class_signature.is_array) {
     if (member_name.compare("Length") != 0) {
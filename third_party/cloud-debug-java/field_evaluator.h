@@ -67,12 +67,23 @@ class FieldEvaluator : public ExpressionEvaluator {
   // Helper function to find member_name in class_name.
   // This will extract out the TypeSignature of the member
   // and sets class_property if it is a non-auto class.
+  // The member found is reused by later compilations against
+  // the same class_signature.
   HRESULT CompileClassMemberHelper(const TypeSignature &class_signature,
                                    const std::string &member_name,
                                    IDbgStackFrame *stack_frame,
                                    ICorDebugILFrame *debug_frame,
                                    std::ostream *err_stream);
 
+  // Looks up member_name in the metadata of class_signature.
+  // Called by CompileClassMemberHelper when there is no member
+  // found by a previous compilation that can be reused.
+  HRESULT BindClassMember(const TypeSignature &class_signature,
+                          const std::string &member_name,
+                          IDbgStackFrame *stack_frame,
+                          ICorDebugILFrame *debug_frame,
+                          std::ostream *err_stream);
+
   // Helper function to evaluate static field/property.
   HRESULT EvaluateStaticMember(
       std::shared_ptr<DbgObject> *result_object,
@@ -138,6 +149,13 @@ class FieldEvaluator : public ExpressionEvaluator {
   // class name, we won't know the instantiated type.
   bool compiled_using_instance_source_ = true;
 
+  // True if a previous compilation found the member in the class
+  // bound_class_signature_.
+  bool member_bound_ = false;
+
+  // Signature of the class the member was found in.
+  TypeSignature bound_class_signature_;
+
   DISALLOW_COPY_AND_ASSIGN(FieldEvaluator);
 };
 
@@ -37,6 +37,11 @@ HRESULT IdentifierEvaluator::Compile(
     return E_INVALIDARG;
   }
 
+  // The values of the frame are always retrieved again.
+  identifier_object_.reset();
+  this_object_.reset();
+  generic_class_types_.clear();
+
   // Case 1: this is a local variable.
   HRESULT hr = stack_frame->GetLocalVariable(identifier_name_,
     &identifier_object_, &std::cerr);
@@ -46,35 +51,54 @@ HRESULT IdentifierEvaluator::Compile(
 
   // S_FALSE means there is no match.
   if (SUCCEEDED(hr) && hr != S_FALSE) {
+    class_property_.reset();
     return identifier_object_->GetTypeSignature(&result_type_);
   }
 
-  // Case 2: static and non-static fields and auto-implemented properties.
-  hr = stack_frame->GetFieldAndAutoPropFromFrame(identifier_name_,
-    &identifier_object_, debug_frame, &std::cerr);
-  if (FAILED(hr)) {
-    return hr;
-  }
+  // If a previous compilation found a property, the identifier
+  // is not a field and the property can be reused unless its type
+  // depends on the generic type parameters of the class.
+  if (class_property_) {
+    hr = stack_frame->GetCurrentClassTypeParameters(&generic_class_types_);
+    if (FAILED(hr)) {
+      return hr;
+    }
 
-  // S_FALSE means there is no match.
-  if (SUCCEEDED(hr) && hr != S_FALSE) {
-    return identifier_object_->GetTypeSignature(&result_type_);
+    if (!generic_class_types_.empty()) {
+      class_property_.reset();
+    }
   }
 
-  // Case 3: static and non-static properties with getter.
-  hr = stack_frame->GetPropertyFromFrame(identifier_name_,
-    &class_property_, &std::cerr);
-  if (hr == S_FALSE) {
-    hr = E_FAIL;
-  }
+  if (!class_property_) {
+    // Case 2: static and non-static fields and auto-implemented properties.
+    hr = stack_frame->GetFieldAndAutoPropFromFrame(identifier_name_,
+      &identifier_object_, debug_frame, &std::cerr);
+    if (FAILED(hr)) {
+      return hr;
+    }
 
-  if (FAILED(hr)) {
-    return hr;
-  }
+    // S_FALSE means there is no match.
+    if (SUCCEEDED(hr) && hr != S_FALSE) {
+      return identifier_object_->GetTypeSignature(&result_type_);
+    }
 
-  hr = class_property_->GetTypeSignature(&result_type_);
-  if (FAILED(hr)) {
-    return hr;
+    // Case 3: static and non-static properties with getter.
+    hr = stack_frame->GetPropertyFromFrame(identifier_name_,
+      &class_property_, &std::cerr);
+    if (hr == S_FALSE) {
+      hr = E_FAIL;
+    }
+
+    if (FAILED(hr)) {
+      class_property_.reset();
+      return hr;
+    }
+
+    hr = class_property_->GetTypeSignature(&result_type_);
+    if (FAILED(hr)) {
+      class_property_.reset();
+      return hr;
+    }
   }
 
   if (!class_property_->IsStatic() && stack_frame->IsStaticMethod()) {
@@ -16,6 +16,7 @@
 
 #include "method_call_evaluator.h"
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 
@@ -47,8 +48,7 @@ HRESULT MethodCallEvaluator::Compile(IDbgStackFrame *stack_frame,
                                      ICorDebugILFrame *debug_frame,
                                      std::ostream *err_stream) {
   HRESULT hr;
-  method_info_.method_name = method_name_;
-  std::vector<std::string> argument_types;
+  std::vector<TypeSignature> argument_types;
 
   // Don't support method call with more than 10 arguments.
   const int max_argument_supported = 10;
@@ -65,39 +65,65 @@ HRESULT MethodCallEvaluator::Compile(IDbgStackFrame *stack_frame,
       return hr;
     }
 
-    method_info_.argument_types.push_back(argument->GetStaticType());
+    argument_types.push_back(argument->GetStaticType());
+  }
+
+  // The method matched by a previous compilation is kept as long as
+  // the arguments have the same types, so the metadata lookups below
+  // only happen the first time the expression is compiled.
+  bool same_argument_types =
+      argument_types.size() == method_info_.argument_types.size() &&
+      std::equal(argument_types.begin(), argument_types.end(),
+                 method_info_.argument_types.begin(),
+                 [](const TypeSignature &first, const TypeSignature &second) {
+                   return first.compare(second) == 0;
+                 });
+  if (!matched_method_ || !same_argument_types) {
+    method_info_.argument_types = std::move(argument_types);
+    ClearMatchedMethod();
   }
 
+  // These objects belong to the frame so they are always retrieved again.
+  this_obj_.reset();
+  current_class_generic_types_.clear();
+  instance_source_is_invoking_obj_ = false;
+
   if ((instance_source_ == nullptr) && possible_class_name_.empty()) {
     // No source and no class name so this has to be interpreted
     // as a method in the current class.
-    hr = stack_frame->GetDebugFunctionFromCurrentClass(&method_info_,
-                                                       &matched_method_);
+    // TOOD(quoct): Need to find a way to do this for
+    // fully qualified class name. Probably have to update ANTLR
+    // grammar file to support that.
+    hr = stack_frame->GetCurrentClassTypeParameters(
+        &current_class_generic_types_);
     if (FAILED(hr)) {
+      std::cerr << "Failed to retrieve generic type parameters for class.";
       return hr;
     }
 
-    if (matched_method_) {
-      // Retrieves the generic types for the class.
-      // TOOD(quoct): Need to find a way to do this for
-      // fully qualified class name. Probably have to update ANTLR
-      // grammar file to support that.
-      hr = stack_frame->GetCurrentClassTypeParameters(&current_class_generic_types_);
+    // In a generic class, the method is matched against the instantiated
+    // types of the class, which can change from frame to frame.
+    if (!current_class_generic_types_.empty()) {
+      ClearMatchedMethod();
+    }
+
+    if (!matched_method_) {
+      hr = stack_frame->GetDebugFunctionFromCurrentClass(&method_info_,
+                                                         &matched_method_);
       if (FAILED(hr)) {
-        std::cerr << "Failed to retrieve generic type parameters for class.";
         return hr;
       }
+    }
 
-      if (!method_info_.is_static) {
-        if (stack_frame->IsStaticMethod()) {
-          return E_FAIL;
-        }
-        this_obj_ = stack_frame->GetThisObject();
+    if (matched_method_ && !method_info_.is_static) {
+      if (stack_frame->IsStaticMethod()) {
+        return E_FAIL;
       }
+      this_obj_ = stack_frame->GetThisObject();
     }
   }
 
-  if (!matched_method_ && instance_source_ != nullptr) {
+  if (instance_source_ != nullptr) {
     // Calling method on a result of prior expression (for example:
     // "a.b.startsWith(...)").
     hr = instance_source_->Compile(stack_frame, debug_frame, err_stream);
@@ -106,12 +132,20 @@ HRESULT MethodCallEvaluator::Compile(IDbgStackFrame *stack_frame,
     }
 
     const TypeSignature &source_class_sig = instance_source_->GetStaticType();
-    hr = GetDebugFunctionFromClassNameHelper(source_class_sig, stack_frame,
-                                             &method_info_, &matched_method_);
-    if (FAILED(hr)) {
-      std::cerr << "Failed to retrieve ICorDebugFunction "
-                  << method_info_.method_name << " from the current class.";
-      return hr;
+    if (matched_method_ &&
+        matched_instance_source_type_.compare(source_class_sig) != 0) {
+      ClearMatchedMethod();
+    }
+
+    if (!matched_method_) {
+      hr = GetDebugFunctionFromClassNameHelper(source_class_sig, stack_frame,
+                                               &method_info_, &matched_method_);
+      if (FAILED(hr)) {
+        std::cerr << "Failed to retrieve ICorDebugFunction "
+                    << method_info_.method_name << " from the current class.";
+        return hr;
+      }
+      matched_instance_source_type_ = source_class_sig;
     }
 
     if (matched_method_) {
@@ -141,6 +175,15 @@ HRESULT MethodCallEvaluator::Compile(IDbgStackFrame *stack_frame,
   return S_OK;
 }
 
+void MethodCallEvaluator::ClearMatchedMethod() {
+  std::vector<TypeSignature> argument_types =
+      std::move(method_info_.argument_types);
+  method_info_ = MethodInfo();
+  method_info_.method_name = method_name_;
+  method_info_.argument_types = std::move(argument_types);
+  matched_method_.Release();
+}
+
 HRESULT MethodCallEvaluator::Evaluate(std::shared_ptr<DbgObject> *dbg_object,
                                       IEvalCoordinator *eval_coordinator,
                                       IDbgObjectFactory *obj_factory,
@@ -76,6 +76,11 @@ class MethodCallEvaluator : public ExpressionEvaluator {
                                               MethodInfo *method_info,
                                               ICorDebugFunction **result_method);
 
+  // Drops the method matched by a previous compilation so that the
+  // next compilation looks it up again. The argument types in
+  // method_info_ are kept.
+  void ClearMatchedMethod();
+
   // Gets the ICorDebugValue that represents the invoking object of
   // this method call.
   HRESULT GetInvokingObject(ICorDebugValue **invoking_object,
@@ -106,8 +111,14 @@ class MethodCallEvaluator : public ExpressionEvaluator {
   std::vector<std::unique_ptr<ExpressionEvaluator>> arguments_;
 
   // The ICorDebugFunction that represents the method being called.
+  // This is kept between compilations so the method does not have
+  // to be looked up again every time the expression is compiled.
   CComPtr<ICorDebugFunction> matched_method_;
 
+  // Static type of instance_source_ when matched_method_ was found
+  // in it. If the type changes, the method has to be looked up again.
+  TypeSignature matched_instance_source_type_;
+
   // Generic type parameters for the class that the method is in.
   // TODO(quoct): Add support for generic method.
   std::vector<CComPtr<ICorDebugType>> current_class_generic_types_;
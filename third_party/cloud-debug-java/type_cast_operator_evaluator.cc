@@ -75,18 +75,27 @@ HRESULT TypeCastOperatorEvaluator::Compile(IDbgStackFrame *stack_frame,
 
   // If both are object type, checks that either source_type is a base
   // class of target_type or target_type is a base class of source_type.
+  // The check walks the class hierarchy in the metadata so it is
+  // skipped if a previous compilation already did it for source_type.
   if (TypeCompilerHelper::IsObjectType(target_type_.cor_type) &&
       TypeCompilerHelper::IsObjectType(source_type.cor_type)) {
-    hr = stack_frame->IsBaseType(source_type,
-                                 target_type_,
-                                 &std::cerr);
-    if (FAILED(hr)) {
-      hr = stack_frame->IsBaseType(target_type_,
-                                   source_type,
+    if (!base_type_checked_ ||
+        base_type_checked_source_.compare(source_type) != 0) {
+      base_type_checked_ = false;
+      hr = stack_frame->IsBaseType(source_type,
+                                   target_type_,
                                    &std::cerr);
       if (FAILED(hr)) {
-        return hr;
+        hr = stack_frame->IsBaseType(target_type_,
+                                     source_type,
+                                     &std::cerr);
+        if (FAILED(hr)) {
+          return hr;
+        }
       }
+
+      base_type_checked_ = true;
+      base_type_checked_source_ = source_type;
     }
 
     result_type_ = target_type_;
@@ -101,6 +101,13 @@ class TypeCastOperatorEvaluator : public ExpressionEvaluator {
   // Target type of the expression.
   TypeSignature target_type_;
 
+  // True if a previous compilation checked that base_type_checked_source_
+  // and target_type_ are in the same class hierarchy.
+  bool base_type_checked_ = false;
+
+  // Source type that was checked against target_type_.
+  TypeSignature base_type_checked_source_;
+
   // Pointer to a member function of this class to do the actual evaluation.
   HRESULT (TypeCastOperatorEvaluator::*computer_)
   (std::shared_ptr<DbgObject> source, std::shared_ptr<DbgObject> *result) const;